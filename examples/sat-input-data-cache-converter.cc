@@ -0,0 +1,93 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <list>
+#include <string>
+#include <vector>
+#include "ns3/core-module.h"
+#include "ns3/satellite-module.h"
+
+using namespace ns3;
+
+/**
+ * \file sat-input-data-cache-converter.cc
+ * \ingroup satellite
+ *
+ * \brief Converts the numeric text input files of the data folder, i.e., the
+ * link results, waveform configuration, beam configuration and position
+ * files, into a single binary input data cache file (see SatInputDataCache).
+ * The cache file is written into the data folder, where it is used
+ * automatically by the following simulations.
+ *
+ * The converter needs to be re-run whenever the text input files are changed,
+ * otherwise the changed files are read from the text files.
+ *
+ * execute command -> ./waf --run "sat-input-data-cache-converter --PrintHelp"
+ */
+
+NS_LOG_COMPONENT_DEFINE ("sat-input-data-cache-converter");
+
+/**
+ * \brief Add the text files of a directory to the list of files to convert.
+ * \param directory directory to read
+ * \param files list of files to append
+ */
+static void
+AddTextFiles (std::string directory, std::vector<std::string> &files)
+{
+  if (!Singleton<SatEnvVariables>::Get ()->IsValidDirectory (directory))
+    {
+      NS_LOG_WARN ("Directory " << directory << " not found");
+      return;
+    }
+
+  std::list<std::string> names = SystemPath::ReadFiles (directory);
+
+  for (std::list<std::string>::const_iterator it = names.begin (); it != names.end (); ++it)
+    {
+      if ((it->size () > 4) && (it->compare (it->size () - 4, 4, ".txt") == 0))
+        {
+          files.push_back (directory + "/" + *it);
+        }
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  LogComponentEnable ("sat-input-data-cache-converter", LOG_LEVEL_INFO);
+
+  std::string dataPath = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory ();
+  std::string fileName = "inputdatacache.bin";
+
+  CommandLine cmd;
+  cmd.AddValue ("FileName", "Name of the cache file within the data folder", fileName);
+  cmd.Parse (argc, argv);
+
+  std::vector<std::string> files;
+  AddTextFiles (dataPath, files);
+  AddTextFiles (dataPath + "/linkresults", files);
+
+  std::string cacheFilePathName = dataPath + "/" + fileName;
+  uint32_t converted = SatInputDataCache::WriteCacheFile (cacheFilePathName, files);
+
+  NS_LOG_INFO ("Converted " << converted << " of " << files.size () << " files into " << cacheFilePathName);
+
+  return 0;
+}
@@ -143,8 +143,9 @@ SatMarkovFadingExamplePlot::Run ()
   SatBaseFading::ElevationCallback elevationCb = MakeCallback (&SatMarkovFadingExamplePlot::GetElevation,this);
   SatBaseFading::VelocityCallback velocityCb = MakeCallback (&SatMarkovFadingExamplePlot::GetVelocity,this);
 
-  /// Create fading container based on default configuration
-  Ptr<SatMarkovContainer> markovContainer = CreateObject<SatMarkovContainer> (markovConf,elevationCb,velocityCb);
+  /// Create fading engine and container based on default configuration
+  Ptr<SatMarkovFadingEngine> fadingEngine = CreateObject<SatMarkovFadingEngine> (markovConf);
+  Ptr<SatMarkovContainer> markovContainer = CreateObject<SatMarkovContainer> (fadingEngine,elevationCb,velocityCb);
 
   markovContainer->TraceConnect ("FadingTrace","The trace for fading values",MakeCallback (&SatMarkovFadingExamplePlot::FadingTraceCb,this));
 
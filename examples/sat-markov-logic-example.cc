@@ -79,8 +79,9 @@ main (int argc, char *argv[])
   SatBaseFading::ElevationCallback elevationCb = MakeCallback (&GetElevation);
   SatBaseFading::VelocityCallback velocityCb = MakeCallback (&GetVelocity);
 
-  /// Create fading container based on default configuration
-  Ptr<SatMarkovContainer> markovContainer = CreateObject<SatMarkovContainer> (markovConf,elevationCb,velocityCb);
+  /// Create fading engine and container based on default configuration
+  Ptr<SatMarkovFadingEngine> fadingEngine = CreateObject<SatMarkovFadingEngine> (markovConf);
+  Ptr<SatMarkovContainer> markovContainer = CreateObject<SatMarkovContainer> (fadingEngine,elevationCb,velocityCb);
 
   Address macAddress;
 
@@ -32,6 +32,8 @@
 #include "../model/satellite-phy.h"
 #include "../model/satellite-phy-tx.h"
 #include "../model/satellite-phy-rx.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-geo-net-device.h"
 #include "../model/satellite-arp-cache.h"
 #include "../model/satellite-mobility-model.h"
 #include "../model/satellite-propagation-delay-model.h"
@@ -264,6 +266,7 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
       {
         /// create default Markov & Loo configurations
         m_markovConf = CreateObject<SatMarkovConf> ();
+        m_markovFadingEngine = CreateObject<SatMarkovFadingEngine> (m_markovConf);
         break;
       }
     case SatEnums::FADING_OFF:
@@ -271,6 +274,7 @@ SatBeamHelper::SatBeamHelper (Ptr<Node> geoNode,
     default:
       {
         m_markovConf = NULL;
+        m_markovFadingEngine = NULL;
         break;
       }
     }
@@ -287,6 +291,7 @@ SatBeamHelper::DoDispose ()
   m_flChannels.clear ();
   m_beamFreqs.clear ();
   m_markovConf = NULL;
+  m_markovFadingEngine = NULL;
   m_ncc = NULL;
   m_geoHelper = NULL;
   m_gwHelper = NULL;
@@ -347,6 +352,25 @@ SatBeamHelper::Install (NodeContainer ut, Ptr<Node> gwNode, uint32_t gwId, uint3
 
   NS_ASSERT (m_geoNode != NULL);
 
+  // With the beam matrix interference model, the co-channel interference of the
+  // forward user link is calculated from the interference matrix of the channel.
+  EnumValue fwdIfModel;
+  m_utHelper->GetAttribute ("DaFwdLinkInterferenceModel", fwdIfModel);
+
+  if (fwdIfModel.Get () == SatPhyRxCarrierConf::IF_BEAM_MATRIX)
+    {
+      Ptr<SatBeamInterferenceMatrix> ifMatrix = userLink.first->GetInterferenceMatrix ();
+
+      if (ifMatrix == NULL)
+        {
+          ifMatrix = CreateObject<SatBeamInterferenceMatrix> (userLink.first->GetPropagationDelayModel (),
+                                                              m_geoNode->GetObject<MobilityModel> ());
+          userLink.first->SetInterferenceMatrix (ifMatrix);
+        }
+
+      ifMatrix->AddBeam (beamId, m_antennaGainPatterns->GetAntennaGainPattern (beamId));
+    }
+
   // Get the position of the GW serving this beam, get the best beam based on antenna patterns
   // for this position, and set the antenna patterns to the feeder PHY objects via
   // AttachChannels method.
@@ -574,6 +598,50 @@ SatBeamHelper::GetNcc () const
   return m_ncc;
 }
 
+int64_t
+SatBeamHelper::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  NodeContainer nodes = GetGwNodes ();
+  nodes.Add (GetUtNodes ());
+
+  for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); ++i)
+    {
+      for (uint32_t j = 0; j < (*i)->GetNDevices (); j++)
+        {
+          Ptr<SatNetDevice> satDev = DynamicCast<SatNetDevice> ((*i)->GetDevice (j));
+
+          if (satDev)
+            {
+              currentStream += satDev->AssignStreams (currentStream);
+            }
+        }
+    }
+
+  if (m_geoNode)
+    {
+      for (uint32_t j = 0; j < m_geoNode->GetNDevices (); j++)
+        {
+          Ptr<SatGeoNetDevice> geoDev = DynamicCast<SatGeoNetDevice> (m_geoNode->GetDevice (j));
+
+          if (geoDev)
+            {
+              currentStream += geoDev->AssignStreams (currentStream);
+            }
+        }
+    }
+
+  if (m_markovFadingEngine)
+    {
+      currentStream += m_markovFadingEngine->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 uint32_t
 SatBeamHelper::GetUtBeamId (Ptr<Node> utNode) const
 {
@@ -1109,7 +1177,7 @@ SatBeamHelper::InstallFadingContainer (Ptr<Node> node) const
                                                                        observer);
 
             /// create a Markov fading container based on default configuration
-            fadingContainer = CreateObject<SatMarkovContainer> (m_markovConf,
+            fadingContainer = CreateObject<SatMarkovContainer> (m_markovFadingEngine,
                                                                 elevationCb,
                                                                 velocityCb);
             node->AggregateObject (fadingContainer);
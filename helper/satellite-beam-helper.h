@@ -253,6 +253,16 @@ public:
    */
   Ptr<SatNcc> GetNcc () const;
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the devices of the UT, GW and Geo Satellite nodes and by the
+   * Markov fading engine.
+   *
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * Get beam Id of the given UT.
    *
@@ -344,6 +354,11 @@ private:
    */
   Ptr<SatMarkovConf> m_markovConf;
 
+  /**
+   * Markov fading engine shared by the UTs
+   */
+  Ptr<SatMarkovFadingEngine> m_markovFadingEngine;
+
   /**
    * Propagation delay model
    * - Constant
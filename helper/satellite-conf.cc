@@ -27,6 +27,7 @@
 #include "satellite-conf.h"
 #include "ns3/singleton.h"
 #include "ns3/satellite-env-variables.h"
+#include "ns3/satellite-input-data-cache.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatConf");
 
@@ -331,6 +332,23 @@ SatConf::LoadSatConf (std::string filePathName)
 {
   NS_LOG_FUNCTION (this << filePathName);
 
+  // USE THE BINARY INPUT DATA CACHE, IF AVAILABLE
+  uint32_t rows = 0;
+  uint32_t columns = 0;
+  const double *table = Singleton<SatInputDataCache>::Get ()->GetTable (filePathName, rows, columns);
+
+  if ((table != 0) && (columns == 4))
+    {
+      for (uint32_t i = 0; i < rows; i++)
+        {
+          std::vector <uint32_t> beamConf (table + i * columns, table + (i + 1) * columns);
+          m_conf.push_back (beamConf);
+        }
+
+      m_beamCount = m_conf.size ();
+      return;
+    }
+
   // READ FROM THE SPECIFIED INPUT FILE
   std::ifstream *ifs = OpenFile (filePathName);
 
@@ -370,6 +388,22 @@ SatConf::LoadPositions (std::string filePathName, PositionContainer_t& container
 {
   NS_LOG_FUNCTION (this << filePathName);
 
+  // USE THE BINARY INPUT DATA CACHE, IF AVAILABLE
+  uint32_t rows = 0;
+  uint32_t columns = 0;
+  const double *table = Singleton<SatInputDataCache>::Get ()->GetTable (filePathName, rows, columns);
+
+  if ((table != 0) && (columns == 3))
+    {
+      for (uint32_t i = 0; i < rows; i++)
+        {
+          const double *row = table + i * columns;
+          container.push_back (GeoCoordinate (row[0], row[1], row[2]));
+        }
+
+      return;
+    }
+
   // READ FROM THE SPECIFIED INPUT FILE
   std::ifstream *ifs = OpenFile (filePathName);
 
@@ -24,6 +24,7 @@
 #include "ns3/double.h"
 #include "ns3/pointer.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "../model/satellite-const-variables.h"
 #include "../model/satellite-utils.h"
@@ -332,6 +333,7 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   // Flow id = by default 0
   Ptr<SatQueue> queue = CreateObject<SatQueue> (SatEnums::CONTROL_FID);
   Ptr<SatBaseEncapsulator> gwEncap = CreateObject<SatBaseEncapsulator> (addr, Mac48Address::GetBroadcast (), SatEnums::CONTROL_FID);
+  queue->AddQueueEventCallback (MakeCallback (&SatGwMac::ReceiveQueueEvent, mac));
   gwEncap->SetQueue (queue);
   llc->AddEncap (addr, Mac48Address::GetBroadcast (), SatEnums::CONTROL_FID, gwEncap);
   llc->SetCtrlMsgCallback (MakeCallback (&SatNetDevice::SendControlMsg, dev));
@@ -360,6 +362,19 @@ SatGwHelper::Install (Ptr<Node> n, uint32_t gwId, uint32_t beamId, Ptr<SatChanne
   // set scheduler to Mac
   mac->SetAttribute ("Scheduler", PointerValue (fdwLinkScheduler));
 
+  // Wake up the idle MAC, when the LLC buffers new packets. The forward link ARQ
+  // retransmissions are not notified with queue events, thus the MAC is not
+  // allowed to go idle with the ARQ.
+  llc->SetMacQueueEventCallback (MakeCallback (&SatGwMac::ReceiveQueueEvent, mac));
+
+  BooleanValue fwdLinkArqEnabled;
+  llc->GetAttribute ("FwdLinkArqEnabled", fwdLinkArqEnabled);
+
+  if (fwdLinkArqEnabled.Get ())
+    {
+      mac->SetAttribute ("IdleSleepEnabled", BooleanValue (false));
+    }
+
   mac->StartPeriodicTransmissions ();
 
   return dev;
@@ -306,6 +306,21 @@ SatHelper::GetUserHelper () const
   return m_userHelper;
 }
 
+int64_t
+SatHelper::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  currentStream += m_beamHelper->AssignStreams (currentStream);
+
+  InternetStackHelper internet;
+  currentStream += internet.AssignStreams (NodeContainer::GetGlobal (), currentStream);
+
+  return (currentStream - stream);
+}
+
 void
 SatHelper::CreateSimpleScenario ()
 {
@@ -145,6 +145,21 @@ public:
    */
   Ptr<SatUserHelper> GetUserHelper () const;
 
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables of the created scenario.
+   *
+   * Covers the satellite devices and the Markov fading engine (see
+   * SatBeamHelper::AssignStreams) and the Internet stacks of all nodes.
+   * The streams are seeded with the current run number, so calling this
+   * after RngSeedManager::SetRun moves an already created scenario to the
+   * new run.
+   *
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * \brief Set custom position allocator
    * \param posAllocator
@@ -18,6 +18,7 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
+#include <vector>
 #include "ns3/log.h"
 #include "ns3/enum.h"
 #include "ns3/ipv4-static-routing-helper.h"
@@ -359,41 +360,127 @@ SatUserHelper::InstallRouter (NodeContainer gw, Ptr<Node> router)
 {
   NS_LOG_FUNCTION (this);
 
-  for (NodeContainer::Iterator i = gw.Begin (); i != gw.End (); i++)
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  Ptr<Ipv4> ipv4Router = router->GetObject<Ipv4> ();
+  Ptr<Ipv4StaticRouting> routingRouter = ipv4RoutingHelper.GetStaticRouting (ipv4Router);
+
+  // Network routes to copy from each GW to the router, as network address and mask
+  std::vector<std::vector<std::pair<Ipv4Address, Ipv4Mask> > > gwNetworks (gw.GetN ());
+
+  // Index of the GW by the addresses of the GW interfaces to the beams,
+  // i.e. by the default route addresses of the UTs
+  std::map<Ipv4Address, uint32_t> gwIndexes;
+
+  std::vector<Ipv4Address> nextHops;
+  std::vector<uint32_t> routerIfs;
+
+  for (uint32_t i = 0; i < gw.GetN (); i++)
     {
-      NodeContainer gwRouter = NodeContainer ((*i), router);
+      NodeContainer gwRouter = NodeContainer (gw.Get (i), router);
 
       NetDeviceContainer nd = InstallBackboneNetwork (gwRouter);
       Ipv4InterfaceContainer addresses = m_ipv4Gw.Assign (nd);
-      Ipv4StaticRoutingHelper ipv4RoutingHelper;
 
       // Get IPv4 protocol implementations
-      Ptr<Ipv4> ipv4Gw = (*i)->GetObject<Ipv4> ();
+      Ptr<Ipv4> ipv4Gw = gw.Get (i)->GetObject<Ipv4> ();
       uint32_t lastGwIf = ipv4Gw->GetNInterfaces () - 1;
       Ptr<Ipv4StaticRouting> routingGw = ipv4RoutingHelper.GetStaticRouting (ipv4Gw);
       routingGw->SetDefaultRoute (addresses.GetAddress (1), lastGwIf);
       NS_LOG_INFO ("SatUserHelper::InstallRouter  GW default route: " << addresses.GetAddress (1) );
 
-      for (uint32_t  routeIndex = 0; routeIndex < routingGw->GetNRoutes (); routeIndex++)
+      nextHops.push_back (addresses.GetAddress (0));
+      routerIfs.push_back (ipv4Router->GetNInterfaces () - 1);
+
+      // routes to the beam networks of the interfaces created earlier (and not for local delivery index 0)
+      for (uint32_t j = 1; j < lastGwIf; j++)
+        {
+          Ipv4InterfaceAddress ifAddress = ipv4Gw->GetAddress (j, 0);
+          Ipv4Mask mask = ifAddress.GetMask ();
+
+          gwNetworks[i].push_back (std::make_pair (ifAddress.GetLocal ().CombineMask (mask), mask));
+          gwIndexes.insert (std::make_pair (ifAddress.GetLocal (), i));
+        }
+
+      m_ipv4Gw.NewNetwork ();
+    }
+
+  // Routes to the subscriber networks of the UTs served by the GWs. These are
+  // the routes the beam helper has set to the GWs for the UTs installed by
+  // this helper. They are not read back from the routing tables of the GWs,
+  // since reading a route by its index walks the table from its beginning.
+  Ptr<Node> previousUt = NULL;
+
+  for (NodeContainer::Iterator i = m_allUtUsers.Begin (); i != m_allUtUsers.End (); i++)
+    {
+      Ptr<Node> ut = GetUtNode (*i);
+
+      // the users of a UT are stored one after another
+      if (ut == previousUt)
+        {
+          continue;
+        }
+
+      previousUt = ut;
+
+      Ptr<Ipv4> ipv4Ut = ut->GetObject<Ipv4> ();
+      Ipv4RoutingTableEntry defaultRoute = ipv4RoutingHelper.GetStaticRouting (ipv4Ut)->GetDefaultRoute ();
+
+      std::map<Ipv4Address, uint32_t>::const_iterator gwIndex = gwIndexes.find (defaultRoute.GetGateway ());
+
+      // UT is not (yet) served by any of the GWs
+      if (gwIndex == gwIndexes.end ())
+        {
+          continue;
+        }
+
+      for (uint32_t j = 1; j < ipv4Ut->GetNInterfaces (); j++)
         {
-          // Get IPv4 protocol implementations
-          Ptr<Ipv4> ipv4Router = router->GetObject<Ipv4> ();
-          uint32_t lastRouterIf = ipv4Router->GetNInterfaces () - 1;
-          Ptr<Ipv4StaticRouting> routingRouter = ipv4RoutingHelper.GetStaticRouting (ipv4Router);
+          if (ipv4Ut->GetNetDevice (j)->GetInstanceTypeId ().GetName () != "ns3::SatNetDevice")
+            {
+              Ipv4Address address = ipv4Ut->GetAddress (j, 0).GetLocal ();
+              Ipv4Mask mask = ipv4Ut->GetAddress (j, 0).GetMask ();
+
+              gwNetworks[gwIndex->second].push_back (std::make_pair (address.CombineMask (mask), mask));
+            }
+        }
+    }
 
-          Ipv4RoutingTableEntry route = routingGw->GetRoute (routeIndex);
-          uint32_t interface = route.GetInterface ();
+  for (uint32_t i = 0; i < gw.GetN (); i++)
+    {
+      Ptr<Ipv4> ipv4Gw = gw.Get (i)->GetObject<Ipv4> ();
+      uint32_t lastGwIf = ipv4Gw->GetNInterfaces () - 1;
+      Ptr<Ipv4StaticRouting> routingGw = ipv4RoutingHelper.GetStaticRouting (ipv4Gw);
 
-          // set only routes for interfaces created earlier (and not for local delivery index 0)
-          if ((interface != 0) && (interface != lastGwIf))
+      // Besides the routes above, the GW has the routes to the loopback and
+      // backbone networks and the default route. If it has any other routes,
+      // e.g. to UTs not installed by this helper, copy its whole routing table.
+      if (routingGw->GetNRoutes () == gwNetworks[i].size () + 3)
+        {
+          for (uint32_t j = 0; j < gwNetworks[i].size (); j++)
             {
-              routingRouter->AddNetworkRouteTo (route.GetDest (), route.GetDestNetworkMask (), addresses.GetAddress (0), lastRouterIf);
-              NS_LOG_INFO ("SatUserHelper::InstallRouter, Router network route:" << route.GetDest ()
-                                                                                 << ", " << route.GetDestNetworkMask () << ", " << addresses.GetAddress (0));
+              routingRouter->AddNetworkRouteTo (gwNetworks[i][j].first, gwNetworks[i][j].second, nextHops[i], routerIfs[i]);
+              NS_LOG_INFO ("SatUserHelper::InstallRouter, Router network route:" << gwNetworks[i][j].first
+                                                                                 << ", " << gwNetworks[i][j].second << ", " << nextHops[i]);
             }
         }
+      else
+        {
+          NS_LOG_INFO ("SatUserHelper::InstallRouter, copy the routing table of GW " << gw.Get (i)->GetId ());
 
-      m_ipv4Gw.NewNetwork ();
+          for (uint32_t routeIndex = 0; routeIndex < routingGw->GetNRoutes (); routeIndex++)
+            {
+              Ipv4RoutingTableEntry route = routingGw->GetRoute (routeIndex);
+              uint32_t interface = route.GetInterface ();
+
+              // set only routes for interfaces created earlier (and not for local delivery index 0)
+              if ((interface != 0) && (interface != lastGwIf))
+                {
+                  routingRouter->AddNetworkRouteTo (route.GetDest (), route.GetDestNetworkMask (), nextHops[i], routerIfs[i]);
+                  NS_LOG_INFO ("SatUserHelper::InstallRouter, Router network route:" << route.GetDest ()
+                                                                                     << ", " << route.GetDestNetworkMask () << ", " << nextHops[i]);
+                }
+            }
+        }
     }
 }
 
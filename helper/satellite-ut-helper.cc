@@ -77,7 +77,8 @@ SatUtHelper::GetTypeId (void)
                    MakeEnumAccessor (&SatUtHelper::m_daInterferenceModel),
                    MakeEnumChecker (SatPhyRxCarrierConf::IF_CONSTANT, "Constant",
                                     SatPhyRxCarrierConf::IF_TRACE, "Trace",
-                                    SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket"))
+                                    SatPhyRxCarrierConf::IF_PER_PACKET, "PerPacket",
+                                    SatPhyRxCarrierConf::IF_BEAM_MATRIX, "BeamMatrix"))
     .AddAttribute ("FwdLinkErrorModel",
                    "Forward link error model",
                    EnumValue (SatPhyRxCarrierConf::EM_AVI),
@@ -105,6 +106,14 @@ SatUtHelper::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&SatUtHelper::m_crdsaOnlyForControl),
                    MakeBooleanChecker ())
+    .AddAttribute ("LeanInstall",
+                   "Install the UTs in lean mode for large scenarios. In lean mode the "
+                   "packet classifier and the channel estimation error table are shared "
+                   "between the UTs of the helper. Each UT still draws its own channel "
+                   "estimation errors.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SatUtHelper::m_leanInstall),
+                   MakeBooleanChecker ())
     .AddTraceSource ("Creation",
                      "Creation traces",
                      MakeTraceSourceAccessor (&SatUtHelper::m_creationTrace),
@@ -130,9 +139,13 @@ SatUtHelper::SatUtHelper ()
     m_daConstantErrorRate (0.0),
     m_linkResults (),
     m_llsConf (),
+    m_randomAccessConf (),
     m_enableChannelEstimationError (false),
     m_crdsaOnlyForControl (false),
-    m_raSettings ()
+    m_raSettings (),
+    m_leanInstall (false),
+    m_classifier (),
+    m_cecTableSource ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -158,9 +171,13 @@ SatUtHelper::SatUtHelper (SatTypedefs::CarrierBandwidthConverter_t carrierBandwi
     m_daConstantErrorRate (0.0),
     m_linkResults (),
     m_llsConf (),
+    m_randomAccessConf (),
     m_enableChannelEstimationError (false),
     m_crdsaOnlyForControl (false),
-    m_raSettings (randomAccessSettings)
+    m_raSettings (randomAccessSettings),
+    m_leanInstall (false),
+    m_classifier (),
+    m_cecTableSource ()
 {
   NS_LOG_FUNCTION (this << fwdLinkCarrierCount << seq );
   m_deviceFactory.SetTypeId ("ns3::SatNetDevice");
@@ -243,21 +260,45 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   params.m_rxCh = fCh;
 
   // Create a packet classifier
-  Ptr<SatPacketClassifier> classifier = Create<SatPacketClassifier> ();
+  Ptr<SatPacketClassifier> classifier = m_classifier;
+
+  if (classifier == NULL)
+    {
+      classifier = Create<SatPacketClassifier> ();
+    }
 
   /**
    * Channel estimation errors
    */
   Ptr<SatChannelEstimationErrorContainer> cec;
+
   // Not enabled, create only base class
   if (!m_enableChannelEstimationError)
     {
       cec = Create<SatSimpleChannelEstimationErrorContainer> ();
     }
+  // In lean mode the error table is read only once, but each UT draws its own errors
+  else if (m_cecTableSource != NULL)
+    {
+      cec = Create<SatFwdLinkChannelEstimationErrorContainer> (m_cecTableSource);
+    }
   // Create SatFwdLinkChannelEstimationErrorContainer
   else
     {
-      cec = Create<SatFwdLinkChannelEstimationErrorContainer> ();
+      Ptr<SatFwdLinkChannelEstimationErrorContainer> fwdLinkCec = Create<SatFwdLinkChannelEstimationErrorContainer> ();
+
+      if (m_leanInstall)
+        {
+          m_cecTableSource = fwdLinkCec;
+        }
+
+      cec = fwdLinkCec;
+    }
+
+  // In lean mode the same packet classifier is given to all the UTs
+  if (m_leanInstall)
+    {
+      m_classifier = classifier;
     }
 
   SatPhyRxCarrierConf::RxCarrierCreateParams_s parameters = SatPhyRxCarrierConf::RxCarrierCreateParams_s ();
@@ -270,6 +311,7 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
   parameters.m_cec = cec;
   parameters.m_raCollisionModel = m_raSettings.m_raCollisionModel;
   parameters.m_randomAccessModel = m_raSettings.m_randomAccessModel;
+  parameters.m_ifMatrix = fCh->GetInterferenceMatrix ();
 
   Ptr<SatUtPhy> phy = CreateObject<SatUtPhy> (params,
                                               m_linkResults,
@@ -404,10 +446,14 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
 
   if (m_raSettings.m_randomAccessModel != SatEnums::RA_MODEL_OFF)
     {
-      Ptr<SatRandomAccessConf> randomAccessConf = CreateObject<SatRandomAccessConf> (m_llsConf, m_superframeSeq);
+      /// the configuration is shared by the UTs, each UT keeps its own state
+      if (m_randomAccessConf == NULL)
+        {
+          m_randomAccessConf = CreateObject<SatRandomAccessConf> (m_llsConf, m_superframeSeq);
+        }
 
       /// create RA module with defaults
-      Ptr<SatRandomAccess> randomAccess = CreateObject<SatRandomAccess> (randomAccessConf, m_raSettings.m_randomAccessModel);
+      Ptr<SatRandomAccess> randomAccess = CreateObject<SatRandomAccess> (m_randomAccessConf, m_raSettings.m_randomAccessModel);
 
       /// attach callbacks
       if (m_crdsaOnlyForControl)
@@ -425,6 +471,9 @@ SatUtHelper::Install (Ptr<Node> n, uint32_t beamId, Ptr<SatChannel> fCh, Ptr<Sat
 
       /// attach the RA module
       mac->SetRandomAccess (randomAccess);
+
+      /// the frame starts are needed only while there is data to send
+      mac->SetBuffersIdleCallback (MakeCallback (&SatLlc::BuffersIdle, llc));
     }
 
   return dev;
@@ -35,6 +35,8 @@
 #include "ns3/satellite-mac.h"
 #include "ns3/satellite-random-access-container.h"
 #include "ns3/satellite-random-access-container-conf.h"
+#include "ns3/satellite-packet-classifier.h"
+#include "ns3/satellite-channel-estimation-error-container.h"
 #include "ns3/satellite-typedefs.h"
 
 namespace ns3 {
@@ -216,6 +218,12 @@ private:
    */
   Ptr<SatLowerLayerServiceConf> m_llsConf;
 
+  /**
+   * Random access configuration shared by the installed UTs. Created
+   * at the first installation with random access enabled.
+   */
+  Ptr<SatRandomAccessConf> m_randomAccessConf;
+
   /**
    * Enable channel estimation error modeling at forward link
    * receiver (= UT).
@@ -233,6 +241,23 @@ private:
    * The used random access model settings
    */
   RandomAccessSettings_s m_raSettings;
+
+  /**
+   * Install the UTs in lean mode, in which the packet classifier and the
+   * channel estimation error table are shared between the UTs.
+   */
+  bool m_leanInstall;
+
+  /**
+   * Packet classifier shared by the UTs installed in lean mode.
+   */
+  Ptr<SatPacketClassifier> m_classifier;
+
+  /**
+   * Channel estimation error container whose error table is shared by the
+   * UTs installed in lean mode.
+   */
+  Ptr<SatFwdLinkChannelEstimationErrorContainer> m_cecTableSource;
 };
 
 } // namespace ns3
@@ -40,8 +40,19 @@
 #include <ns3/nrtv-helper.h>
 #include <ns3/three-gpp-http-satellite-helper.h>
 #include <ns3/random-variable-stream.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/global-value.h>
 #include <ns3/satellite-enums.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 NS_LOG_COMPONENT_DEFINE ("SimulationHelper");
 
 namespace ns3 {
@@ -87,6 +98,11 @@ SimulationHelper::SimulationHelper ()
 	m_enableInputFileUtListPositions (false),
 	m_inputFileUtPositionsCheckBeams (true),
 	m_gwUserId (0),
+	m_sweepFileName (""),
+	m_sweepMaxParallelRuns (0),
+	m_sweepRunIndex (-1),
+	m_sweepRunsFinished (false),
+	m_sweepFailedRuns (0),
 	m_progressLoggingEnabled (false),
 	m_progressUpdateInterval (Seconds (0.5))
 {
@@ -110,6 +126,11 @@ SimulationHelper::SimulationHelper (std::string simulationName)
 	m_enableInputFileUtListPositions (false),
 	m_inputFileUtPositionsCheckBeams (true),
 	m_gwUserId (0),
+	m_sweepFileName (""),
+	m_sweepMaxParallelRuns (0),
+	m_sweepRunIndex (-1),
+	m_sweepRunsFinished (false),
+	m_sweepFailedRuns (0),
 	m_progressLoggingEnabled (false),
 	m_progressUpdateInterval (Seconds (0.5))
 {
@@ -213,6 +234,10 @@ SimulationHelper::AddDefaultUiArguments (CommandLine &cmd)
 
 	// Create a customizable output path
 	cmd.AddValue ("OutputPath", "Output path for storing the simulation statistics", m_outputPath);
+
+	// Sweep runs sharing the scenario set-up
+	cmd.AddValue ("SweepFile", "Sweep file with attribute overrides of one sweep point per line", m_sweepFileName);
+	cmd.AddValue ("SweepParallelRuns", "Maximum number of concurrent sweep runs, 0 for the number of processors", m_sweepMaxParallelRuns);
 }
 
 void
@@ -669,6 +694,13 @@ SimulationHelper::SetInterferenceModel(SatPhyRxCarrierConf::InterferenceModel if
 {
   NS_LOG_FUNCTION (this << ifModel << constantIf);
 
+  // Beam matrix interference model is available only in the forward link
+  if (ifModel == SatPhyRxCarrierConf::IF_BEAM_MATRIX)
+    {
+      NS_FATAL_ERROR ("Beam matrix interference model not supported in the return link, "
+                      "set ns3::SatUtHelper::DaFwdLinkInterferenceModel to use it in the forward link");
+    }
+
   Config::SetDefault ("ns3::SatUtHelper::DaFwdLinkInterferenceModel", EnumValue (ifModel));
   Config::SetDefault ("ns3::SatGwHelper::DaRtnLinkInterferenceModel", EnumValue (ifModel));
 
@@ -949,6 +981,12 @@ SimulationHelper::CreateSatScenario (SatHelper::PreDefinedScenario_t scenario)
 
   NS_LOG_INFO (ss.str ());
 
+  // In sweep mode, the scenario built above is shared by the worker processes
+  if (!m_sweepFileName.empty () && !ForkSweepRuns ())
+    {
+      NS_LOG_INFO ("Sweep runs finished, " << m_sweepFailedRuns << " failed");
+    }
+
   return m_satHelper;
 }
 
@@ -1225,12 +1263,358 @@ void SimulationHelper::RunSimulation ()
   NS_LOG_INFO ("  Number of end users: " << m_satHelper->GetUtUsers ().GetN());
   NS_LOG_INFO ("  ");
 
+  if (m_sweepRunsFinished)
+    {
+      // the sweep points have been simulated by the worker processes
+      NS_LOG_INFO ("Sweep runs finished, not running the simulation");
+      Simulator::Destroy ();
+      return;
+    }
+
   Simulator::Stop (m_simTime);
   Simulator::Run ();
 
   Simulator::Destroy ();
 }
 
+void
+SimulationHelper::EnableSweepRuns (std::string sweepFileName, uint32_t maxParallelRuns)
+{
+  NS_LOG_FUNCTION (this << sweepFileName << maxParallelRuns);
+
+  m_sweepFileName = sweepFileName;
+  m_sweepMaxParallelRuns = maxParallelRuns;
+}
+
+void
+SimulationHelper::ReadSweepFile (std::string fileName, std::vector<SweepPoint_t> &sweepPoints) const
+{
+  NS_LOG_FUNCTION (this << fileName);
+
+  std::ifstream *ifs = new std::ifstream (fileName.c_str (), std::ifstream::in);
+
+  if (!ifs->is_open ())
+    {
+      // try the examples folder like with the input XML files
+      delete ifs;
+      fileName = Singleton<SatEnvVariables>::Get ()->LocateDirectory ("contrib/satellite/examples") + "/" + fileName;
+      ifs = new std::ifstream (fileName.c_str (), std::ifstream::in);
+
+      if (!ifs->is_open ())
+        {
+          NS_FATAL_ERROR ("The file " << fileName << " is not found.");
+        }
+    }
+
+  std::string line;
+  uint32_t lineNumber = 0;
+
+  while (std::getline (*ifs, line))
+    {
+      lineNumber++;
+
+      std::string::size_type comment = line.find ('#');
+
+      if (comment != std::string::npos)
+        {
+          line.erase (comment);
+        }
+
+      std::istringstream iss (line);
+      std::string token;
+      SweepPoint_t sweepPoint;
+      sweepPoint.m_line = lineNumber;
+
+      while (iss >> token)
+        {
+          std::string::size_type separator = token.find ('=');
+
+          if (separator == std::string::npos || separator == 0)
+            {
+              NS_FATAL_ERROR ("Invalid sweep override " << token << " on line " << lineNumber << " of " << fileName << ", expected name=value");
+            }
+
+          sweepPoint.m_overrides.push_back (std::make_pair (token.substr (0, separator), token.substr (separator + 1)));
+        }
+
+      if (!sweepPoint.m_overrides.empty ())
+        {
+          sweepPoints.push_back (sweepPoint);
+        }
+    }
+
+  ifs->close ();
+  delete ifs;
+}
+
+bool
+SimulationHelper::ForkSweepRuns ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::vector<SweepPoint_t> sweepPoints;
+  ReadSweepFile (m_sweepFileName, sweepPoints);
+
+  if (sweepPoints.empty ())
+    {
+      NS_FATAL_ERROR ("No sweep points in " << m_sweepFileName);
+    }
+
+  // Check all overrides before forking, so that a bad sweep file fails
+  // at once instead of in each worker
+  for (std::vector<SweepPoint_t>::const_iterator it = sweepPoints.begin (); it != sweepPoints.end (); ++it)
+    {
+      for (SweepOverrides_t::const_iterator o = it->m_overrides.begin (); o != it->m_overrides.end (); ++o)
+        {
+          if (!CheckSweepOverride (o->first, o->second))
+            {
+              NS_FATAL_ERROR ("Invalid sweep override " << o->first << "=" << o->second
+                              << " on line " << it->m_line << " of " << m_sweepFileName);
+            }
+        }
+    }
+
+  uint32_t maxParallelRuns = m_sweepMaxParallelRuns;
+
+  if (maxParallelRuns == 0)
+    {
+      long processors = sysconf (_SC_NPROCESSORS_ONLN);
+      maxParallelRuns = (processors > 0) ? processors : 1;
+    }
+
+  uint64_t baseRun = RngSeedManager::GetRun ();
+  std::map<pid_t, uint32_t> runningWorkers;
+  std::vector<int> exitStatus (sweepPoints.size (), -1);
+  uint32_t nextIndex = 0;
+
+  NS_LOG_INFO ("Forking " << sweepPoints.size () << " sweep runs, at most " << maxParallelRuns << " at a time");
+
+  while (nextIndex < sweepPoints.size () || !runningWorkers.empty ())
+    {
+      if (nextIndex < sweepPoints.size () && runningWorkers.size () < maxParallelRuns)
+        {
+          // avoid writing the buffered output of this process by the workers
+          std::cout.flush ();
+          std::cerr.flush ();
+          std::fflush (NULL);
+
+          pid_t pid = fork ();
+
+          if (pid < 0)
+            {
+              NS_FATAL_ERROR ("Unable to fork sweep run " << nextIndex);
+            }
+          else if (pid == 0)
+            {
+              SetupSweepRun (nextIndex, baseRun + nextIndex, sweepPoints[nextIndex]);
+              return true;
+            }
+
+          runningWorkers[pid] = nextIndex++;
+          continue;
+        }
+
+      int status = 0;
+      pid_t pid = waitpid (-1, &status, 0);
+
+      if (pid < 0)
+        {
+          NS_FATAL_ERROR ("Unable to wait for the sweep runs");
+        }
+
+      std::map<pid_t, uint32_t>::iterator it = runningWorkers.find (pid);
+
+      if (it != runningWorkers.end ())
+        {
+          exitStatus[it->second] = WIFEXITED (status) ? WEXITSTATUS (status) : -1;
+          NS_LOG_INFO ("Sweep run " << it->second << " finished with status " << exitStatus[it->second]);
+          runningWorkers.erase (it);
+        }
+    }
+
+  // Summary of the sweep runs
+  std::string summaryFileName = m_outputPath + "/sweep-runs.txt";
+  std::ofstream summary (summaryFileName.c_str (), std::ofstream::out | std::ofstream::trunc);
+  m_sweepFailedRuns = 0;
+
+  for (uint32_t i = 0; i < sweepPoints.size (); i++)
+    {
+      summary << i << " " << exitStatus[i];
+
+      for (SweepOverrides_t::const_iterator it = sweepPoints[i].m_overrides.begin (); it != sweepPoints[i].m_overrides.end (); ++it)
+        {
+          summary << " " << it->first << "=" << it->second;
+        }
+
+      summary << std::endl;
+
+      if (exitStatus[i] != 0)
+        {
+          m_sweepFailedRuns++;
+        }
+    }
+
+  summary.close ();
+
+  NS_LOG_INFO ("All sweep runs finished, " << m_sweepFailedRuns << " failed, summary in " << summaryFileName);
+
+  m_sweepRunsFinished = true;
+
+  return false;
+}
+
+bool
+SimulationHelper::CheckSweepOverride (std::string name, std::string value) const
+{
+  NS_LOG_FUNCTION (this << name << value);
+
+  TypeId::AttributeInformation info;
+
+  if (name[0] == '/')
+    {
+      std::string::size_type separator = name.rfind ('/');
+
+      if (separator + 1 == name.size ())
+        {
+          return false;
+        }
+
+      Config::MatchContainer matches = Config::LookupMatches (name.substr (0, separator));
+
+      if (matches.GetN () == 0)
+        {
+          return false;
+        }
+
+      for (Config::MatchContainer::Iterator it = matches.Begin (); it != matches.End (); ++it)
+        {
+          if (!(*it)->GetInstanceTypeId ().LookupAttributeByName (name.substr (separator + 1), &info)
+              || !(info.flags & TypeId::ATTR_SET)
+              || !info.checker->CreateValidValue (StringValue (value)))
+            {
+              return false;
+            }
+        }
+
+      return true;
+    }
+
+  std::string::size_type separator = name.rfind ("::");
+
+  if (separator != std::string::npos)
+    {
+      TypeId tid;
+
+      return (TypeId::LookupByNameFailSafe (name.substr (0, separator), &tid)
+              && tid.LookupAttributeByName (name.substr (separator + 2), &info)
+              && (info.flags & TypeId::ATTR_CONSTRUCT)
+              && info.checker->CreateValidValue (StringValue (value)));
+    }
+
+  if (GetInstanceTypeId ().LookupAttributeByName (name, &info))
+    {
+      return ((info.flags & TypeId::ATTR_SET)
+              && info.checker->CreateValidValue (StringValue (value)));
+    }
+
+  for (GlobalValue::Iterator it = GlobalValue::Begin (); it != GlobalValue::End (); ++it)
+    {
+      if ((*it)->GetName () == name)
+        {
+          return ((*it)->GetChecker ()->CreateValidValue (StringValue (value)) != 0);
+        }
+    }
+
+  return false;
+}
+
+void
+SimulationHelper::SetupSweepRun (uint32_t index, uint64_t run, const SweepPoint_t &sweepPoint)
+{
+  NS_LOG_FUNCTION (this << index << run);
+
+  m_sweepRunIndex = index;
+
+  // Separate output folder for each sweep point
+  std::stringstream ss;
+  ss << m_outputPath << "/sweep-" << index << "/";
+  m_outputPath = ss.str ();
+
+  if (!Singleton<SatEnvVariables>::Get ()->IsValidDirectory (m_outputPath))
+    {
+      Singleton<SatEnvVariables>::Get ()->CreateDirectory (m_outputPath);
+    }
+
+  Singleton<SatEnvVariables>::Get ()->SetOutputPath (m_outputPath);
+
+  RngSeedManager::SetRun (run);
+
+  for (SweepOverrides_t::const_iterator it = sweepPoint.m_overrides.begin (); it != sweepPoint.m_overrides.end (); ++it)
+    {
+      bool applied = false;
+
+      if (it->first[0] == '/')
+        {
+          applied = SetConfigPathFailSafe (it->first, StringValue (it->second));
+        }
+      else if (it->first.find ("::") != std::string::npos)
+        {
+          applied = Config::SetDefaultFailSafe (it->first, StringValue (it->second));
+        }
+      else
+        {
+          applied = SetAttributeFailSafe (it->first, StringValue (it->second))
+            || GlobalValue::BindFailSafe (it->first, StringValue (it->second));
+        }
+
+      if (!applied)
+        {
+          NS_FATAL_ERROR ("Unable to set sweep override " << it->first << "=" << it->second
+                          << " on line " << sweepPoint.m_line << " of " << m_sweepFileName);
+        }
+    }
+
+  // The random variables of the scenario were seeded with the run number of
+  // the forking process, reseed them with the run of this sweep point (which
+  // may have been overridden above)
+  int64_t streams = m_satHelper->AssignStreams (0);
+
+  NS_LOG_INFO ("Sweep run " << index << " using RNG run " << RngSeedManager::GetRun ()
+               << " for " << streams << " streams, output path " << m_outputPath);
+}
+
+bool
+SimulationHelper::SetConfigPathFailSafe (std::string path, const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << path);
+
+  std::string::size_type separator = path.rfind ('/');
+
+  if (separator == std::string::npos || separator + 1 == path.size ())
+    {
+      return false;
+    }
+
+  Config::MatchContainer matches = Config::LookupMatches (path.substr (0, separator));
+
+  if (matches.GetN () == 0)
+    {
+      return false;
+    }
+
+  std::string attributeName = path.substr (separator + 1);
+
+  for (Config::MatchContainer::Iterator it = matches.Begin (); it != matches.End (); ++it)
+    {
+      if (!(*it)->SetAttributeFailSafe (attributeName, value))
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
 void
 SimulationHelper::EnableProgressLogs ()
 {
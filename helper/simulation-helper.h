@@ -22,6 +22,8 @@
 #define SIMULATION_HELPER_H
 
 #include <set>
+#include <vector>
+#include <utility>
 #include <ns3/random-variable-stream.h>
 #include <ns3/command-line.h>
 #include <ns3/satellite-helper.h>
@@ -272,7 +274,9 @@ public:
                       double errorRate = 0.0);
 
   /**
-   * \brief Set simulation interference model.
+   * \brief Set simulation interference model of the forward and return links.
+   * The beam matrix interference model is supported only in the forward
+   * link, and it is rejected with a fatal error.
    * \param ifModel Interference model.
    * \param constantIf Static interference if constant interference model used
    */
@@ -310,6 +314,62 @@ public:
    */
   void RunSimulation ();
 
+  /**
+   * \brief Enable sweep runs from a sweep file. CreateSatScenario builds the
+   * scenario once and then forks one worker process per sweep point, at most
+   * maxParallelRuns at a time. In the worker processes CreateSatScenario
+   * returns with the sweep point applied. In the calling process it returns
+   * after all workers have finished, HasFinishedSweepRuns returns true and
+   * RunSimulation does not run the simulation again.
+   *
+   * Each non-empty line of the sweep file is one sweep point consisting of
+   * whitespace separated name=value overrides, and '#' starts a comment:
+   * - "/Config/Path/Attribute=value" sets an attribute of the objects of the
+   *   scenario,
+   * - "ns3::Class::Attribute=value" sets an attribute default value, which
+   *   affects only the objects created after CreateSatScenario (e.g.
+   *   applications and statistics),
+   * - other names set an attribute of this helper (e.g. SimTime) or a global
+   *   value (e.g. RngRun).
+   * All overrides are checked before forking, and a fatal error names the
+   * line of the sweep file, if an override matches no attribute or its
+   * value is invalid.
+   *
+   * Worker i uses RNG run number RngRun + i, unless overridden, and writes
+   * its output to sweep-i under the output path. The exit status of the
+   * workers is stored into sweep-runs.txt in the output path.
+   *
+   * The random variables of the satellite devices, the fading and the
+   * Internet stacks of the scenario are assigned fixed streams in each
+   * worker (see SatHelper::AssignStreams), so they draw the numbers of the
+   * run of the sweep point. Values already drawn while building the
+   * scenario (e.g. UT positions) are shared by all sweep points.
+   *
+   * \param sweepFileName Sweep file name
+   * \param maxParallelRuns Maximum number of concurrent workers, 0 for the
+   *        number of processors
+   */
+  void EnableSweepRuns (std::string sweepFileName, uint32_t maxParallelRuns = 0);
+
+  /**
+   * \brief Get the index of the sweep point simulated by this process.
+   * \return Sweep point index, or -1 if sweep runs are not in use
+   */
+  inline int32_t GetSweepRunIndex () const { return m_sweepRunIndex; };
+
+  /**
+   * \brief Check if all sweep runs have been simulated by the worker
+   * processes, i.e. this is the process that forked them.
+   * \return True after the worker processes have finished
+   */
+  inline bool HasFinishedSweepRuns () const { return m_sweepRunsFinished; };
+
+  /**
+   * \brief Get the number of sweep runs which did not exit successfully.
+   * \return Number of failed sweep runs
+   */
+  inline uint32_t GetFailedSweepRunCount () const { return m_sweepFailedRuns; };
+
   /**
    * \brief Create the satellite scenario.
    * \return satHelper Satellite helper, which provides e.g. nodes for application installation.
@@ -529,6 +589,61 @@ protected:
    */
   void SetupOutputPath ();
 
+  /**
+   * \brief Attribute overrides as name-value pairs.
+   */
+  typedef std::vector<std::pair<std::string, std::string> > SweepOverrides_t;
+
+  /**
+   * \brief Attribute overrides of one sweep point.
+   */
+  typedef struct
+  {
+    uint32_t m_line;                ///< Line of the sweep point in the sweep file
+    SweepOverrides_t m_overrides;   ///< Attribute overrides of the sweep point
+  } SweepPoint_t;
+
+  /**
+   * \brief Read the sweep points from a sweep file.
+   * \param fileName Sweep file name
+   * \param sweepPoints Container to store the sweep points
+   */
+  void ReadSweepFile (std::string fileName, std::vector<SweepPoint_t> &sweepPoints) const;
+
+  /**
+   * \brief Check that a sweep override names an existing attribute or
+   * global value and that the value is valid for it, without setting it.
+   * \param name Name of the override
+   * \param value Value of the override
+   * \return True if the override can be applied
+   */
+  bool CheckSweepOverride (std::string name, std::string value) const;
+
+  /**
+   * \brief Fork the worker processes of the sweep points and wait for them
+   * to finish.
+   * \return True in the worker processes, false in the forking process
+   */
+  bool ForkSweepRuns ();
+
+  /**
+   * \brief Set up the output path, RNG run number and attribute overrides
+   * of a sweep point in a worker process.
+   * \param index Sweep point index
+   * \param run RNG run number of the sweep point
+   * \param sweepPoint Attribute overrides of the sweep point
+   */
+  void SetupSweepRun (uint32_t index, uint64_t run, const SweepPoint_t &sweepPoint);
+
+  /**
+   * \brief Set an attribute of all objects matching a config path.
+   * \param path Config path ending with the attribute name
+   * \param value Attribute value
+   * \return True if the path matched objects and the attribute was set
+   *         to all of them
+   */
+  bool SetConfigPathFailSafe (std::string path, const AttributeValue &value) const;
+
 private:
 
   Ptr<SatHelper> m_satHelper;
@@ -550,6 +665,12 @@ private:
   bool                         m_inputFileUtPositionsCheckBeams;
   uint32_t                     m_gwUserId;
 
+  std::string                  m_sweepFileName;
+  uint32_t                     m_sweepMaxParallelRuns;
+  int32_t                      m_sweepRunIndex;
+  bool                         m_sweepRunsFinished;
+  uint32_t                     m_sweepFailedRuns;
+
   bool                         m_progressLoggingEnabled;
   Time 												 m_progressUpdateInterval;
   EventId                      m_progressReportEvent;
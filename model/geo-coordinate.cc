@@ -104,17 +104,23 @@ GeoCoordinate::Construct (double latitude, double longitude, double altitude)
   m_altitude = altitude;
 }
 
-Vector GeoCoordinate::ToVector ()
+Vector GeoCoordinate::ToVector () const
 {
   NS_LOG_FUNCTION (this);
 
   Vector cartesian;
+
   double latRads = SatUtils::DegreesToRadians (m_latitude);
   double lonRads = SatUtils::DegreesToRadians (m_longitude);
 
-  cartesian.x = ( GetRadiusCurvature (latRads) + m_altitude) * std::cos (latRads) * std::cos (lonRads);
-  cartesian.y = ( GetRadiusCurvature (latRads) + m_altitude) * std::cos (latRads) * std::sin (lonRads);
-  cartesian.z = ( GetRadiusCurvature (latRads) * (1 - m_e2Param) + m_altitude) * std::sin (latRads);
+  // sine and cosine of the latitude are needed twice, so calculate them only once
+  double sinLat = std::sin (latRads);
+  double cosLat = std::cos (latRads);
+  double rCurvature = m_equatorRadius / std::sqrt (1 - m_e2Param * sinLat * sinLat);
+
+  cartesian.x = ( rCurvature + m_altitude) * cosLat * std::cos (lonRads);
+  cartesian.y = ( rCurvature + m_altitude) * cosLat * std::sin (lonRads);
+  cartesian.z = ( rCurvature * (1 - m_e2Param) + m_altitude) * sinLat;
 
   return cartesian;
 }
@@ -207,65 +213,61 @@ void GeoCoordinate::ConstructFromVector (const Vector &v)
 
   Initialize ();
 
+  // distance from the position point (P) to the earth axis
+  double p = std::sqrt ( v.x * v.x + v.y * v.y );
+
   // distance from the position point (P) to earth center point (origin O)
-  double op = std::sqrt ( v.x * v.x + v.y * v.y + v.z * v.z );
+  double op = std::sqrt ( p * p + v.z * v.z );
 
   if ( op > 0 )
     {
-      // longitude calculation
-      double lon = std::atan (v.y / v.x);
-
-      // scale longitude between - PI and PI (-180 and 180 in degrees)
+      // longitude between -180 and 180 degrees
       if ( v.x != 0 || v.y != 0 )
         {
-          m_longitude = SatUtils::RadiansToDegrees (std::atan (v.y / v.x ));
+          m_longitude = SatUtils::RadiansToDegrees (std::atan2 (v.y, v.x));
 
-          if ( v.x < 0 )
+          // west end of the range is used on the date line
+          if ( v.x < 0 && v.y == 0 )
             {
-              if ( v.y > 0)
-                {
-                  m_longitude = 180 + m_longitude;
-                  lon = lon - M_PI;
-                }
-              else
-                {
-                  m_longitude = -180 + m_longitude;
-                  lon = M_PI + lon;
-                }
+              m_longitude = -180;
             }
         }
 
       // Geocentric latitude
-      double latG = std::atan (v.z / (std::sqrt ( v.x * v.x + v.y * v.y )));
+      double latG = std::atan2 (v.z, p);
 
       // Geocentric latitude (of point Q, Q is intersection point of segment OP and reference ellipsoid)
-      double latQ = std::atan (v.z / ( (1 - m_e2Param ) * (std::sqrt ( v.x * v.x + v.y * v.y ))) );
+      double latQ = std::atan2 (v.z, (1 - m_e2Param ) * p);
+      double sinLatQ = std::sin (latQ);
+      double cosLatQ = std::cos (latQ);
 
       // calculate radius of the curvature
-      double rCurvature = GetRadiusCurvature (latQ);
+      double rCurvature = m_equatorRadius / std::sqrt (1 - m_e2Param * sinLatQ * sinLatQ);
 
-      // x, y, z of point Q
-      double xQ = rCurvature * std::cos (latQ) * std::cos (lon);
-      double yQ = rCurvature * std::cos (latQ) * std::sin (lon);
-      double zQ = rCurvature * (1 - m_e2Param) * std::sin (latQ);
+      // distance of point Q from the earth axis and z of point Q
+      double pQ = rCurvature * cosLatQ;
+      double zQ = rCurvature * (1 - m_e2Param) * sinLatQ;
 
       // distance OQ
-      double oq = std::sqrt ( xQ * xQ + yQ * yQ + zQ * zQ );
+      double oq = std::sqrt ( pQ * pQ + zQ * zQ );
 
       // distance PQ is OP - OQ
       double pq = op - oq;
 
       // length of the normal segment from point P of line (PO) to point T.
       // T is intersection point of linen the PO normal and ellipsoid normal from point Q.
-      double tp = pq * std::sin (latG - latQ);
+      double latDelta = latG - latQ;
+      double tp = pq * std::sin (latDelta);
+      double cosLatDelta = std::cos (latDelta);
 
-      m_latitude = SatUtils::RadiansToDegrees (latQ + tp / op * std::cos (latQ - latG));
+      m_latitude = SatUtils::RadiansToDegrees (latQ + tp / op * cosLatDelta);
 
-      m_altitude = pq * std::cos (latQ - latG);
+      m_altitude = pq * cosLatDelta;
     }
 }
+
 double
-GeoCoordinate::GetRadiusCurvature (double latitude)
+GeoCoordinate::GetRadiusCurvature (double latitude) const
 {
   return ( m_equatorRadius / std::sqrt (1 - m_e2Param * std::sin (latitude) * std::sin (latitude)) );
 }
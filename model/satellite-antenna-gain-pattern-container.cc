@@ -92,9 +92,10 @@ SatAntennaGainPatternContainer::GetBestBeamId (GeoCoordinate coord) const
   double bestGain (-100.0);
   uint32_t bestId (0);
 
-  for (uint32_t i = 1; i <= NUMBER_OF_BEAMS; ++i)
+  // the beams are iterated in beam id order, so the lowest id wins the ties
+  for (gpIterator it = m_antennaPatternMap.begin (); it != m_antennaPatternMap.end (); ++it)
     {
-      double gain = m_antennaPatternMap.at (i)->GetAntennaGain_lin (coord);
+      double gain = it->second->GetAntennaGain_lin (coord);
 
       // The antenna pattern has returned a NAN gain. This means
       // that this position is not valid. Return 0, which is not a valid beam id.
@@ -105,7 +106,7 @@ SatAntennaGainPatternContainer::GetBestBeamId (GeoCoordinate coord) const
       else if (gain > bestGain)
         {
           bestGain = gain;
-          bestId = i;
+          bestId = it->first;
         }
     }
 
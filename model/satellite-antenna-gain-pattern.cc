@@ -19,6 +19,8 @@
  */
 
 #include <algorithm>
+#include <limits>
+#include <set>
 #include <stdlib.h>
 #include "ns3/double.h"
 #include "ns3/log.h"
@@ -59,6 +61,7 @@ SatAntennaGainPattern::GetInstanceTypeId (void) const
 SatAntennaGainPattern::SatAntennaGainPattern ()
   : m_antennaPattern (),
     m_validPositions (),
+    m_validGridSquares (),
     m_minAcceptableAntennaGainInDb (40.0),
     m_uniformRandomVariable (),
     m_latitudes (),
@@ -175,17 +178,20 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
           m_longitudes.push_back (lon);
         }
 
+      // The gain is stored in linear format, NaN stays NaN in the conversion
+      double gainLin = SatUtils::DbToLinear (gainDouble);
+
       // If this is the first gain entry
       if (rowVector.empty ())
         {
           m_minLat = lat;
           m_minLon = lon;
-          rowVector.push_back (gainDouble);
+          rowVector.push_back (gainLin);
         }
       // We are still in the same row (= latitude)
       else if (lat == m_maxLat)
         {
-          rowVector.push_back (gainDouble);
+          rowVector.push_back (gainLin);
         }
       // Latitude changed
       // - Store the vector
@@ -195,7 +201,7 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
         {
           m_antennaPattern.push_back (rowVector);
           rowVector.clear ();
-          rowVector.push_back (gainDouble);
+          rowVector.push_back (gainLin);
         }
 
       // Update the maximum values
@@ -215,6 +221,23 @@ void SatAntennaGainPattern::ReadAntennaPatternFromFile (std::string filePathName
 
   ifs->close ();
   delete ifs;
+
+  // Mark the valid positions, whose grid square has valid positions in the
+  // other three corners too. The corners are searched with the same exact
+  // coordinates as they were searched earlier at every random positioning.
+  std::set< std::pair<double, double> > validPositionSet (m_validPositions.begin (), m_validPositions.end ());
+
+  m_validGridSquares.resize (m_validPositions.size (), false);
+
+  for (uint32_t i = 0; i < m_validPositions.size (); ++i)
+    {
+      double lat = m_validPositions[i].first;
+      double lon = m_validPositions[i].second;
+
+      m_validGridSquares[i] = ( validPositionSet.count (std::make_pair (lat + m_latInterval, lon)) > 0 )
+        && ( validPositionSet.count (std::make_pair (lat + m_latInterval, lon + m_lonInterval)) > 0 )
+        && ( validPositionSet.count (std::make_pair (lat, lon + m_lonInterval)) > 0 );
+    }
 }
 
 
@@ -226,53 +249,54 @@ GeoCoordinate SatAntennaGainPattern::GetValidRandomPosition () const
   uint32_t ind (0);
   std::pair<double, double> lowerLeftCoord;
 
-  while (1)
+  // Get random position (=lower left corner of a grid) from the valid ones,
+  // until a position whose three other corners for interpolation are found
+  // is drawn.
+  do
     {
-      // Get random position (=lower left corner of a grid) from the valid ones
       ind = m_uniformRandomVariable->GetInteger (0, numPosGridPoints - 1);
-      lowerLeftCoord = m_validPositions[ind];
+    }
+  while (!m_validGridSquares[ind]);
 
-      // Test if the three other corners for interpolation are found.
-      // If they do not, loop again to find another position.
+  lowerLeftCoord = m_validPositions[ind];
 
-      std::pair<double, double> testPos;
+  // Pick a random position within a grid square
+  double latOffset = m_uniformRandomVariable->GetValue (0.0, m_latInterval - 0.001);
+  double lonOffset = m_uniformRandomVariable->GetValue (0.0, m_lonInterval - 0.001);
+  GeoCoordinate coord (lowerLeftCoord.first + latOffset, lowerLeftCoord.second + lonOffset, 0.0);
 
-      // Upper left corner
-      testPos.first = lowerLeftCoord.first + m_latInterval;
-      testPos.second = lowerLeftCoord.second;
-      if (find (m_validPositions.begin (), m_validPositions.end (), testPos) == m_validPositions.end ())
-        {
-          continue;
-        }
+  return coord;
+}
 
-      // Upper right corner
-      testPos.second = lowerLeftCoord.second + m_lonInterval;
-      if (find (m_validPositions.begin (), m_validPositions.end (), testPos) == m_validPositions.end ())
-        {
-          continue;
-        }
 
-      // Lower right corner
-      testPos.first = lowerLeftCoord.first;
-      if (find (m_validPositions.begin (), m_validPositions.end (), testPos) == m_validPositions.end ())
+GeoCoordinate SatAntennaGainPattern::GetCenterPosition () const
+{
+  NS_LOG_FUNCTION (this);
+
+  double maxGain = -std::numeric_limits<double>::infinity ();
+  uint32_t maxLatIndex (0);
+  uint32_t maxLonIndex (0);
+
+  for (uint32_t i = 0; i < m_antennaPattern.size (); ++i)
+    {
+      for (uint32_t j = 0; j < m_antennaPattern[i].size (); ++j)
         {
-          continue;
+          if (!std::isnan (m_antennaPattern[i][j]) && m_antennaPattern[i][j] > maxGain)
+            {
+              maxGain = m_antennaPattern[i][j];
+              maxLatIndex = i;
+              maxLonIndex = j;
+            }
         }
-
-      // None of the previous checks triggered, thus we have a valid position.
-      break;
     }
 
-  // Pick a random position within a grid square
-  double latOffset = m_uniformRandomVariable->GetValue (0.0, m_latInterval - 0.001);
-  double lonOffset = m_uniformRandomVariable->GetValue (0.0, m_lonInterval - 0.001);
-  GeoCoordinate coord (lowerLeftCoord.first + latOffset, lowerLeftCoord.second + lonOffset, 0.0);
+  GeoCoordinate coord (m_minLat + maxLatIndex * m_latInterval, m_minLon + maxLonIndex * m_lonInterval, 0.0);
 
   return coord;
 }
 
 
-double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
+double SatAntennaGainPattern::GetAntennaGain_lin (const GeoCoordinate &coord) const
 {
   NS_LOG_FUNCTION (this << coord.GetLatitude () << coord.GetLongitude ());
 
@@ -315,11 +339,11 @@ double SatAntennaGainPattern::GetAntennaGain_lin (GeoCoordinate coord) const
   double upperLonShare = (m_longitudes[minLonIndex + 1] - longitude) / m_lonInterval;
   double lowerLonShare = (longitude - m_longitudes[minLonIndex]) / m_lonInterval;
 
-  // Change the gains to linear values , because the interpolation is done in linear domain.
-  double G11 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex][minLonIndex] );
-  double G12 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex][minLonIndex + 1] );
-  double G21 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex + 1][minLonIndex] );
-  double G22 = SatUtils::DbToLinear ( m_antennaPattern[minLatIndex + 1][minLonIndex + 1] );
+  // The gains are stored as linear values, because the interpolation is done in linear domain.
+  double G11 = m_antennaPattern[minLatIndex][minLonIndex];
+  double G12 = m_antennaPattern[minLatIndex][minLonIndex + 1];
+  double G21 = m_antennaPattern[minLatIndex + 1][minLonIndex];
+  double G22 = m_antennaPattern[minLatIndex + 1][minLonIndex + 1];
 
   // Longitude direction with latitude minLatIndex
   double valLatLower = upperLonShare * G11 + lowerLonShare * G12;
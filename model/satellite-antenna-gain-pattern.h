@@ -40,10 +40,13 @@ namespace ns3 {
  *
  * Antenna gain patter is used also for spot-beam selection. In initialization phase
  * a valid positions list is constructed based on a minimum accepted antenna gain set
- * as an attribute. This approach is selected to speed up the random UT positioning.
+ * as an attribute, and each valid position is marked whether the grid square starting
+ * from it has valid positions in all its corners. This approach is selected to speed
+ * up the random UT positioning.
  *
  * Antenna gain value for a given longitude and latitude position is calculated by
- * using 4-point bilinear interpolation.
+ * using 4-point bilinear interpolation. The gains are converted to linear format
+ * already when the pattern is read, since the interpolation is done in linear domain.
  */
 class SatAntennaGainPattern : public Object
 {
@@ -79,7 +82,7 @@ public:
    * \brief Calculate the antenna gain value for a certain {latitude, longitude} point
    * \return The gain value in linear format
    */
-  double GetAntennaGain_lin (GeoCoordinate coord) const;
+  double GetAntennaGain_lin (const GeoCoordinate &coord) const;
 
   /**
    * \brief Get a valid random position under this spot-beam coverage.
@@ -87,6 +90,13 @@ public:
    */
   GeoCoordinate GetValidRandomPosition () const;
 
+  /**
+   * \brief Get the position of the maximum antenna gain of this spot-beam,
+   * i.e. the grid point with the highest gain value.
+   * \return GeoCoordinate of the beam center
+   */
+  GeoCoordinate GetCenterPosition () const;
+
 private:
   /**
    * \brief Read the antenna gain pattern from a file
@@ -95,7 +105,7 @@ private:
   void ReadAntennaPatternFromFile (std::string filePathName);
 
   /**
-   * Container for the antenna pattern from one spot-beam
+   * Container for the antenna pattern from one spot-beam in linear format
    * - Outer vector holds gain values for all latitudes
    * - Inner vector holds gain values for all longitudes for a certain latitude
    */
@@ -108,6 +118,13 @@ private:
    */
   std::vector< std::pair<double, double> > m_validPositions;
 
+  /**
+   * Flags by valid position index telling whether the other three corners
+   * of the grid square starting from the valid position are valid positions,
+   * i.e. whether a random position can be drawn from the grid square.
+   */
+  std::vector<bool> m_validGridSquares;
+
   /**
    * Minimum acceptable antenna gain for a serving spot-beam. Used
    * for beam selection.
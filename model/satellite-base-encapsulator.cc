@@ -192,6 +192,14 @@ SatBaseEncapsulator::GetTxBufferSizeInBytes () const
   return m_txQueue->GetNBytes ();
 }
 
+bool
+SatBaseEncapsulator::HasUnacknowledgedData () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return false;
+}
+
 Time
 SatBaseEncapsulator::GetHolDelay () const
 {
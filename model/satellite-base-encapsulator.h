@@ -158,6 +158,14 @@ public:
    */
   virtual uint32_t GetTxBufferSizeInBytes () const;
 
+  /**
+   * Check whether this encapsulator has transmitted data waiting for
+   * an acknowledgement, which may be moved back to the transmission
+   * buffer without a new packet being enqueued.
+   * \return bool true if there is unacknowledged data
+   */
+  virtual bool HasUnacknowledgedData () const;
+
   /**
    * Get Head-of-Line packet buffering delay.
    * \return Time HoL buffering delay
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#include "satellite-base-output-trace-container.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatBaseOutputTraceContainer");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBaseOutputTraceContainer);
+
+TypeId
+SatBaseOutputTraceContainer::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatBaseOutputTraceContainer")
+    .SetParent<SatBaseTraceContainer> ();
+  return tid;
+}
+
+TypeId
+SatBaseOutputTraceContainer::GetInstanceTypeId (void) const
+{
+  NS_LOG_FUNCTION (this);
+
+  return GetTypeId ();
+}
+
+SatBaseOutputTraceContainer::SatBaseOutputTraceContainer (uint32_t valuesInRow)
+  : m_enableFigureOutput (true),
+    m_valuesInRow (valuesInRow),
+    m_resetCount (0)
+{
+  NS_LOG_FUNCTION (this << valuesInRow);
+}
+
+SatBaseOutputTraceContainer::~SatBaseOutputTraceContainer ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatBaseOutputTraceContainer::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_container.empty ())
+    {
+      WriteToFile ();
+
+      m_container.clear ();
+    }
+  m_enableFigureOutput = true;
+
+  // the writers kept by the users are not valid anymore
+  m_resetCount++;
+}
+
+Ptr<SatOutputFileStreamDoubleContainer>
+SatBaseOutputTraceContainer::FindNode (key_t key)
+{
+  NS_LOG_FUNCTION (this);
+
+  container_t::iterator iter = m_container.find (key);
+
+  if (iter == m_container.end ())
+    {
+      return AddNode (key);
+    }
+
+  return iter->second;
+}
+
+Ptr<SatOutputFileStreamDoubleContainer>
+SatBaseOutputTraceContainer::GetWriter (key_t key)
+{
+  NS_LOG_FUNCTION (this);
+
+  return FindNode (key);
+}
+
+void
+SatBaseOutputTraceContainer::AddToContainer (key_t key, const std::vector<double> &newItem)
+{
+  NS_LOG_FUNCTION (this);
+
+  AddToContainer (key, newItem.data (), newItem.size ());
+}
+
+void
+SatBaseOutputTraceContainer::AddToContainer (key_t key, const double *newItem, uint32_t size)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (size != m_valuesInRow)
+    {
+      NS_FATAL_ERROR ("SatBaseOutputTraceContainer::AddToContainer - Incorrect vector size");
+    }
+
+  Ptr<SatOutputFileStreamDoubleContainer> node = GetWriter (key);
+
+  if (node != NULL)
+    {
+      node->AddToContainer (newItem, size);
+    }
+}
+
+SatOutputTraceWriterCache::SatOutputTraceWriterCache ()
+  : m_resetCount (0)
+{
+}
+
+Ptr<SatOutputFileStreamDoubleContainer>
+SatOutputTraceWriterCache::GetWriter (SatBaseOutputTraceContainer *container,
+                                      SatBaseOutputTraceContainer::key_t key)
+{
+  // the reset of the trace container releases the writers
+  if (m_resetCount != container->GetResetCount ())
+    {
+      m_writers.clear ();
+      m_resetCount = container->GetResetCount ();
+    }
+
+  SatBaseOutputTraceContainer::container_t::iterator iter = m_writers.find (key);
+
+  if (iter == m_writers.end ())
+    {
+      iter = m_writers.insert (std::make_pair (key, container->GetWriter (key))).first;
+    }
+
+  return iter->second;
+}
+
+void
+SatOutputTraceWriterCache::Clear ()
+{
+  m_writers.clear ();
+}
+
+} // namespace ns3
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef SATELLITE_BASE_OUTPUT_TRACE_CONTAINER_H
+#define SATELLITE_BASE_OUTPUT_TRACE_CONTAINER_H
+
+#include <map>
+#include <vector>
+#include "satellite-base-trace-container.h"
+#include "ns3/satellite-output-fstream-double-container.h"
+#include "satellite-enums.h"
+#include "ns3/address.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Base class for the output trace containers, which store the samples
+ * of each (address, channel type) key into an output file stream container
+ * of its own, i.e. a writer of the key, and write them into files when the
+ * trace container is reset.
+ */
+class SatBaseOutputTraceContainer : public SatBaseTraceContainer
+{
+public:
+  /**
+   * \brief typedef for map key
+   */
+  typedef std::pair<Address,SatEnums::ChannelType_t> key_t;
+
+  /**
+   * \brief typedef for map of containers
+   */
+  typedef std::map <key_t, Ptr<SatOutputFileStreamDoubleContainer> > container_t;
+
+  /**
+   * \brief Constructor
+   * \param valuesInRow number of values in a sample
+   */
+  SatBaseOutputTraceContainer (uint32_t valuesInRow);
+
+  /**
+   * \brief Destructor
+   */
+  virtual ~SatBaseOutputTraceContainer ();
+
+  /**
+   * \brief NS-3 type id function
+   * \return type id
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief NS-3 instance type id function
+   * \return Instance type is
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * \brief Get the writer of the container matching the key. The writer is
+   * created, when the key is requested for the first time, and it is used
+   * until the trace container is reset. A user keeping the writer shall get
+   * it again, when the reset count of the trace container has changed.
+   * \param key key
+   * \return writer of the key, or NULL if the key is not mapped to a UT or GW
+   */
+  Ptr<SatOutputFileStreamDoubleContainer> GetWriter (key_t key);
+
+  /**
+   * \brief Get the number of times the trace container has been reset, i.e.
+   * the writers got earlier have been replaced.
+   * \return reset count
+   */
+  uint32_t GetResetCount () const
+  {
+    return m_resetCount;
+  }
+
+  /**
+   * \brief Add the vector containing the values to container matching the key
+   * \param key key
+   * \param newItem vector of values
+   */
+  void AddToContainer (key_t key, const std::vector<double> &newItem);
+
+  /**
+   * \brief Add the values to container matching the key
+   * \param key key
+   * \param newItem array of values
+   * \param size number of values
+   */
+  void AddToContainer (key_t key, const double *newItem, uint32_t size);
+
+  /**
+   * Function for enabling / disabling figure output
+   * \param enableFigureOutput
+   */
+  void EnableFigureOutput (bool enableFigureOutput)
+  {
+    m_enableFigureOutput = enableFigureOutput;
+  }
+
+  /**
+   * \brief Function for resetting the variables. The stored samples are
+   * written into the files and the writers are released.
+   */
+  void Reset ();
+
+protected:
+  /**
+   * \brief Function for adding the node to the map
+   * \param key key
+   * \return pointer to the added container
+   */
+  virtual Ptr<SatOutputFileStreamDoubleContainer> AddNode (key_t key) = 0;
+
+  /**
+   * \brief Write the contents of the containers into files
+   */
+  virtual void WriteToFile () = 0;
+
+  /**
+   * \brief Map for containers
+   */
+  container_t m_container;
+
+  /**
+   * \brief Switch for figure output
+   */
+  bool m_enableFigureOutput;
+
+private:
+  /**
+   * \brief Function for finding the container matching the key
+   * \param key key
+   * \return matching container
+   */
+  Ptr<SatOutputFileStreamDoubleContainer> FindNode (key_t key);
+
+  /**
+   * \brief Number of values in a sample
+   */
+  uint32_t m_valuesInRow;
+
+  /**
+   * \brief Number of resets
+   */
+  uint32_t m_resetCount;
+};
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Writers of an output trace container kept by a user, which traces
+ * the samples of several keys. A writer is got from the trace container
+ * when its key is traced for the first time and again after the trace
+ * container has been reset.
+ */
+class SatOutputTraceWriterCache
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  SatOutputTraceWriterCache ();
+
+  /**
+   * \brief Get the writer of the key
+   * \param container trace container of the writers
+   * \param key key
+   * \return writer of the key, or NULL if the key is not mapped to a UT or GW
+   */
+  Ptr<SatOutputFileStreamDoubleContainer> GetWriter (SatBaseOutputTraceContainer *container,
+                                                     SatBaseOutputTraceContainer::key_t key);
+
+  /**
+   * \brief Release the kept writers
+   */
+  void Clear ();
+
+private:
+  /**
+   * \brief Kept writers by their keys
+   */
+  SatBaseOutputTraceContainer::container_t m_writers;
+
+  /**
+   * \brief Reset count of the trace container when the writers were got
+   */
+  uint32_t m_resetCount;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_BASE_OUTPUT_TRACE_CONTAINER_H */
@@ -0,0 +1,263 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "satellite-constant-position-mobility-model.h"
+#include "satellite-beam-interference-matrix.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatBeamInterferenceMatrix");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBeamInterferenceMatrix);
+
+TypeId
+SatBeamInterferenceMatrix::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatBeamInterferenceMatrix")
+    .SetParent<Object> ()
+    .AddAttribute ("ActivityHistory",
+                   "Length of the kept transmission activity history. Shall be longer than the "
+                   "propagation delay from the satellite to the UTs added with the longest transmission duration.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&SatBeamInterferenceMatrix::m_activityHistory),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+SatBeamInterferenceMatrix::SatBeamInterferenceMatrix ()
+  : m_delayModel (),
+    m_satMobility (),
+    m_activityHistory (Seconds (1.0))
+{
+  NS_LOG_FUNCTION (this);
+
+  // this constructor should not be used
+  NS_FATAL_ERROR ("SatBeamInterferenceMatrix::SatBeamInterferenceMatrix - Constructor not in use");
+}
+
+SatBeamInterferenceMatrix::SatBeamInterferenceMatrix (Ptr<PropagationDelayModel> delayModel, Ptr<MobilityModel> satMobility)
+  : m_delayModel (delayModel),
+    m_satMobility (satMobility),
+    m_activityHistory (Seconds (1.0))
+{
+  NS_LOG_FUNCTION (this << delayModel << satMobility);
+}
+
+SatBeamInterferenceMatrix::~SatBeamInterferenceMatrix ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatBeamInterferenceMatrix::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_delayModel = NULL;
+  m_satMobility = NULL;
+  m_beamIndexes.clear ();
+  m_gainPatterns.clear ();
+  m_referencePositions.clear ();
+  m_referenceDelays.clear ();
+  m_interferenceGains.clear ();
+  m_activities.clear ();
+
+  Object::DoDispose ();
+}
+
+void
+SatBeamInterferenceMatrix::AddBeam (uint32_t beamId, Ptr<SatAntennaGainPattern> gainPattern)
+{
+  NS_LOG_FUNCTION (this << beamId << gainPattern);
+
+  uint32_t index = m_gainPatterns.size ();
+
+  std::pair<std::map<uint32_t, uint32_t>::iterator, bool> result = m_beamIndexes.insert (std::make_pair (beamId, index));
+
+  if (!result.second)
+    {
+      NS_FATAL_ERROR ("SatBeamInterferenceMatrix::AddBeam - beam " << beamId << " already added");
+    }
+
+  GeoCoordinate referencePosition = gainPattern->GetCenterPosition ();
+
+  Ptr<SatConstantPositionMobilityModel> referenceMobility = CreateObject<SatConstantPositionMobilityModel> ();
+  referenceMobility->SetGeoPosition (referencePosition);
+
+  m_gainPatterns.push_back (gainPattern);
+  m_referencePositions.push_back (referencePosition);
+  m_referenceDelays.push_back (m_delayModel->GetDelay (m_satMobility, referenceMobility));
+  m_activities.push_back (std::vector<TxActivities_t> ());
+
+  double ownGain = gainPattern->GetAntennaGain_lin (referencePosition);
+
+  // interference gains from the earlier beams to the new beam
+  std::vector<double> gains (index + 1, 0.0);
+
+  for (uint32_t i = 0; i < index; ++i)
+    {
+      gains[i] = m_gainPatterns[i]->GetAntennaGain_lin (referencePosition) / ownGain;
+    }
+
+  m_interferenceGains.push_back (gains);
+
+  // interference gains from the new beam to the earlier beams
+  for (uint32_t i = 0; i < index; ++i)
+    {
+      double gain = gainPattern->GetAntennaGain_lin (m_referencePositions[i])
+        / m_gainPatterns[i]->GetAntennaGain_lin (m_referencePositions[i]);
+
+      m_interferenceGains[i].push_back (gain);
+    }
+
+  NS_LOG_INFO ("Beam " << beamId << " added, reference position: " << referencePosition
+                       << ", delay: " << m_referenceDelays.back ().GetSeconds () << "s");
+}
+
+bool
+SatBeamInterferenceMatrix::HasBeam (uint32_t beamId) const
+{
+  return (m_beamIndexes.find (beamId) != m_beamIndexes.end ());
+}
+
+double
+SatBeamInterferenceMatrix::GetInterferenceGain (uint32_t rxBeamId, uint32_t txBeamId) const
+{
+  NS_LOG_FUNCTION (this << rxBeamId << txBeamId);
+
+  return m_interferenceGains[GetBeamIndex (rxBeamId)][GetBeamIndex (txBeamId)];
+}
+
+Time
+SatBeamInterferenceMatrix::GetReferenceDelay (uint32_t beamId) const
+{
+  NS_LOG_FUNCTION (this << beamId);
+
+  return m_referenceDelays[GetBeamIndex (beamId)];
+}
+
+void
+SatBeamInterferenceMatrix::NotifyTx (uint32_t beamId, uint32_t carrierId, Time duration, double txPower_W, Time endDelay)
+{
+  NS_LOG_FUNCTION (this << beamId << carrierId << duration << txPower_W << endDelay);
+
+  std::vector<TxActivities_t> &beamActivities = m_activities[GetBeamIndex (beamId)];
+
+  if (carrierId >= beamActivities.size ())
+    {
+      beamActivities.resize (carrierId + 1);
+    }
+
+  TxActivities_t &activities = beamActivities[carrierId];
+
+  Time now = Simulator::Now ();
+
+  TxActivity_t activity;
+  activity.m_start = now + endDelay - duration;
+  activity.m_end = now + endDelay;
+  activity.m_txPower_W = txPower_W;
+
+  activities.push_back (activity);
+
+  // remove the activities older than the history
+  while (!activities.empty () && activities.front ().m_end < now - m_activityHistory)
+    {
+      activities.pop_front ();
+    }
+}
+
+double
+SatBeamInterferenceMatrix::GetInterferenceToCarrierRatio (uint32_t rxBeamId, uint32_t carrierId, Time start, Time end) const
+{
+  NS_LOG_FUNCTION (this << rxBeamId << carrierId << start << end);
+
+  uint32_t rxIndex = GetBeamIndex (rxBeamId);
+
+  if (carrierId >= m_activities[rxIndex].size ())
+    {
+      return 0.0;
+    }
+
+  double carrierPower = GetMeanTxPower (m_activities[rxIndex][carrierId], start, end);
+
+  if (carrierPower <= 0.0)
+    {
+      return 0.0;
+    }
+
+  double interferencePower = 0.0;
+
+  for (uint32_t i = 0; i < m_activities.size (); ++i)
+    {
+      if (i != rxIndex && carrierId < m_activities[i].size ())
+        {
+          interferencePower += m_interferenceGains[rxIndex][i] * GetMeanTxPower (m_activities[i][carrierId], start, end);
+        }
+    }
+
+  return interferencePower / carrierPower;
+}
+
+uint32_t
+SatBeamInterferenceMatrix::GetBeamIndex (uint32_t beamId) const
+{
+  std::map<uint32_t, uint32_t>::const_iterator it = m_beamIndexes.find (beamId);
+
+  if (it == m_beamIndexes.end ())
+    {
+      NS_FATAL_ERROR ("SatBeamInterferenceMatrix::GetBeamIndex - beam " << beamId << " not added");
+    }
+
+  return it->second;
+}
+
+double
+SatBeamInterferenceMatrix::GetMeanTxPower (const TxActivities_t &activities, Time start, Time end) const
+{
+  double duration = (end - start).GetDouble ();
+
+  if (duration <= 0.0)
+    {
+      return 0.0;
+    }
+
+  double energy = 0.0;
+
+  // the activities of a beam and carrier do not overlap and are in time order,
+  // so only the latest activities can overlap with the period
+  for (TxActivities_t::const_reverse_iterator it = activities.rbegin ();
+       it != activities.rend () && it->m_end > start; ++it)
+    {
+      Time overlapStart = std::max (it->m_start, start);
+      Time overlapEnd = std::min (it->m_end, end);
+
+      if (overlapEnd > overlapStart)
+        {
+          energy += (overlapEnd - overlapStart).GetDouble () * it->m_txPower_W;
+        }
+    }
+
+  return energy / duration;
+}
+
+} // namespace ns3
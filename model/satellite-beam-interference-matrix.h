@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BEAM_INTERFERENCE_MATRIX_H
+#define SATELLITE_BEAM_INTERFERENCE_MATRIX_H
+
+#include <map>
+#include <vector>
+#include <deque>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/mobility-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "geo-coordinate.h"
+#include "satellite-antenna-gain-pattern.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Co-channel interference matrix between the beams of one forward user
+ * link channel, i.e. between the beams using the same user link frequency.
+ *
+ * When a beam is added, its reference position (the maximum gain position of
+ * its antenna pattern) is solved, and the interference gain between the new beam
+ * and the beams added earlier is calculated in both directions from the antenna
+ * patterns. The interference gain from beam B to beam A is the gain of beam B
+ * divided by the gain of beam A at the reference position of beam A.
+ *
+ * The channel notifies the matrix of every transmission, and the matrix keeps
+ * the transmission activity of each beam and carrier for a configurable
+ * history. The interference-to-carrier ratio of a reception is then calculated
+ * analytically from the interference gains and the mean transmit powers of the
+ * co-channel beams during the reception, so that the interfering transmissions
+ * need not to be delivered to the receivers of the other beams at all.
+ */
+class SatBeamInterferenceMatrix : public Object
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Default constructor, not used
+   */
+  SatBeamInterferenceMatrix ();
+
+  /**
+   * \brief Constructor
+   * \param delayModel Propagation delay model of the channel
+   * \param satMobility Mobility of the satellite
+   */
+  SatBeamInterferenceMatrix (Ptr<PropagationDelayModel> delayModel, Ptr<MobilityModel> satMobility);
+
+  /**
+   * \brief Destructor
+   */
+  ~SatBeamInterferenceMatrix ();
+
+  /**
+   * \brief Dispose of this class instance
+   */
+  virtual void DoDispose ();
+
+  /**
+   * \brief Add a beam to the matrix and calculate its interference gains
+   * to and from the beams added earlier.
+   * \param beamId Beam identifier
+   * \param gainPattern Antenna gain pattern of the beam
+   */
+  void AddBeam (uint32_t beamId, Ptr<SatAntennaGainPattern> gainPattern);
+
+  /**
+   * \brief Check whether a beam has been added to the matrix
+   * \param beamId Beam identifier
+   * \return true, if the beam is in the matrix
+   */
+  bool HasBeam (uint32_t beamId) const;
+
+  /**
+   * \brief Get the interference gain from a beam to another beam
+   * \param rxBeamId Beam identifier of the interfered beam
+   * \param txBeamId Beam identifier of the interfering beam
+   * \return Interference gain in linear format
+   */
+  double GetInterferenceGain (uint32_t rxBeamId, uint32_t txBeamId) const;
+
+  /**
+   * \brief Get the propagation delay from the satellite to the reference
+   * position of a beam.
+   * \param beamId Beam identifier
+   * \return Propagation delay
+   */
+  Time GetReferenceDelay (uint32_t beamId) const;
+
+  /**
+   * \brief Notify the matrix of a transmission in the channel.
+   *
+   * Similarly to the receptions of the forward user link (see
+   * SatChannel::ScheduleRx), the transmission is considered to end at the
+   * current time, i.e. it is stored to occupy the time period from the current
+   * time minus the duration to the current time.
+   *
+   * \param beamId Beam identifier of the transmission
+   * \param carrierId Carrier identifier of the transmission
+   * \param duration Duration of the transmission
+   * \param txPower_W Transmit power of the transmission
+   * \param endDelay Delay from the current time to the end of the transmission,
+   * used when the transmission is notified in advance (see SatChannel bent pipe mode)
+   */
+  void NotifyTx (uint32_t beamId, uint32_t carrierId, Time duration, double txPower_W, Time endDelay = Seconds (0));
+
+  /**
+   * \brief Calculate the interference-to-carrier ratio of a reception.
+   * \param rxBeamId Beam identifier of the reception
+   * \param carrierId Carrier identifier of the reception
+   * \param start Start time of the reception in the time of NotifyTx
+   * \param end End time of the reception in the time of NotifyTx
+   * \return Interference-to-carrier ratio in linear format
+   */
+  double GetInterferenceToCarrierRatio (uint32_t rxBeamId, uint32_t carrierId, Time start, Time end) const;
+
+private:
+  /**
+   * \brief Transmission activity of a beam and carrier
+   */
+  typedef struct
+  {
+    Time m_start;
+    Time m_end;
+    double m_txPower_W;
+  } TxActivity_t;
+
+  /**
+   * \brief Transmissions of a beam and carrier in time order
+   */
+  typedef std::deque<TxActivity_t> TxActivities_t;
+
+  /**
+   * \brief Get the index of a beam in the matrix
+   * \param beamId Beam identifier
+   * \return Index of the beam
+   */
+  uint32_t GetBeamIndex (uint32_t beamId) const;
+
+  /**
+   * \brief Calculate the mean transmit power of a beam and carrier over a time period
+   * \param activities Transmissions of the beam and carrier
+   * \param start Start time of the period
+   * \param end End time of the period
+   * \return Mean transmit power in Watts
+   */
+  double GetMeanTxPower (const TxActivities_t &activities, Time start, Time end) const;
+
+  /**
+   * \brief Propagation delay model of the channel
+   */
+  Ptr<PropagationDelayModel> m_delayModel;
+
+  /**
+   * \brief Mobility of the satellite
+   */
+  Ptr<MobilityModel> m_satMobility;
+
+  /**
+   * \brief Length of the kept transmission activity history
+   */
+  Time m_activityHistory;
+
+  /**
+   * \brief Indexes of the beams by beam identifiers
+   */
+  std::map<uint32_t, uint32_t> m_beamIndexes;
+
+  /**
+   * \brief Antenna gain patterns of the beams
+   */
+  std::vector<Ptr<SatAntennaGainPattern> > m_gainPatterns;
+
+  /**
+   * \brief Reference positions of the beams
+   */
+  std::vector<GeoCoordinate> m_referencePositions;
+
+  /**
+   * \brief Propagation delays to the reference positions of the beams
+   */
+  std::vector<Time> m_referenceDelays;
+
+  /**
+   * \brief Interference gains by interfered and interfering beam index
+   */
+  std::vector<std::vector<double> > m_interferenceGains;
+
+  /**
+   * \brief Transmission activities by beam index and carrier
+   */
+  std::vector<std::vector<TxActivities_t> > m_activities;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_BEAM_INTERFERENCE_MATRIX_H */
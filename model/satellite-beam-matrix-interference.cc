@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <limits>
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/singleton.h"
+#include "satellite-beam-matrix-interference.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatBeamMatrixInterference");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatBeamMatrixInterference);
+
+TypeId
+SatBeamMatrixInterference::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatBeamMatrixInterference")
+    .SetParent<SatInterference> ();
+
+  return tid;
+}
+
+TypeId
+SatBeamMatrixInterference::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+SatBeamMatrixInterference::SatBeamMatrixInterference (Ptr<SatBeamInterferenceMatrix> matrix, uint32_t carrierId)
+  : m_matrix (matrix),
+    m_beamId (0),
+    m_carrierId (carrierId),
+    m_enableTraceOutput (false),
+    m_channelType (),
+    m_rxBandwidth_Hz ()
+{
+  NS_LOG_FUNCTION (this << matrix << carrierId);
+
+  if (m_matrix == NULL)
+    {
+      NS_FATAL_ERROR ("SatBeamMatrixInterference::SatBeamMatrixInterference - Beam interference matrix not set");
+    }
+}
+
+SatBeamMatrixInterference::SatBeamMatrixInterference (Ptr<SatBeamInterferenceMatrix> matrix, uint32_t carrierId,
+                                                      SatEnums::ChannelType_t channelType, double rxBandwidthHz)
+  : m_matrix (matrix),
+    m_beamId (0),
+    m_carrierId (carrierId),
+    m_enableTraceOutput (true),
+    m_channelType (channelType),
+    m_rxBandwidth_Hz (rxBandwidthHz)
+{
+  NS_LOG_FUNCTION (this << matrix << carrierId << channelType << rxBandwidthHz);
+
+  if (m_matrix == NULL)
+    {
+      NS_FATAL_ERROR ("SatBeamMatrixInterference::SatBeamMatrixInterference - Beam interference matrix not set");
+    }
+
+  if (m_rxBandwidth_Hz <= std::numeric_limits<double>::epsilon ())
+    {
+      NS_FATAL_ERROR ("SatBeamMatrixInterference::SatBeamMatrixInterference - Invalid value");
+    }
+}
+
+SatBeamMatrixInterference::SatBeamMatrixInterference ()
+  : m_matrix (),
+    m_beamId (0),
+    m_carrierId (0),
+    m_enableTraceOutput (false),
+    m_channelType (),
+    m_rxBandwidth_Hz ()
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_FATAL_ERROR ("SatBeamMatrixInterference::SatBeamMatrixInterference - Constructor not in use");
+}
+
+SatBeamMatrixInterference::~SatBeamMatrixInterference ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Reset ();
+}
+
+void
+SatBeamMatrixInterference::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_matrix = NULL;
+  m_traceWriters.Clear ();
+
+  SatInterference::DoDispose ();
+}
+
+void
+SatBeamMatrixInterference::SetBeamId (uint32_t beamId)
+{
+  NS_LOG_FUNCTION (this << beamId);
+
+  m_beamId = beamId;
+}
+
+Ptr<SatInterference::InterferenceChangeEvent>
+SatBeamMatrixInterference::DoAdd (Time duration, double power, Address rxAddress)
+{
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << power << rxAddress);
+
+  Ptr<SatInterference::InterferenceChangeEvent> event;
+  event = Create<SatInterference::InterferenceChangeEvent> (0, duration, power, rxAddress);
+
+  return event;
+}
+
+double
+SatBeamMatrixInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+
+  // The matrix stores the transmissions in the time of the satellite, thus
+  // the reception is moved back by the propagation delay of the beam.
+  Time delay = m_matrix->GetReferenceDelay (m_beamId);
+
+  double ciRatio = m_matrix->GetInterferenceToCarrierRatio (m_beamId,
+                                                            m_carrierId,
+                                                            event->GetStartTime () - delay,
+                                                            event->GetEndTime () - delay);
+
+  NS_LOG_INFO ("Beam: " << m_beamId << ", carrier: " << m_carrierId << ", I/C: " << ciRatio);
+
+  double ifPowerW = ciRatio * event->GetRxPower ();
+
+  if (m_enableTraceOutput)
+    {
+      Ptr<SatOutputFileStreamDoubleContainer> writer = m_traceWriters.GetWriter (Singleton<SatInterferenceOutputTraceContainer>::Get (),
+                                                                                 std::make_pair (event->GetSatEarthStationAddress (), m_channelType));
+
+      if (writer != NULL)
+        {
+          double values[SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS] = { Now ().GetSeconds (), ifPowerW / m_rxBandwidth_Hz };
+          writer->AddToContainer (values, SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS);
+        }
+    }
+
+  return ifPowerW;
+}
+
+void
+SatBeamMatrixInterference::DoReset ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatBeamMatrixInterference::DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatBeamMatrixInterference::DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+}
+// namespace ns3
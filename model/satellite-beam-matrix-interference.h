@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_BEAM_MATRIX_INTERFERENCE_H
+#define SATELLITE_BEAM_MATRIX_INTERFERENCE_H
+
+#include "satellite-interference.h"
+#include "satellite-beam-interference-matrix.h"
+#include "satellite-interference-output-trace-container.h"
+#include "satellite-enums.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief Analytic co-channel interference of the forward user link. The
+ * interference of a reception is calculated from its own Rx power and the
+ * interference-to-carrier ratio given by the beam interference matrix of the
+ * channel, which tracks the transmission activity of all the co-channel beams.
+ * Thus, the transmissions of the other beams are not needed by the receiver.
+ * The ratio is evaluated at the centre of the beam of the receiver, not at
+ * the position of the receiver.
+ */
+class SatBeamMatrixInterference : public SatInterference
+{
+public:
+  /**
+   * Derived from Object
+   * \return TypeId of class
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Derived from Object
+   * \return TypeId of instance
+   */
+  TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * Constructor
+   * \param matrix Beam interference matrix of the channel
+   * \param carrierId Carrier identifier of the receiver
+   */
+  SatBeamMatrixInterference (Ptr<SatBeamInterferenceMatrix> matrix, uint32_t carrierId);
+
+  /**
+   * Constructor with the interference output trace enabled
+   * \param matrix Beam interference matrix of the channel
+   * \param carrierId Carrier identifier of the receiver
+   * \param channelType Channel type of the receiver
+   * \param rxBandwidthHz Rx bandwidth of the carrier in Hz
+   */
+  SatBeamMatrixInterference (Ptr<SatBeamInterferenceMatrix> matrix, uint32_t carrierId,
+                             SatEnums::ChannelType_t channelType, double rxBandwidthHz);
+
+  /**
+   * Default constructor, not used
+   */
+  SatBeamMatrixInterference ();
+
+  /**
+   * Destructor
+   */
+  ~SatBeamMatrixInterference ();
+
+  /**
+   * Dispose of SatBeamMatrixInterference
+   */
+  void DoDispose ();
+
+  /**
+   * Set the beam identifier of the receiver
+   * \param beamId Beam identifier
+   */
+  void SetBeamId (uint32_t beamId);
+
+private:
+  /**
+   * Adds interference power to interference object.
+   * Only the event of the own transmission is created in this implementation.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   * \param rxAddress MAC address.
+   *
+   * \return the pointer to interference event as a reference of the addition
+   */
+  virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd (Time rxDuration, double rxPower, Address rxAddress);
+
+  /**
+   * Calculates interference power for the given reference
+   * from the interference-to-carrier ratio of the beam interference matrix.
+   *
+   * \param event Reference event which for interference is calculated.
+   *
+   * \return Final power value at end of receiving
+   */
+  virtual double DoCalculate (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Resets current interference.
+   */
+  virtual void DoReset (void);
+
+  /**
+   * Notifies that RX is started by a receiver.
+   *
+   * \param event Interference reference event of receiver (ignored in this implementation)
+   */
+  virtual void DoNotifyRxStart (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  /**
+   * Notifies that RX is ended by a receiver.
+   *
+   * \param event Interference reference event of receiver (ignored in this implementation)
+   */
+  virtual void DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  SatBeamMatrixInterference (const SatBeamMatrixInterference &o);
+  SatBeamMatrixInterference &operator = (const SatBeamMatrixInterference &o);
+
+  /**
+   * Beam interference matrix of the channel
+   */
+  Ptr<SatBeamInterferenceMatrix> m_matrix;
+
+  /**
+   * Beam identifier of the receiver
+   */
+  uint32_t m_beamId;
+
+  /**
+   * Carrier identifier of the receiver
+   */
+  uint32_t m_carrierId;
+
+  /**
+   * Is the interference output trace enabled
+   */
+  bool m_enableTraceOutput;
+
+  /**
+   * Interference output trace writers of the traced earth stations
+   */
+  SatOutputTraceWriterCache m_traceWriters;
+
+  /**
+   * Channel type of the receiver
+   */
+  SatEnums::ChannelType_t m_channelType;
+
+  /**
+   * \brief RX Bandwidth in Hz
+   */
+  double m_rxBandwidth_Hz;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_BEAM_MATRIX_INTERFERENCE_H */
@@ -35,7 +35,6 @@
 #include <ns3/mac48-address.h>
 #include <ns3/satellite-superframe-sequence.h>
 #include <ns3/satellite-superframe-allocator.h>
-#include <ns3/satellite-dama-entry.h>
 #include <ns3/satellite-control-message.h>
 #include <ns3/satellite-lower-layer-service.h>
 #include "satellite-beam-scheduler.h"
@@ -45,125 +44,6 @@ NS_LOG_COMPONENT_DEFINE ("SatBeamScheduler");
 
 namespace ns3 {
 
-// UtInfo class declarations for SatBeamScheduler
-SatBeamScheduler::SatUtInfo::SatUtInfo ( Ptr<SatDamaEntry> damaEntry, Ptr<SatCnoEstimator> cnoEstimator, Time controlSlotOffset, bool controlSlotsEnabled )
-  : m_damaEntry (damaEntry),
-    m_cnoEstimator (cnoEstimator),
-    m_controlSlotsEnabled (controlSlotsEnabled)
-{
-  NS_LOG_FUNCTION (this);
-
-  SetControlSlotGenerationTime (controlSlotOffset);
-}
-
-Ptr<SatDamaEntry>
-SatBeamScheduler::SatUtInfo::GetDamaEntry ()
-{
-  NS_LOG_FUNCTION (this);
-
-  return m_damaEntry;
-}
-
-void
-SatBeamScheduler::SatUtInfo::UpdateDamaEntryFromCrs ()
-{
-  NS_LOG_FUNCTION (this);
-
-  // map to sum up RBDC requests per RC
-  std::map<uint8_t, uint16_t> rbdcReqs;
-
-  for ( CrMsgContainer_t::const_iterator crIt = m_crContainer.begin (); crIt != m_crContainer.end (); crIt++ )
-    {
-      SatCrMessage::RequestContainer_t crContent = (*crIt)->GetCapacityRequestContent ();
-
-      for ( SatCrMessage::RequestContainer_t::const_iterator descriptorIt = crContent.begin (); descriptorIt != crContent.end (); descriptorIt++ )
-        {
-          switch (descriptorIt->first.second)
-            {
-            case SatEnums::DA_RBDC:
-              {
-                rbdcReqs[descriptorIt->first.first] += descriptorIt->second;
-                break;
-              }
-
-            case SatEnums::DA_VBDC:
-              {
-                m_damaEntry->ResetVolumeBacklogPersistence ();
-                m_damaEntry->UpdateVbdcInBytes (descriptorIt->first.first, descriptorIt->second);
-                break;
-              }
-
-            case SatEnums::DA_AVBDC:
-              {
-                m_damaEntry->ResetVolumeBacklogPersistence ();
-                m_damaEntry->SetVbdcInBytes (descriptorIt->first.first, descriptorIt->second);
-                break;
-              }
-
-            default:
-              break;
-            }
-        }
-    }
-
-  // update RBDC with summed up requests
-  for (std::map<uint8_t, uint16_t>::iterator it = rbdcReqs.begin (); it != rbdcReqs.end (); it++ )
-    {
-      m_damaEntry->ResetDynamicRatePersistence ();
-      m_damaEntry->UpdateRbdcInKbps (it->first, it->second);
-    }
-
-  // clear container when CRs processed
-  m_crContainer.clear ();
-}
-
-double
-SatBeamScheduler::SatUtInfo::GetCnoEstimation ()
-{
-  NS_LOG_FUNCTION (this);
-
-  return m_cnoEstimator->GetCnoEstimation ();
-}
-
-void
-SatBeamScheduler::SatUtInfo::AddCnoSample (double sample)
-{
-  NS_LOG_FUNCTION (this << sample);
-
-  m_cnoEstimator->AddSample (sample);
-}
-
-void
-SatBeamScheduler::SatUtInfo::AddCrMsg (Ptr<SatCrMessage> crMsg)
-{
-  NS_LOG_FUNCTION (this << crMsg);
-
-  m_crContainer.push_back (crMsg);
-}
-
-bool
-SatBeamScheduler::SatUtInfo::IsControlSlotGenerationTime () const
-{
-  NS_LOG_FUNCTION (this);
-
-  bool isGenerationTime = false;
-
-  if ( m_controlSlotsEnabled && ( m_controlSlotGenerationTime <= Simulator::Now () ) )
-    {
-      isGenerationTime = true;
-    }
-
-  return isGenerationTime;
-}
-
-void
-SatBeamScheduler::SatUtInfo::SetControlSlotGenerationTime (Time offset)
-{
-  NS_LOG_FUNCTION (this);
-
-  m_controlSlotGenerationTime =  Simulator::Now () + offset;
-}
-
 // SatBeamScheduler
 
 NS_OBJECT_ENSURE_REGISTERED (SatBeamScheduler);
@@ -180,7 +60,8 @@ SatBeamScheduler::GetTypeId (void)
                    MakeEnumAccessor (&SatBeamScheduler::m_cnoEstimatorMode),
                    MakeEnumChecker (SatCnoEstimator::LAST, "LastValueInWindow",
                                     SatCnoEstimator::MINIMUM, "MinimumValueInWindow",
-                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow"))
+                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow",
+                                    SatCnoEstimator::EXPONENTIAL_AVERAGE, "ExponentialAverage"))
     .AddAttribute ( "CnoEstimationWindow",
                     "Time window for C/N0 estimation.",
                     TimeValue (MilliSeconds (1000)),
@@ -337,10 +218,16 @@ SatBeamScheduler::AddUt (Address utId, Ptr<SatLowerLayerServiceConf> llsConf)
 {
   NS_LOG_FUNCTION (this << utId);
 
-  Ptr<SatDamaEntry> damaEntry = Create<SatDamaEntry> (llsConf);
+  if (m_utIndexes.find (utId) != m_utIndexes.end ())
+    {
+      NS_FATAL_ERROR ("UT (Address: " << utId << ") already added to Beam scheduler.");
+    }
+
+  uint32_t utIndex = m_damaTable.AddUt (llsConf, CreateCnoEstimator ());
+  m_utIndexes.insert (std::make_pair (utId, utIndex));
 
   // this method call acts as CAC check, if allocation fails fatal error is occurred.
-  m_superframeAllocator->ReserveMinimumRate (damaEntry->GetMinRateBasedBytes (m_superframeAllocator->GetSuperframeDuration ()), m_controlSlotsEnabled);
+  m_superframeAllocator->ReserveMinimumRate (m_damaTable.GetMinRateBasedBytes (utIndex, m_superframeAllocator->GetSuperframeDuration ()), m_controlSlotsEnabled);
 
   Time firstCtrlSlotInterval = m_controlSlotInterval;
 
@@ -352,26 +239,14 @@ SatBeamScheduler::AddUt (Address utId, Ptr<SatLowerLayerServiceConf> llsConf)
       firstCtrlSlotInterval = Time (randomOffset);
     }
 
-  Ptr<SatCnoEstimator> cnoEstimator = CreateCnoEstimator ();
-  Ptr<SatUtInfo> utInfo = Create<SatUtInfo> (damaEntry, cnoEstimator, firstCtrlSlotInterval, m_controlSlotsEnabled);
-
-  std::pair<UtInfoMap_t::iterator, bool > result = m_utInfos.insert (std::make_pair (utId, utInfo));
-
-  if (result.second)
-    {
-      SatFrameAllocator::SatFrameAllocReqItemContainer_t reqContainer (damaEntry->GetRcCount (), SatFrameAllocator::SatFrameAllocReqItem () );
-      SatFrameAllocator::SatFrameAllocReq allocReq (reqContainer);
-      allocReq.m_cno = NAN;
-      allocReq.m_address = utId;
+  m_controlSlotGenerationTimes.push_back (Simulator::Now () + firstCtrlSlotInterval);
 
-      m_utRequestInfos.push_back (std::make_pair (utId, allocReq));
-    }
-  else
-    {
-      NS_FATAL_ERROR ("UT (Address: " << utId << ") already added to Beam scheduler.");
-    }
+  SatFrameAllocator::SatFrameAllocReqItemContainer_t reqContainer (m_damaTable.GetRcCount (utIndex), SatFrameAllocator::SatFrameAllocReqItem () );
+  SatFrameAllocator::SatFrameAllocReq allocReq (reqContainer);
+  allocReq.m_cno = NAN;
+  allocReq.m_address = utId;
 
-  m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetRaChannelCount ();
+  m_utRequestInfos.push_back (std::make_pair (utIndex, allocReq));
 
   // return random RA channel index for the UT.
   return m_raChRandomIndex->GetInteger ();
@@ -383,10 +258,10 @@ SatBeamScheduler::UpdateUtCno (Address utId, double cno)
   NS_LOG_FUNCTION (this << utId << cno);
 
   // check that UT is added to this scheduler.
-  UtInfoMap_t::iterator result = m_utInfos.find (utId);
-  NS_ASSERT (result != m_utInfos.end ());
+  UtIndexMap_t::const_iterator result = m_utIndexes.find (utId);
+  NS_ASSERT (result != m_utIndexes.end ());
 
-  m_utInfos[utId]->AddCnoSample (cno);
+  m_damaTable.AddCnoSample (result->second, cno);
 }
 
 void
@@ -395,12 +270,13 @@ SatBeamScheduler::UtCrReceived (Address utId, Ptr<SatCrMessage> crMsg)
   NS_LOG_FUNCTION (this << utId << crMsg);
 
   // check that UT is added to this scheduler.
-  UtInfoMap_t::iterator result = m_utInfos.find (utId);
-  NS_ASSERT (result != m_utInfos.end ());
+  UtIndexMap_t::const_iterator result = m_utIndexes.find (utId);
+  NS_ASSERT (result != m_utIndexes.end ());
 
   NS_LOG_INFO ("SatBeamScheduler::UtCrReceived - UT: " << utId << " @ " << Now ().GetSeconds ());
 
-  m_utInfos[utId]->AddCrMsg (crMsg);
+  // the CR is decoded to the DAMA table right away, RBDC requests are applied in the next scheduling round
+  m_damaTable.ReceiveCr (result->second, crMsg->GetCapacityRequestContent ());
 }
 
 Ptr<SatCnoEstimator>
@@ -415,6 +291,7 @@ SatBeamScheduler::CreateCnoEstimator ()
     case SatCnoEstimator::LAST:
     case SatCnoEstimator::MINIMUM:
     case SatCnoEstimator::AVERAGE:
+    case SatCnoEstimator::EXPONENTIAL_AVERAGE:
       estimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
       break;
 
@@ -436,7 +313,7 @@ SatBeamScheduler::Schedule ()
   uint32_t offeredKbpsSum (0);
 
   // check that there is UTs to schedule
-  if ( m_utInfos.size () > 0 )
+  if ( m_damaTable.GetUtCount () > 0 )
     {
       requestedKbpsSum = UpdateDamaEntriesWithReqs ();
 
@@ -505,7 +382,7 @@ SatBeamScheduler::AddRaChannels (std::vector <Ptr<SatTbtpMessage> >& tbtpContain
     {
       uint8_t frameId = superFrameConf->GetRaChannelFrameId (i);
       Ptr<SatFrameConf> frameConf = superFrameConf->GetFrameConf (frameId);
-      uint16_t timeSlotCount = frameConf->GetTimeSlotCount () / frameConf->GetCarrierCount ();
+      uint16_t timeSlotCount = frameConf->GetCarrierTimeSlotCount ();
 
       // In case of carrier belong to same frame than previous we don't need to check
       // size for frame info when adding slot to TBTP, so it is set to 0.
@@ -523,6 +400,7 @@ SatBeamScheduler::AddRaChannels (std::vector <Ptr<SatTbtpMessage> >& tbtpContain
             {
               Ptr<SatTbtpMessage> newTbtp = CreateObject<SatTbtpMessage> (tbtpToFill->GetSuperframeSeqId ());
               newTbtp->SetSuperframeCounter ( tbtpToFill->GetSuperframeCounter ());
+              newTbtp->SetTimeSlotArena (tbtpToFill->GetTimeSlotArena ());
 
               tbtpContainer.push_back (newTbtp);
 
@@ -541,34 +419,36 @@ SatBeamScheduler::UpdateDamaEntriesWithReqs ()
 
   uint32_t requestedCraRbdcKbps (0);
 
-  for (UtReqInfoContainer_t::iterator it = m_utRequestInfos.begin (); it != m_utRequestInfos.end (); it++)
-    {
-      // estimation of the C/N0 is done when scheduling UT
+  // process RBDC requests of the received CRs
+  m_damaTable.UpdateRbdcFromCrs ();
 
-      Ptr<SatDamaEntry> damaEntry = m_utInfos.at (it->first)->GetDamaEntry ();
+  double superFrameDurationInSeconds = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetDuration ().GetSeconds ();
 
-      // process received CRs
-      m_utInfos.at (it->first)->UpdateDamaEntryFromCrs ();
+  for (UtReqInfoContainer_t::iterator it = m_utRequestInfos.begin (); it != m_utRequestInfos.end (); it++)
+    {
+      uint32_t utIndex = it->first;
 
       // update allocation request information to be used later to request capacity from frame allocator
-      it->second.m_cno = m_utInfos.at (it->first)->GetCnoEstimation ();
+      it->second.m_cno = m_damaTable.GetCnoEstimation (utIndex);
 
       // set control slot generation on or off
-      it->second.m_generateCtrlSlot = m_utInfos.at (it->first)->IsControlSlotGenerationTime ();
+      it->second.m_generateCtrlSlot = m_controlSlotsEnabled && ( m_controlSlotGenerationTimes[utIndex] <= Simulator::Now () );
 
-      for (uint8_t i = 0; i < damaEntry->GetRcCount (); i++ )
+      for (uint8_t i = 0; i < m_damaTable.GetRcCount (utIndex); i++ )
         {
-          double superFrameDurationInSeconds = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetDuration ().GetSeconds ();
+          uint16_t craInKbps = m_damaTable.GetCraInKbps (utIndex, i);
+          uint16_t rbdcInKbps = m_damaTable.GetRbdcInKbps (utIndex, i);
+          uint32_t vbdcInBytes = m_damaTable.GetVbdcInBytes (utIndex, i);
 
-          it->second.m_reqPerRc[i].m_craBytes = (SatConstVariables::BITS_IN_KBIT * damaEntry->GetCraInKbps (i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
-          it->second.m_reqPerRc[i].m_rbdcBytes = (SatConstVariables::BITS_IN_KBIT * damaEntry->GetRbdcInKbps (i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
-          it->second.m_reqPerRc[i].m_vbdcBytes = damaEntry->GetVbdcInBytes (i);
+          it->second.m_reqPerRc[i].m_craBytes = (SatConstVariables::BITS_IN_KBIT * craInKbps * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
+          it->second.m_reqPerRc[i].m_rbdcBytes = (SatConstVariables::BITS_IN_KBIT * rbdcInKbps * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
+          it->second.m_reqPerRc[i].m_vbdcBytes = vbdcInBytes;
 
           // Collect the requested rate for all UTs per beam
-          requestedCraRbdcKbps += damaEntry->GetCraInKbps (i);
-          requestedCraRbdcKbps += damaEntry->GetRbdcInKbps (i);
+          requestedCraRbdcKbps += craInKbps;
+          requestedCraRbdcKbps += rbdcInKbps;
 
-          uint16_t minRbdcCraDeltaRateInKbps = std::max (0, damaEntry->GetMinRbdcInKbps (i) - damaEntry->GetCraInKbps (i));
+          uint16_t minRbdcCraDeltaRateInKbps = std::max (0, m_damaTable.GetMinRbdcInKbps (utIndex, i) - craInKbps);
           it->second.m_reqPerRc[i].m_minRbdcBytes = (SatConstVariables::BITS_IN_KBIT * minRbdcCraDeltaRateInKbps  * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
 
           // if UT is not requesting any RBDC for this RC then set minimum RBDC 0
@@ -580,23 +460,21 @@ SatBeamScheduler::UpdateDamaEntriesWithReqs ()
 
           NS_ASSERT ((it->second.m_reqPerRc[i].m_minRbdcBytes <= it->second.m_reqPerRc[i].m_rbdcBytes));
 
-          //it->second.m_reqPerRc[i].m_rbdcBytes = std::max(it->second.m_reqPerRc[i].m_minRbdcBytes, it->second.m_reqPerRc[i].m_rbdcBytes);
-
           // write backlog requests traces starts ...
           std::stringstream head;
           head << Now ().GetSeconds () << ", ";
           head << m_beamId << ", ";
-          head << Singleton<SatIdMapper>::Get ()->GetUtIdWithMac (it->first) << ", ";
+          head << Singleton<SatIdMapper>::Get ()->GetUtIdWithMac (it->second.m_address) << ", ";
 
           std::stringstream rbdcTail;
           rbdcTail << SatEnums::DA_RBDC << ", ";
-          rbdcTail << damaEntry->GetRbdcInKbps (i);
+          rbdcTail << rbdcInKbps;
 
           m_backlogRequestsTrace ( head.str () + rbdcTail.str () );
 
           std::stringstream vbdcTail;
           vbdcTail << SatEnums::DA_VBDC << ", ";
-          vbdcTail << damaEntry->GetVbdcInBytes (i);
+          vbdcTail << vbdcInBytes;
 
           m_backlogRequestsTrace ( head.str () + vbdcTail.str () );
           // ... write backlog requests traces ends
@@ -610,10 +488,10 @@ void SatBeamScheduler::DoPreResourceAllocation ()
 {
   NS_LOG_FUNCTION (this);
 
-  if ( m_utInfos.size () > 0 )
+  if ( m_damaTable.GetUtCount () > 0 )
     {
       // sort UT requests according to C/N0 of the UTs
-      m_utRequestInfos.sort (CnoCompare (m_utInfos));
+      m_utRequestInfos.sort (CnoCompare ());
 
       SatFrameAllocator::SatFrameAllocContainer_t allocReqs;
 
@@ -634,25 +512,25 @@ SatBeamScheduler::UpdateDamaEntriesWithAllocs (SatFrameAllocator::UtAllocInfoCon
 
   uint32_t offeredCraRbdcKbps (0);
 
+  double superFrameDurationInSeconds = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetDuration ().GetSeconds ();
+
   for (UtReqInfoContainer_t::iterator it = m_utRequestInfos.begin (); it != m_utRequestInfos.end (); it++)
     {
-      Ptr<SatDamaEntry> damaEntry = m_utInfos.at (it->first)->GetDamaEntry ();
-      SatFrameAllocator::UtAllocInfoContainer_t::const_iterator allocInfo = utAllocContainer.find (it->first);
+      uint32_t utIndex = it->first;
+      SatFrameAllocator::UtAllocInfoContainer_t::const_iterator allocInfo = utAllocContainer.find (it->second.m_address);
 
       if ( allocInfo != utAllocContainer.end ())
         {
           // update time to send next control slot, if control slot is allocated
           if ( allocInfo->second.second )
             {
-              m_utInfos.at (allocInfo->first)->SetControlSlotGenerationTime (m_controlSlotInterval);
+              m_controlSlotGenerationTimes[utIndex] = Simulator::Now () + m_controlSlotInterval;
             }
 
-          double superFrameDurationInSeconds = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE)->GetDuration ().GetSeconds ();
-
           for (uint32_t i = 0; i < allocInfo->second.first.size (); i++ )
             {
-              uint32_t rateBasedBytes = (SatConstVariables::BITS_IN_KBIT * damaEntry->GetCraInKbps (i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
-              rateBasedBytes += (SatConstVariables::BITS_IN_KBIT * damaEntry->GetRbdcInKbps (i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
+              uint32_t rateBasedBytes = (SatConstVariables::BITS_IN_KBIT * m_damaTable.GetCraInKbps (utIndex, i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
+              rateBasedBytes += (SatConstVariables::BITS_IN_KBIT * m_damaTable.GetRbdcInKbps (utIndex, i) * superFrameDurationInSeconds ) / (double)(SatConstVariables::BITS_PER_BYTE);
 
               offeredCraRbdcKbps += (uint32_t)((allocInfo->second.first[i] * (double)(SatConstVariables::BITS_PER_BYTE) / superFrameDurationInSeconds / (double)(SatConstVariables::BITS_IN_KBIT)) + 0.5);
 
@@ -664,7 +542,7 @@ SatBeamScheduler::UpdateDamaEntriesWithAllocs (SatFrameAllocator::UtAllocInfoCon
               if ( rateBasedBytes < allocInfo->second.first[i] )
                 {
                   // Requested VBDC
-                  uint32_t vbdcBytes = damaEntry->GetVbdcInBytes (i);
+                  uint32_t vbdcBytes = m_damaTable.GetVbdcInBytes (utIndex, i);
 
                   NS_LOG_INFO ("UT: " << allocInfo->first << " RC index: " << i <<" requested VBDC bytes: " << vbdcBytes);
 
@@ -680,7 +558,7 @@ SatBeamScheduler::UpdateDamaEntriesWithAllocs (SatFrameAllocator::UtAllocInfoCon
                                     " VBDC allocation: " << allocVbdcBytes <<
                                     " remaining VBDC bytes: " << remainingVbdcBytes);
 
-                      damaEntry->SetVbdcInBytes (i, remainingVbdcBytes);
+                      m_damaTable.SetVbdcInBytes (utIndex, i, remainingVbdcBytes);
                     }
                   // Allocated more or equal to requested bytes
                   else
@@ -689,15 +567,16 @@ SatBeamScheduler::UpdateDamaEntriesWithAllocs (SatFrameAllocator::UtAllocInfoCon
                                     " VBDC allocation: " << allocVbdcBytes <<
                                     " remaining VBDC bytes: " << 0);
 
-                      damaEntry->SetVbdcInBytes (i, 0);
+                      m_damaTable.SetVbdcInBytes (utIndex, i, 0);
                     }
                 }
             }
         }
-      // decrease persistence values
-      damaEntry->DecrementDynamicRatePersistence ();
-      damaEntry->DecrementVolumeBacklogPersistence ();
     }
+
+  // decrease persistence values
+  m_damaTable.DecrementPersistences ();
+
   return offeredCraRbdcKbps;
 }
 
@@ -25,13 +25,13 @@
 #include <list>
 #include <map>
 #include <ns3/object.h>
-#include <ns3/simple-ref-count.h>
 #include <ns3/ptr.h>
 #include <ns3/callback.h>
 #include <ns3/nstime.h>
 #include <ns3/traced-callback.h>
 #include <ns3/satellite-cno-estimator.h>
 #include <ns3/satellite-frame-allocator.h>
+#include <ns3/satellite-dama-table.h>
 
 namespace ns3 {
 
@@ -42,7 +42,6 @@ class SatTbtpMessage;
 class SatSuperframeSeq;
 class SatSuperframeAllocator;
 class SatLowerLayerServiceConf;
-class SatDamaEntry;
 
 
 /**
@@ -53,10 +52,10 @@ class SatDamaEntry;
  * It's is created and used by NCC.
  *
  * The scheduling process is briefly:
- *   - SatDamaEntry/CR update
+ *   - DAMA table/CR update
  *   - Preliminary resource allocation
  *   - Time slot generation
- *   - SatDamaEntry update
+ *   - DAMA table update
  *   - TBTP signaling (generation)
  *    - Schedule next scheduling time for the next SF
  *
@@ -187,112 +186,15 @@ public:
 
 private:
   /**
-   * \brief UT information helper class for SatBeamScheduler.
-   *
-   * Stores capacity request and C/N0 estimation information of the UT.
+   * Pair to store capacity request information for the UT, the first member
+   * is the index of the UT in the DAMA table.
    */
-  class SatUtInfo : public SimpleRefCount<SatUtInfo>
-  {
-public:
-    /**
-     * Construct SatUtInfo.
-     *
-     * \param damaEntry DamaEntry for created UT info.
-     * \param cnoEstimator C/N0 estimator for the UT info.
-     * \param controlSlotOffset Offset of the current moment to generate control slot.
-     * \param controlSlotsEnabled Flag to tell if control slots generation is enabled according to controlSlotOffset
-     */
-    SatUtInfo ( Ptr<SatDamaEntry> damaEntry, Ptr<SatCnoEstimator> cnoEstimator, Time controlSlotOffset, bool controlSlotsEnabled );
-
-    /**
-     * Get damaEntry of the UT info.
-     *
-     * \return Pointer to DamEntry of the UT info.
-     */
-    Ptr<SatDamaEntry> GetDamaEntry ();
-
-    /**
-     * Update DamaEntry with information of the received CR messages.
-     */
-    void UpdateDamaEntryFromCrs ();
-
-    /**
-     * Add C/N0 sample to UT info's estimator.
-     *
-     * \param sample C/N0 sample value to add.
-     */
-    void AddCnoSample (double sample);
-
-    /**
-     * Get estimated C/N0 value based on added samples.
-     *
-     * \return C/N0 estimation.
-     */
-    double GetCnoEstimation ();
-
-    /**
-     * Add CR message to UT info to be used when capacity request is calculated
-     * next time (method UpdateDamaEntryFromCrs is called).
-     *
-     * \param crMsg
-     */
-    void AddCrMsg (Ptr<SatCrMessage> crMsg);
-
-    /**
-     * Check if time is expired to send control slot.
-     *
-     * \return Status of control slot generation time.
-     */
-    bool IsControlSlotGenerationTime () const;
-
-    /**
-     * Set time for next time slot generation for this UT.
-     *
-     * \param offset Offset of the current moment to generate control slot.
-     */
-    void SetControlSlotGenerationTime (Time offset);
-
-private:
-    /**
-     * Container to store received CR messages.
-     */
-    typedef std::vector< Ptr<SatCrMessage> > CrMsgContainer_t;
-
-    /**
-     * DamaEntry of this UT info.
-     */
-    Ptr<SatDamaEntry>  m_damaEntry;
-
-    /**
-     *  Estimator for the C/N0.
-     */
-    Ptr<SatCnoEstimator>  m_cnoEstimator;
-
-    /**
-     *  Received CRs since last update round (call of the method UpdateDamaEntryFromCrs).
-     */
-    CrMsgContainer_t  m_crContainer;
-
-    /**
-     * Time to send next control time slot.
-     */
-    Time  m_controlSlotGenerationTime;
-
-    /**
-     * Flag to indicated if control time slots generation is enabled.
-     */
-    bool  m_controlSlotsEnabled;
-  };
+  typedef std::pair<uint32_t, SatFrameAllocator::SatFrameAllocReq >  UtReqInfoItem_t;
 
   /**
-   * Pair to store capacity request information for the UT
+   * Map container to store indexes of the UTs in the DAMA table.
    */
-  typedef std::pair<Address, SatFrameAllocator::SatFrameAllocReq >   UtReqInfoItem_t;
-
-  /**
-   * Map container to store UT information.
-   */
-  typedef std::map<Address, Ptr<SatUtInfo> >                         UtInfoMap_t;
+  typedef std::map<Address, uint32_t>                                UtIndexMap_t;
 
   /**
    * Container to store capacity request information for the UTs.
@@ -305,16 +207,6 @@ private:
   class CnoCompare
   {
 public:
-    /**
-     * Construct CnoCompare object
-     *
-     * \param utInfoMap Reference to map container for the UT information
-     */
-    CnoCompare (const UtInfoMap_t& utInfoMap)
-      : m_utInfoMap (utInfoMap)
-    {
-    }
-
     /**
      * Compare operator to compare request information of the two UTs.
      *
@@ -322,12 +214,12 @@ public:
      * \param utReqInfo2 Request information for UT 2
      * \return true if first UT's C/N0 is more robust than second UT's
      */
-    bool operator() (UtReqInfoItem_t utReqInfo1, UtReqInfoItem_t utReqInfo2)
+    bool operator() (const UtReqInfoItem_t& utReqInfo1, const UtReqInfoItem_t& utReqInfo2) const
     {
       double result = false;
 
-      double cnoFirst = m_utInfoMap.at (utReqInfo1.first)->GetCnoEstimation ();
-      double cnoSecond = m_utInfoMap.at (utReqInfo2.first)->GetCnoEstimation ();
+      double cnoFirst = utReqInfo1.second.m_cno;
+      double cnoSecond = utReqInfo2.second.m_cno;
 
       if ( !std::isnan (cnoFirst) )
         {
@@ -343,11 +235,6 @@ public:
 
       return result;
     }
-private:
-    /**
-     * Reference to map container for the UT information
-     */
-    const UtInfoMap_t&  m_utInfoMap;
   };
 
   /**
@@ -371,9 +258,19 @@ private:
   SatBeamScheduler::SendCtrlMsgCallback m_txCallback;
 
   /**
-   * Map to store UT information in beam for updating purposes.
+   * Map to find the indexes of the UTs of the beam in the DAMA table.
+   */
+  UtIndexMap_t m_utIndexes;
+
+  /**
+   * DAMA state of the UTs of the beam.
+   */
+  SatDamaTable m_damaTable;
+
+  /**
+   * Time to send next control time slot, per UT index.
    */
-  UtInfoMap_t m_utInfos;
+  std::vector<Time> m_controlSlotGenerationTimes;
 
   /**
    * Container including every UT's allocation requests.
@@ -52,6 +52,20 @@ SatChannelEstimationErrorContainer::AddError (double sinrIn, uint32_t wfId) cons
   return DoAddError (sinrIn, wfId);
 }
 
+int64_t
+SatChannelEstimationErrorContainer::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  return DoAssignStreams (stream);
+}
+
+int64_t
+SatChannelEstimationErrorContainer::DoAssignStreams (int64_t /*stream*/)
+{
+  return 0;
+}
+
 
 /**
  * SatSimpleChannelEstimationErrorContainer
@@ -92,6 +106,13 @@ SatFwdLinkChannelEstimationErrorContainer::SatFwdLinkChannelEstimationErrorConta
   m_channelEstimationError = CreateObject<SatChannelEstimationError> (filePathName);
 }
 
+SatFwdLinkChannelEstimationErrorContainer::SatFwdLinkChannelEstimationErrorContainer (Ptr<SatFwdLinkChannelEstimationErrorContainer> tableSource)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_channelEstimationError = CreateObject<SatChannelEstimationError> (tableSource->m_channelEstimationError);
+}
+
 SatFwdLinkChannelEstimationErrorContainer::~SatFwdLinkChannelEstimationErrorContainer ()
 {
 
@@ -105,6 +126,14 @@ SatFwdLinkChannelEstimationErrorContainer::DoAddError (double sinrIn, uint32_t /
   return m_channelEstimationError->AddError (sinrIn);
 }
 
+int64_t
+SatFwdLinkChannelEstimationErrorContainer::DoAssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  return m_channelEstimationError->AssignStreams (stream);
+}
+
 /**
  * SatFwdLinkChannelEstimationErrorContainer
  */
@@ -152,4 +181,20 @@ SatRtnLinkChannelEstimationErrorContainer::DoAddError (double sinrIn, uint32_t w
   return 0.0;
 }
 
+int64_t
+SatRtnLinkChannelEstimationErrorContainer::DoAssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  for (std::map<uint32_t, Ptr<SatChannelEstimationError> >::iterator it = m_channelEstimationErrors.begin ();
+       it != m_channelEstimationErrors.end (); ++it)
+    {
+      currentStream += it->second->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 }
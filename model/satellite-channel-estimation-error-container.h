@@ -63,6 +63,14 @@ public:
    */
   double AddError (double sinrInDb, uint32_t wfId = 0) const;
 
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables of the channel estimation errors.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
 protected:
   /**
    * \brief Pure virtual method for the implementation in derived classes.
@@ -72,6 +80,14 @@ protected:
    */
   virtual double DoAddError (double sinrInDb, uint32_t wfId) const = 0;
 
+  /**
+   * \brief Assign the random variable streams in derived classes. Base class
+   * does not have random variables.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t DoAssignStreams (int64_t stream);
+
 private:
 };
 
@@ -111,6 +127,14 @@ public:
    */
   SatFwdLinkChannelEstimationErrorContainer ();
 
+  /**
+   * Constructor sharing the error table read from the data directory with
+   * another container. The channel estimation errors are drawn from an own
+   * random variable.
+   * \param tableSource Container whose error table is shared
+   */
+  SatFwdLinkChannelEstimationErrorContainer (Ptr<SatFwdLinkChannelEstimationErrorContainer> tableSource);
+
   /**
    * Destructor for SatFwdLinkChannelEstimationErrorContainer
    */
@@ -126,6 +150,13 @@ protected:
    */
   virtual double DoAddError (double sinrInDb, uint32_t wfId) const;
 
+  /**
+   * \brief Assign the random variable stream of the channel estimation error
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t DoAssignStreams (int64_t stream);
+
 private:
   /**
    * Only one channel estimator error configuration for
@@ -160,6 +191,14 @@ protected:
    */
   virtual double DoAddError (double sinrInDb, uint32_t wfId) const;
 
+  /**
+   * \brief Assign the random variable streams of the channel estimation
+   * errors of the waveforms
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t DoAssignStreams (int64_t stream);
+
 private:
   /**
    * Map of channel estimation errors for each waveform id
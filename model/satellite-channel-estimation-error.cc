@@ -34,9 +34,7 @@ NS_OBJECT_ENSURE_REGISTERED (SatChannelEstimationError);
 SatChannelEstimationError::SatChannelEstimationError ()
   : m_lastSampleIndex (0),
     m_normalRandomVariable (),
-    m_sinrsDb (),
-    m_mueCesDb (),
-    m_stdCesDb ()
+    m_table (Create<ErrorTable> ())
 {
   m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
 }
@@ -44,14 +42,20 @@ SatChannelEstimationError::SatChannelEstimationError ()
 SatChannelEstimationError::SatChannelEstimationError (std::string filePathName)
   : m_lastSampleIndex (0),
     m_normalRandomVariable (),
-    m_sinrsDb (),
-    m_mueCesDb (),
-    m_stdCesDb ()
+    m_table (Create<ErrorTable> ())
 {
   m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
   ReadFile (filePathName);
 }
 
+SatChannelEstimationError::SatChannelEstimationError (Ptr<SatChannelEstimationError> tableSource)
+  : m_lastSampleIndex (tableSource->m_lastSampleIndex),
+    m_normalRandomVariable (),
+    m_table (tableSource->m_table)
+{
+  m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
+}
+
 
 SatChannelEstimationError::~SatChannelEstimationError ()
 {
@@ -105,23 +109,32 @@ void SatChannelEstimationError::ReadFile (std::string filePathName)
 
   while (ifs->good ())
     {
-      m_sinrsDb.push_back (sinrDb);
-      m_mueCesDb.push_back (mueCe);
-      m_stdCesDb.push_back (stdCe);
+      m_table->m_sinrsDb.push_back (sinrDb);
+      m_table->m_mueCesDb.push_back (mueCe);
+      m_table->m_stdCesDb.push_back (stdCe);
 
       // get next row
       *ifs >> sinrDb >> mueCe >> stdCe;
     }
 
-  NS_ASSERT (m_sinrsDb.size () == m_mueCesDb.size ());
-  NS_ASSERT (m_mueCesDb.size () == m_stdCesDb.size ());
+  NS_ASSERT (m_table->m_sinrsDb.size () == m_table->m_mueCesDb.size ());
+  NS_ASSERT (m_table->m_mueCesDb.size () == m_table->m_stdCesDb.size ());
 
-  m_lastSampleIndex = m_sinrsDb.size () - 1;
+  m_lastSampleIndex = m_table->m_sinrsDb.size () - 1;
 
   ifs->close ();
   delete ifs;
 }
 
+int64_t
+SatChannelEstimationError::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_normalRandomVariable->SetStream (stream);
+  return 1;
+}
+
 double
 SatChannelEstimationError::AddError (double sinrInDb) const
 {
@@ -138,30 +151,30 @@ SatChannelEstimationError::AddError (double sinrInDb) const
   double stdCe (0.0);
 
   // If smaller than minimum SINR
-  if (sinrInDb <= m_sinrsDb[0])
+  if (sinrInDb <= m_table->m_sinrsDb[0])
     {
-      mueCe = m_mueCesDb[0];
-      stdCe = m_stdCesDb[0];
+      mueCe = m_table->m_mueCesDb[0];
+      stdCe = m_table->m_stdCesDb[0];
     }
   // If larger than maximum SINR
-  else if (sinrInDb >= m_sinrsDb[m_lastSampleIndex])
+  else if (sinrInDb >= m_table->m_sinrsDb[m_lastSampleIndex])
     {
-      mueCe = m_mueCesDb[m_lastSampleIndex];
-      stdCe = m_stdCesDb[m_lastSampleIndex];
+      mueCe = m_table->m_mueCesDb[m_lastSampleIndex];
+      stdCe = m_table->m_stdCesDb[m_lastSampleIndex];
     }
   // Else find proper point and interpolate
   else
     {
-      for (uint32_t i = 0; i < m_sinrsDb.size (); ++i)
+      for (uint32_t i = 0; i < m_table->m_sinrsDb.size (); ++i)
         {
           // Trigger the first bigger threshold
-          if (sinrInDb < m_sinrsDb[i])
+          if (sinrInDb < m_table->m_sinrsDb[i])
             {
               /**
                * Interpolate the proper mean and std values
                */
-              mueCe = SatUtils::Interpolate (sinrInDb, m_sinrsDb[i - 1], m_sinrsDb[i], m_mueCesDb[i - 1], m_mueCesDb[i]);
-              stdCe = SatUtils::Interpolate (sinrInDb, m_sinrsDb[i - 1], m_sinrsDb[i], m_stdCesDb[i - 1], m_stdCesDb[i]);
+              mueCe = SatUtils::Interpolate (sinrInDb, m_table->m_sinrsDb[i - 1], m_table->m_sinrsDb[i], m_table->m_mueCesDb[i - 1], m_table->m_mueCesDb[i]);
+              stdCe = SatUtils::Interpolate (sinrInDb, m_table->m_sinrsDb[i - 1], m_table->m_sinrsDb[i], m_table->m_stdCesDb[i - 1], m_table->m_stdCesDb[i]);
               break;
             }
         }
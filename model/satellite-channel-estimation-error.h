@@ -23,6 +23,7 @@
 #define SATELLITE_CHANNEL_ESTIMATION_ERROR_H_
 
 #include "ns3/object.h"
+#include "ns3/simple-ref-count.h"
 #include "ns3/random-variable-stream.h"
 
 namespace ns3 {
@@ -52,6 +53,13 @@ public:
    */
   SatChannelEstimationError (std::string filePathName);
 
+  /**
+   * Constructor
+   * \param tableSource Channel estimation error whose error table is shared.
+   * A new random variable is created for this instance.
+   */
+  SatChannelEstimationError (Ptr<SatChannelEstimationError> tableSource);
+
   /**
    * Destructor for SatChannelEstimationError
    */
@@ -75,7 +83,38 @@ public:
    */
   double AddError (double sinrInDb) const;
 
+  /**
+   * \brief Assign a fixed random variable stream number to the random
+   * variable used by this model.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned by this model
+   */
+  int64_t AssignStreams (int64_t stream);
+
 private:
+  /**
+   * \brief Distribution mean and STD values read from a file, shared by the
+   * channel estimation errors created from each other.
+   */
+  class ErrorTable : public SimpleRefCount<ErrorTable>
+  {
+  public:
+    /**
+     * SINR values
+     */
+    std::vector<double> m_sinrsDb;
+
+    /**
+     * Mean values
+     */
+    std::vector<double> m_mueCesDb;
+
+    /**
+     * Standard deviation values
+     */
+    std::vector<double> m_stdCesDb;
+  };
+
   /**
    * \brief Read the distribution mean and STD values from file.
    * \param filePathName File name
@@ -94,19 +133,9 @@ private:
   Ptr<NormalRandomVariable> m_normalRandomVariable;
 
   /**
-   * SINR values
-   */
-  std::vector<double> m_sinrsDb;
-
-  /**
-   * Mean values
-   */
-  std::vector<double> m_mueCesDb;
-
-  /**
-   * Standard deviation values
+   * Distribution mean and STD values
    */
-  std::vector<double> m_stdCesDb;
+  Ptr<ErrorTable> m_table;
 
 };
 
@@ -55,6 +55,7 @@ SatChannel::SatChannel ()
     m_freqId (),
     m_propagationDelay (),
     m_freeSpaceLoss (),
+    m_interferenceMatrix (),
     m_rxPowerCalculationMode (SatEnums::RX_PWR_CALCULATION),
     /*
      * Currently, the Rx power calculation mode is fully independent of other
@@ -65,7 +66,9 @@ SatChannel::SatChannel ()
      */
     m_enableRxPowerOutputTrace (false),
     m_enableFadingOutputTrace (false),
-    m_enableExternalFadingInputTrace (false)
+    m_enableExternalFadingInputTrace (false),
+    m_enableRxFilter (true),
+    m_enableBentPipe (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -81,6 +84,9 @@ SatChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_phyRxContainer.clear ();
   m_propagationDelay = 0;
+  m_interferenceMatrix = 0;
+  m_rxPowerTraceWriters.Clear ();
+  m_fadingTraceWriters.Clear ();
   Channel::DoDispose ();
 }
 
@@ -105,6 +111,21 @@ SatChannel::GetTypeId (void)
                     BooleanValue (false),
                     MakeBooleanAccessor (&SatChannel::m_enableExternalFadingInputTrace),
                     MakeBooleanChecker ())
+    .AddAttribute ( "EnableRxFilter",
+                    "Enable filtering of the forward user link transmissions before the Rx power calculation. "
+                    "Transmissions not needed by a receiver are dropped and transmissions needed only as "
+                    "interference are aggregated to the interference model of the receiver.",
+                    BooleanValue (true),
+                    MakeBooleanAccessor (&SatChannel::m_enableRxFilter),
+                    MakeBooleanChecker ())
+    .AddAttribute ( "EnableBentPipe",
+                    "Enable the bent pipe mode of the transparent satellite. The satellite receives only "
+                    "the uplink bursts of its own beam, without copying them, and forwards each burst "
+                    "already at the start of its reception instead of scheduling the end of the reception. "
+                    "The interference model of the satellite shall not use the Rx powers of the bursts.",
+                    BooleanValue (false),
+                    MakeBooleanAccessor (&SatChannel::m_enableBentPipe),
+                    MakeBooleanChecker ())
     .AddAttribute ("RxPowerCalculationMode",
                    "Rx Power calculation mode",
                    EnumValue (SatEnums::RX_PWR_CALCULATION),
@@ -148,6 +169,21 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
   NS_LOG_FUNCTION (this << txParams);
   NS_ASSERT_MSG (txParams->m_phyTx, "NULL phyTx");
 
+  // The co-channel interference of the beam matrix interference model is
+  // based on the transmission activity tracked here.
+  if (m_interferenceMatrix)
+    {
+      // In the bent pipe mode, the satellite transmits the burst from the start of its reception
+      Time endDelay = Seconds (0);
+
+      if (txParams->m_bentPipe)
+        {
+          endDelay = txParams->m_duration;
+        }
+
+      m_interferenceMatrix->NotifyTx (txParams->m_beamId, txParams->m_carrierId, txParams->m_duration, txParams->m_txPower_W, endDelay);
+    }
+
   switch (m_fwdMode)
     {
     /**
@@ -180,6 +216,16 @@ SatChannel::StartTx (Ptr<SatSignalParameters> txParams)
                   case SatEnums::FORWARD_USER_CH:
                   case SatEnums::RETURN_FEEDER_CH:
                     {
+                      // Check the destination addresses from the summary of the burst, if available
+                      if (txParams->m_addressSummary != NULL && !txParams->m_addressSummary->m_hasUntaggedPacket)
+                        {
+                          if (txParams->m_addressSummary->IsDestination ((*rxPhyIterator)->GetAddress ()))
+                            {
+                              ScheduleRx (txParams, *rxPhyIterator);
+                            }
+                          break;
+                        }
+
                       // Go through the packets and check their destination address by peeking the MAC tag
                       SatSignalParameters::PacketsInBurst_t::const_iterator it = txParams->m_packetsInBurst.begin ();
                       for (; it != txParams->m_packetsInBurst.end (); ++it )
@@ -263,13 +309,59 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
 {
   NS_LOG_FUNCTION (this << txParams << receiver);
 
+  SatEnums::RxFilterResult_t filterResult = SatEnums::RX_FILTER_RECEIVE;
+  SatSignalParameters::rxDecision_s rxDecision;
+  rxDecision.resolved = false;
+  rxDecision.receive = false;
+
+  /**
+   * In the bent pipe mode, the satellite does not use the Rx powers of the bursts
+   * as interference, thus the bursts of the other beams are not delivered to it.
+   * The burst of the own beam has then a single receiver and it is passed on
+   * without a copy.
+   */
+  bool bentPipe = m_enableBentPipe
+    && (m_channelType == SatEnums::RETURN_USER_CH || m_channelType == SatEnums::FORWARD_FEEDER_CH);
+
+  if (bentPipe && receiver->GetBeamId () != txParams->m_beamId)
+    {
+      NS_LOG_INFO ("Transmission of another beam not delivered to satellite receiver " << receiver);
+      return;
+    }
+
+  /**
+   * Ask the receiver whether it needs the transmission at all, before
+   * any per-receiver work is done. The filtering is not used with the Rx power
+   * and fading output traces, which shall contain all the receptions.
+   */
+  if (m_enableRxFilter && !m_enableRxPowerOutputTrace && !m_enableFadingOutputTrace)
+    {
+      filterResult = receiver->GetRxFilterResult (txParams, rxDecision);
+
+      if (filterResult == SatEnums::RX_FILTER_DISCARD)
+        {
+          NS_LOG_INFO ("Transmission discarded by receiver " << receiver);
+          return;
+        }
+    }
+
   Time delay = Seconds (0);
 
   Ptr<MobilityModel> senderMobility = txParams->m_phyTx->GetMobility ();
   Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
 
-  NS_LOG_INFO ("copying signal parameters " << txParams);
-  Ptr<SatSignalParameters> rxParams = txParams->Copy ();
+  Ptr<SatSignalParameters> rxParams = txParams;
+
+  if (bentPipe)
+    {
+      rxParams->m_bentPipe = true;
+    }
+  else
+    {
+      NS_LOG_INFO ("copying signal parameters " << txParams);
+      rxParams = txParams->Copy ();
+      rxParams->m_rxDecision = rxDecision;
+    }
 
   if (m_propagationDelay)
     {
@@ -292,7 +384,15 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
         case SatEnums::RETURN_FEEDER_CH:
         case SatEnums::FORWARD_USER_CH:
           {
-            if ( delay > txParams->m_duration)
+            /**
+             * In the bent pipe mode, the satellite has forwarded the burst already
+             * at the start of its reception, thus no compensation is needed.
+             */
+            if (txParams->m_bentPipe)
+              {
+                rxParams->m_bentPipe = false;
+              }
+            else if ( delay > txParams->m_duration)
               {
                 delay -= txParams->m_duration;
               }
@@ -322,7 +422,15 @@ SatChannel::ScheduleRx (Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receive
 
   Ptr<NetDevice> netDev = receiver->GetDevice ();
   uint32_t dstNodeId =  netDev->GetNode ()->GetId ();
-  Simulator::ScheduleWithContext (dstNodeId, delay, &SatChannel::StartRx, this, rxParams, receiver);
+
+  if (filterResult == SatEnums::RX_FILTER_INTERFERENCE_ONLY)
+    {
+      Simulator::ScheduleWithContext (dstNodeId, delay, &SatChannel::StartRxInterference, this, rxParams, receiver);
+    }
+  else
+    {
+      Simulator::ScheduleWithContext (dstNodeId, delay, &SatChannel::StartRx, this, rxParams, receiver);
+    }
 }
 
 void
@@ -330,6 +438,26 @@ SatChannel::StartRx (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
 {
   NS_LOG_FUNCTION (this << rxParams << phyRx);
 
+  DoRxPower (rxParams, phyRx);
+
+  phyRx->StartRx (rxParams);
+}
+
+void
+SatChannel::StartRxInterference (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
+{
+  NS_LOG_FUNCTION (this << rxParams << phyRx);
+
+  DoRxPower (rxParams, phyRx);
+
+  phyRx->StartRxInterference (rxParams);
+}
+
+void
+SatChannel::DoRxPower (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
+{
+  NS_LOG_FUNCTION (this << rxParams << phyRx);
+
   rxParams->m_channelType = m_channelType;
 
   double frequency_hz = m_carrierFreqConverter (m_channelType, m_freqId, rxParams->m_carrierId);
@@ -354,12 +482,10 @@ SatChannel::StartRx (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
       }
     default:
       {
-        NS_FATAL_ERROR ("SatChannel::StartRx - Invalid Rx power calculation mode");
+        NS_FATAL_ERROR ("SatChannel::DoRxPower - Invalid Rx power calculation mode");
         break;
       }
     }
-
-  phyRx->StartRx (rxParams);
 }
 
 void
@@ -375,24 +501,20 @@ SatChannel::DoRxPowerOutputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyR
                 ", carrierId: " << rxParams->m_carrierId <<
                 ", channelType: " << SatEnums::GetChannelTypeName (m_channelType));
 
-  std::vector<double> tempVector;
-  tempVector.push_back (Now ().GetSeconds ());
-
-  // Output the Rx power density (W / Hz)
-  tempVector.push_back (rxParams->m_rxPower_W / carrierBandwidthHz);
+  Address address;
 
   switch (m_channelType)
     {
     case SatEnums::RETURN_FEEDER_CH:
     case SatEnums::FORWARD_USER_CH:
       {
-        Singleton<SatRxPowerOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (phyRx->GetDevice ()->GetAddress (), m_channelType), tempVector);
+        address = phyRx->GetDevice ()->GetAddress ();
         break;
       }
     case SatEnums::FORWARD_FEEDER_CH:
     case SatEnums::RETURN_USER_CH:
       {
-        Singleton<SatRxPowerOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (GetSourceAddress (rxParams), m_channelType), tempVector);
+        address = GetSourceAddress (rxParams);
         break;
       }
     default:
@@ -401,6 +523,16 @@ SatChannel::DoRxPowerOutputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyR
         break;
       }
     }
+
+  Ptr<SatOutputFileStreamDoubleContainer> writer = m_rxPowerTraceWriters.GetWriter (Singleton<SatRxPowerOutputTraceContainer>::Get (),
+                                                                                    std::make_pair (address, m_channelType));
+
+  if (writer != NULL)
+    {
+      // Output the Rx power density (W / Hz)
+      double values[SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_NUMBER_OF_COLUMNS] = { Now ().GetSeconds (), rxParams->m_rxPower_W / carrierBandwidthHz };
+      writer->AddToContainer (values, SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_NUMBER_OF_COLUMNS);
+    }
 }
 
 void
@@ -452,22 +584,20 @@ SatChannel::DoFadingOutputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
 {
   NS_LOG_FUNCTION (this << rxParams << phyRx << fadingValue);
 
-  std::vector<double> tempVector;
-  tempVector.push_back (Now ().GetSeconds ());
-  tempVector.push_back (fadingValue);
+  Address address;
 
   switch (m_channelType)
     {
     case SatEnums::RETURN_FEEDER_CH:
     case SatEnums::FORWARD_USER_CH:
       {
-        Singleton<SatFadingOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (phyRx->GetDevice ()->GetAddress (), m_channelType), tempVector);
+        address = phyRx->GetDevice ()->GetAddress ();
         break;
       }
     case SatEnums::FORWARD_FEEDER_CH:
     case SatEnums::RETURN_USER_CH:
       {
-        Singleton<SatFadingOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (GetSourceAddress (rxParams), m_channelType), tempVector);
+        address = GetSourceAddress (rxParams);
         break;
       }
     default:
@@ -476,6 +606,15 @@ SatChannel::DoFadingOutputTrace (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
         break;
       }
     }
+
+  Ptr<SatOutputFileStreamDoubleContainer> writer = m_fadingTraceWriters.GetWriter (Singleton<SatFadingOutputTraceContainer>::Get (),
+                                                                                   std::make_pair (address, m_channelType));
+
+  if (writer != NULL)
+    {
+      double values[SatBaseTraceContainer::FADING_TRACE_DEFAULT_NUMBER_OF_COLUMNS] = { Now ().GetSeconds (), fadingValue };
+      writer->AddToContainer (values, SatBaseTraceContainer::FADING_TRACE_DEFAULT_NUMBER_OF_COLUMNS);
+    }
 }
 
 void
@@ -598,6 +737,11 @@ SatChannel::GetSourceAddress (Ptr<SatSignalParameters> rxParams)
 {
   NS_LOG_FUNCTION (this << rxParams);
 
+  if (rxParams->m_addressSummary != NULL && !rxParams->m_packetsInBurst.empty ())
+    {
+      return rxParams->m_addressSummary->m_firstSourceAddress;
+    }
+
   SatMacTag tag;
 
   SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
@@ -679,6 +823,21 @@ SatChannel::SetFreeSpaceLoss (Ptr<SatFreeSpaceLoss> loss)
   m_freeSpaceLoss = loss;
 }
 
+void
+SatChannel::SetInterferenceMatrix (Ptr<SatBeamInterferenceMatrix> matrix)
+{
+  NS_LOG_FUNCTION (this << matrix);
+  m_interferenceMatrix = matrix;
+}
+
+Ptr<SatBeamInterferenceMatrix>
+SatChannel::GetInterferenceMatrix ()
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_interferenceMatrix;
+}
+
 std::size_t
 SatChannel::GetNDevices (void) const
 {
@@ -29,10 +29,12 @@
 #include "ns3/propagation-delay-model.h"
 #include "satellite-signal-parameters.h"
 #include "satellite-free-space-loss.h"
+#include "satellite-beam-interference-matrix.h"
 #include "satellite-phy-rx.h"
 #include "satellite-phy-rx-carrier-conf.h"
 #include "satellite-enums.h"
 #include "satellite-typedefs.h"
+#include "satellite-base-output-trace-container.h"
 
 namespace ns3 {
 
@@ -154,6 +156,19 @@ public:
    */
   virtual void SetFreeSpaceLoss (Ptr<SatFreeSpaceLoss> delay);
 
+  /**
+   * \brief Set the beam interference matrix, which is notified of all the
+   * transmissions in the channel
+   * \param matrix Ptr to the beam interference matrix
+   */
+  virtual void SetInterferenceMatrix (Ptr<SatBeamInterferenceMatrix> matrix);
+
+  /**
+   * \brief Get the beam interference matrix of the channel
+   * \return Ptr to the beam interference matrix, NULL if not set
+   */
+  virtual Ptr<SatBeamInterferenceMatrix> GetInterferenceMatrix ();
+
   /**
    * \brief Used by attached SatPhyTx instances to transmit signals to the channel
    * \param params the parameters of the signals being transmitted
@@ -229,6 +244,11 @@ private:
    */
   Ptr<SatFreeSpaceLoss> m_freeSpaceLoss;
 
+  /**
+   * \brief Beam interference matrix tracking the transmissions of the channel
+   */
+  Ptr<SatBeamInterferenceMatrix> m_interferenceMatrix;
+
   /**
    * \brief Defines the mode used for Rx power calculation
    */
@@ -249,6 +269,28 @@ private:
    */
   bool m_enableExternalFadingInputTrace;
 
+  /**
+   * \brief Defines whether receivers are asked, before the Rx power calculation,
+   * whether they need a transmission at all
+   */
+  bool m_enableRxFilter;
+
+  /**
+   * \brief Defines whether the satellite forwards the uplink bursts already
+   * at the start of their reception (bent pipe mode)
+   */
+  bool m_enableBentPipe;
+
+  /**
+   * \brief Rx power output trace writers of the traced receivers and sources
+   */
+  SatOutputTraceWriterCache m_rxPowerTraceWriters;
+
+  /**
+   * \brief Fading output trace writers of the traced receivers and sources
+   */
+  SatOutputTraceWriterCache m_fadingTraceWriters;
+
   /**
    * Dispose SatChannel.
    */
@@ -269,6 +311,24 @@ private:
    */
   void StartRx (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
 
+  /**
+   * \brief Used internally to start the reception of a transmission, which is
+   * needed only as interference, at the phyRx.
+   *
+   * \param rxParams Parameters of the signal being received
+   * \param phyRx The receiver SatPhyRx entity
+   */
+  void StartRxInterference (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
+
+  /**
+   * \brief Set the channel type and carrier frequency of the signal being
+   * received and calculate its Rx power according to the Rx power calculation mode.
+   *
+   * \param rxParams Parameters of the signal being received
+   * \param phyRx The receiver SatPhyRx entity
+   */
+  void DoRxPower (Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
+
   /**
    * \brief Function for Rx power output trace
    * \param rxParams Rx parameters
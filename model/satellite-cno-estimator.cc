@@ -18,8 +18,7 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
-#include <numeric>
-#include <math.h>
+#include <cmath>
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "satellite-cno-estimator.h"
@@ -64,13 +63,25 @@ SatCnoEstimator::GetCnoEstimation ()
 // class for Basic C/N0 estimator
 
 SatBasicCnoEstimator::SatBasicCnoEstimator ()
-  : m_mode (LAST)
+  : m_head (0),
+    m_tail (0),
+    m_minimumHead (0),
+    m_minimumTail (0),
+    m_sum (0.0),
+    m_average (NAN),
+    m_mode (LAST)
 {
   NS_LOG_FUNCTION (this);
 }
 
 SatBasicCnoEstimator::SatBasicCnoEstimator (SatCnoEstimator::EstimationMode_t mode, Time window)
-  : m_window (window),
+  : m_head (0),
+    m_tail (0),
+    m_minimumHead (0),
+    m_minimumTail (0),
+    m_sum (0.0),
+    m_average (NAN),
+    m_window (window),
     m_mode (mode)
 
 {
@@ -90,18 +101,46 @@ SatBasicCnoEstimator::DoAddSample (double sample)
   switch (m_mode)
     {
     case LAST:
-      m_samples.clear ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+      m_head = m_tail;
+      m_minimumHead = m_minimumTail;
+      m_sum = 0.0;
+      StoreSample (sample);
       break;
 
     case MINIMUM:
+    case AVERAGE:
       ClearOutdatedSamples ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+
+      // Only the first sample of a time instance is stored
+      if (m_head == m_tail || GetSample (m_tail - 1).m_time < Simulator::Now ())
+        {
+          StoreSample (sample);
+        }
       break;
 
-    case AVERAGE:
+    case EXPONENTIAL_AVERAGE:
       ClearOutdatedSamples ();
-      m_samples.insert (std::make_pair (Simulator::Now (), sample) );
+
+      if (!std::isnan (sample))
+        {
+          if (m_head == m_tail || std::isnan (m_average))
+            {
+              m_average = sample;
+            }
+          else
+            {
+              Time elapsed = Simulator::Now () - GetSample (m_tail - 1).m_time;
+              double weight = 1.0 - std::exp (-elapsed.GetSeconds () / m_window.GetSeconds ());
+
+              m_average += weight * (sample - m_average);
+            }
+
+          // Only the time of the newest sample is needed
+          m_head = m_tail;
+          m_minimumHead = m_minimumTail;
+          m_sum = 0.0;
+          StoreSample (sample);
+        }
       break;
 
     default:
@@ -119,26 +158,28 @@ SatBasicCnoEstimator::DoGetCnoEstimation ()
 
   ClearOutdatedSamples ();
 
-  if (  m_samples.empty () == false )
+  if (m_head != m_tail)
     {
       switch (m_mode)
         {
         case LAST:
-          estimatedCno = m_samples.begin ()->second;
+          estimatedCno = GetSample (m_tail - 1).m_cno;
           break;
 
         case MINIMUM:
-          for ( SampleMap_t::const_iterator it = m_samples.begin (); it != m_samples.end (); it++ )
+          // NAN samples are not minimum candidates, so NAN is returned only if all the samples are NAN
+          if (m_minimumHead != m_minimumTail)
             {
-              if ( std::isnan (estimatedCno) || (( !std::isnan (it->second)) && (it->second < estimatedCno)) )
-                {
-                  estimatedCno = it->second;
-                }
+              estimatedCno = GetSample (GetMinimumCandidate (m_minimumHead)).m_cno;
             }
           break;
 
         case AVERAGE:
-          estimatedCno = std::accumulate (m_samples.begin (), m_samples.end (), 0.0, SatBasicCnoEstimator::AddToSum ) / m_samples.size ();
+          estimatedCno = m_sum / (m_tail - m_head);
+          break;
+
+        case EXPONENTIAL_AVERAGE:
+          estimatedCno = m_average;
           break;
 
         default:
@@ -154,9 +195,91 @@ void
 SatBasicCnoEstimator::ClearOutdatedSamples ()
 {
   NS_LOG_FUNCTION (this);
-  SampleMap_t::iterator itLastValid = m_samples.lower_bound (Simulator::Now () - m_window );
 
-  m_samples.erase (m_samples.begin (), itLastValid );
+  Time firstValidTime = Simulator::Now () - m_window;
+
+  while (m_head != m_tail && GetSample (m_head).m_time < firstValidTime)
+    {
+      const Sample_t &sample = GetSample (m_head);
+
+      if (!std::isnan (sample.m_cno))
+        {
+          m_sum -= sample.m_cno;
+        }
+
+      if (m_minimumHead != m_minimumTail && GetMinimumCandidate (m_minimumHead) == m_head)
+        {
+          ++m_minimumHead;
+        }
+
+      ++m_head;
+    }
+
+  // Avoid accumulating rounding errors of the running sum
+  if (m_head == m_tail)
+    {
+      m_sum = 0.0;
+      m_average = NAN;
+    }
+}
+
+void
+SatBasicCnoEstimator::StoreSample (double cno)
+{
+  NS_LOG_FUNCTION (this << cno);
+
+  if (m_tail - m_head == m_samples.size ())
+    {
+      GrowRing ();
+    }
+
+  uint32_t seqNo = m_tail++;
+
+  Sample_t &sample = GetSample (seqNo);
+  sample.m_time = Simulator::Now ();
+  sample.m_cno = cno;
+
+  if (!std::isnan (cno))
+    {
+      m_sum += cno;
+
+      // The candidates larger than the new sample cannot be the minimum anymore
+      while (m_minimumHead != m_minimumTail && GetSample (GetMinimumCandidate (m_minimumTail - 1)).m_cno > cno)
+        {
+          --m_minimumTail;
+        }
+
+      GetMinimumCandidate (m_minimumTail++) = seqNo;
+    }
+}
+
+void
+SatBasicCnoEstimator::GrowRing ()
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t size = INITIAL_RING_SIZE;
+
+  if (!m_samples.empty ())
+    {
+      size = 2 * m_samples.size ();
+    }
+
+  std::vector<Sample_t> samples (size);
+  std::vector<uint32_t> minimumCandidates (size);
+
+  for (uint32_t seqNo = m_head; seqNo != m_tail; ++seqNo)
+    {
+      samples[seqNo & (size - 1)] = GetSample (seqNo);
+    }
+
+  for (uint32_t seqNo = m_minimumHead; seqNo != m_minimumTail; ++seqNo)
+    {
+      minimumCandidates[seqNo & (size - 1)] = GetMinimumCandidate (seqNo);
+    }
+
+  m_samples.swap (samples);
+  m_minimumCandidates.swap (minimumCandidates);
 }
 
 } // namespace ns3
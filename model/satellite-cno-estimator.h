@@ -21,7 +21,7 @@
 #ifndef SAT_CNO_ESTIMATOR
 #define SAT_CNO_ESTIMATOR
 
-#include <map>
+#include <vector>
 
 #include "ns3/nstime.h"
 #include "ns3/simple-ref-count.h"
@@ -45,7 +45,8 @@ public:
   {
     LAST,   //!< Last value in the given window returned
     MINIMUM, //!< Minimum value in the given window returned
-    AVERAGE //!< Average value in the given window returned
+    AVERAGE, //!< Average value in the given window returned
+    EXPONENTIAL_AVERAGE //!< Exponentially weighted average with the window as time constant returned
   } EstimationMode_t;
 
   /**
@@ -103,34 +104,22 @@ private:
  * This SatCnoEstimator class holds information of a satellite DAMA entry.
  * It's is created and used by NCC.
  *
- * It supports three dirrent modes:
+ * It supports four dirrent modes:
  *  - LAST: The last value in the window given when requested.
  *  - MINIMUM: The minimum value in the window given when requested.
  *  - AVERAGE: The average of the samples in window given when requested.
+ *  - EXPONENTIAL_AVERAGE: The exponentially weighted average of the samples
+ *    using the window as time constant given when requested, if there is a
+ *    sample in the window.
  *
+ * The samples of the window are kept in a ring buffer together with a
+ * running sum for the average and a monotonic queue of the candidates for
+ * the minimum, so that adding a sample and estimating are amortised constant
+ * time operations. Memory is allocated only when the ring buffer grows.
  */
 class SatBasicCnoEstimator : public SatCnoEstimator
 {
 public:
-  /**
-   * Method to add a sample value to current sum.
-   *
-   * \param currentSum
-   * \param sample
-   * \return New sum after addition.
-   */
-  static inline double AddToSum (double currentSum, const std::pair<Time, double>& sample)
-  {
-    double newSum = currentSum;
-
-    if ( !std::isnan (sample.second) )
-      {
-        newSum += sample.second;
-      }
-
-    return newSum;
-  }
-
   /**
    * Default construct a SatCnoEstimator.
    */
@@ -149,9 +138,38 @@ public:
   ~SatBasicCnoEstimator ();
 
 private:
-  typedef std::map<Time, double> SampleMap_t;
+  /**
+   * C/N0 sample with its time
+   */
+  typedef struct
+  {
+    Time m_time;
+    double m_cno;
+  } Sample_t;
+
+  /**
+   * Initial size of the sample ring buffer, shall be a power of two
+   */
+  static const uint32_t INITIAL_RING_SIZE = 16;
+
+  /**
+   * Samples of the window in a ring buffer indexed by sequence numbers
+   */
+  std::vector<Sample_t> m_samples;
 
-  SampleMap_t       m_samples;
+  /**
+   * Sequence numbers of the samples, which may be the minimum of the window
+   * in a ring buffer of the same size as the samples. The samples are in time
+   * order and their values increase.
+   */
+  std::vector<uint32_t> m_minimumCandidates;
+
+  uint32_t          m_head;           ///< Sequence number of the oldest sample
+  uint32_t          m_tail;           ///< Sequence number following the newest sample
+  uint32_t          m_minimumHead;    ///< Sequence number of the first minimum candidate
+  uint32_t          m_minimumTail;    ///< Sequence number following the last minimum candidate
+  double            m_sum;            ///< Sum of the valid sample values in the window
+  double            m_average;        ///< Exponentially weighted average
   Time              m_window;
   EstimationMode_t  m_mode;
 
@@ -174,6 +192,40 @@ private:
    * Clear outdated samples from storage.
    */
   void ClearOutdatedSamples ();
+
+  /**
+   * Store a sample as the newest sample of the window.
+   *
+   * \param cno C/N0 sample value
+   */
+  void StoreSample (double cno);
+
+  /**
+   * Grow the ring buffers to double size and relocate the samples.
+   */
+  void GrowRing ();
+
+  /**
+   * Get a sample of the window.
+   *
+   * \param seqNo Sequence number of the sample
+   * \return Sample
+   */
+  inline Sample_t & GetSample (uint32_t seqNo)
+  {
+    return m_samples[seqNo & (m_samples.size () - 1)];
+  }
+
+  /**
+   * Get a minimum candidate.
+   *
+   * \param seqNo Sequence number of the candidate
+   * \return Sequence number of the sample of the candidate
+   */
+  inline uint32_t & GetMinimumCandidate (uint32_t seqNo)
+  {
+    return m_minimumCandidates[seqNo & (m_minimumCandidates.size () - 1)];
+  }
 };
 
 } // namespace ns3
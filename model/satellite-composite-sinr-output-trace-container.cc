@@ -34,7 +34,7 @@ TypeId
 SatCompositeSinrOutputTraceContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatCompositeSinrOutputTraceContainer")
-    .SetParent<SatBaseTraceContainer> ()
+    .SetParent<SatBaseOutputTraceContainer> ()
     .AddConstructor<SatCompositeSinrOutputTraceContainer> ();
   return tid;
 }
@@ -48,7 +48,7 @@ SatCompositeSinrOutputTraceContainer::GetInstanceTypeId (void) const
 }
 
 SatCompositeSinrOutputTraceContainer::SatCompositeSinrOutputTraceContainer ()
-  : m_enableFigureOutput (true)
+  : SatBaseOutputTraceContainer (SatBaseTraceContainer::CSINR_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -67,21 +67,7 @@ SatCompositeSinrOutputTraceContainer::DoDispose ()
 
   Reset ();
 
-  SatBaseTraceContainer::DoDispose ();
-}
-
-void
-SatCompositeSinrOutputTraceContainer::Reset ()
-{
-  NS_LOG_FUNCTION (this);
-
-  if (!m_container.empty ())
-    {
-      WriteToFile ();
-
-      m_container.clear ();
-    }
-  m_enableFigureOutput = true;
+  SatBaseOutputTraceContainer::DoDispose ();
 }
 
 Ptr<SatOutputFileStreamDoubleContainer>
@@ -125,21 +111,6 @@ SatCompositeSinrOutputTraceContainer::AddNode (key_t key)
     }
 }
 
-Ptr<SatOutputFileStreamDoubleContainer>
-SatCompositeSinrOutputTraceContainer::FindNode (key_t key)
-{
-  NS_LOG_FUNCTION (this);
-
-  container_t::iterator iter = m_container.find (key);
-
-  if (iter == m_container.end ())
-    {
-      return AddNode (key);
-    }
-
-  return iter->second;
-}
-
 void
 SatCompositeSinrOutputTraceContainer::WriteToFile ()
 {
@@ -162,22 +133,4 @@ SatCompositeSinrOutputTraceContainer::WriteToFile ()
     }
 }
 
-void
-SatCompositeSinrOutputTraceContainer::AddToContainer (key_t key, std::vector<double> newItem)
-{
-  NS_LOG_FUNCTION (this);
-
-  if (newItem.size () != SatBaseTraceContainer::CSINR_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
-    {
-      NS_FATAL_ERROR ("SatCompositeSinrOutputTraceContainer::AddToContainer - Incorrect vector size");
-    }
-
-  Ptr<SatOutputFileStreamDoubleContainer> node = FindNode (key);
-
-  if (node != NULL)
-    {
-      node->AddToContainer (newItem);
-    }
-}
-
 } // namespace ns3
@@ -142,18 +142,42 @@ SatControlMessage::GetTypeId (void)
 
 NS_OBJECT_ENSURE_REGISTERED (SatTbtpMessage);
 
+SatTimeSlotArena::SatTimeSlotArena ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatTimeSlotArena::~SatTimeSlotArena ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+SatTimeSlotArena::AddTimeSlot (const SatTimeSlotConf &conf)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_timeSlots.push_back (conf);
+
+  return m_timeSlots.size () - 1;
+}
+
 SatTbtpMessage::SatTbtpMessage ( )
-  : m_superframeCounter (0),
+  : m_timeSlotArena (NULL),
+    m_superframeCounter (0),
     m_superframeSeqId (0),
-    m_assignmentFormat (0)
+    m_assignmentFormat (0),
+    m_emptyDaSlotContainer ()
 {
   NS_LOG_FUNCTION (this);
 }
 
 SatTbtpMessage::SatTbtpMessage ( uint8_t seqId )
-  : m_superframeCounter (0),
+  : m_timeSlotArena (NULL),
+    m_superframeCounter (0),
     m_superframeSeqId (seqId),
-    m_assignmentFormat (0)
+    m_assignmentFormat (0),
+    m_emptyDaSlotContainer ()
 {
   NS_LOG_FUNCTION (this << (uint32_t) seqId);
 }
@@ -164,6 +188,7 @@ SatTbtpMessage::~SatTbtpMessage ()
 
   m_frameIds.clear ();
   m_daTimeSlots.clear ();
+  m_timeSlotArena = NULL;
 }
 
 TypeId
@@ -190,7 +215,7 @@ SatTbtpMessage::GetInstanceTypeId (void) const
 }
 
 const SatTbtpMessage::DaTimeSlotInfoItem_t&
-SatTbtpMessage::GetDaTimeslots (Address utId)
+SatTbtpMessage::GetDaTimeslots (Address utId) const
 {
   NS_LOG_FUNCTION (this << utId);
 
@@ -204,10 +229,23 @@ SatTbtpMessage::GetDaTimeslots (Address utId)
   return m_emptyDaSlotContainer;
 }
 
+const SatTimeSlotConf &
+SatTbtpMessage::GetDaTimeslot (const DaTimeSlotInfoItem_t &info, uint32_t index) const
+{
+  NS_LOG_FUNCTION (this << index);
+
+  if ( index >= info.m_slotCount )
+    {
+      NS_FATAL_ERROR ("Time slot index out of the range of the UT!!!");
+    }
+
+  return m_timeSlotArena->GetTimeSlot (info.m_firstSlot + index);
+}
+
 void
-SatTbtpMessage::SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSlotConf> conf)
+SatTbtpMessage::SetDaTimeslot (Mac48Address utId, uint8_t frameId, const SatTimeSlotConf &conf)
 {
-  NS_LOG_FUNCTION (this << utId << frameId << conf);
+  NS_LOG_FUNCTION (this << utId << (uint32_t) frameId);
 
   // find container for the UT from map
   DaTimeSlotMap_t::iterator it = m_daTimeSlots.find (utId);
@@ -216,7 +254,7 @@ SatTbtpMessage::SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSl
   // otherwise use container found from map
   if ( it == m_daTimeSlots.end () )
     {
-      std::pair<DaTimeSlotMap_t::iterator, bool> result = m_daTimeSlots.insert (std::make_pair (utId, DaTimeSlotInfoItem_t ()));
+      std::pair<DaTimeSlotMap_t::iterator, bool> result = m_daTimeSlots.insert (std::make_pair (utId, m_emptyDaSlotContainer));
 
       if ( result.second )
         {
@@ -229,14 +267,51 @@ SatTbtpMessage::SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSl
         }
     }
 
-  // store time slot info to user specific container
-  it->second.first = frameId;
-  it->second.second.push_back ( conf  );
+  // store time slot to the arena, the slots of the UT shall be consecutive in the arena
+  uint32_t index = GetTimeSlotArena ()->AddTimeSlot (conf);
+
+  if ( it->second.m_slotCount == 0 )
+    {
+      it->second.m_firstSlot = index;
+    }
+  else if ( it->second.m_firstSlot + it->second.m_slotCount != index )
+    {
+      NS_FATAL_ERROR ("Time slots of UT " << utId << " not set consecutively!!!");
+    }
+
+  it->second.m_frameId = frameId;
+  it->second.m_slotCount++;
 
   // store frame ID to keep track of the used frames count
   m_frameIds.insert (frameId);
 }
 
+Ptr<SatTimeSlotArena>
+SatTbtpMessage::GetTimeSlotArena ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if ( m_timeSlotArena == NULL )
+    {
+      m_timeSlotArena = Create<SatTimeSlotArena> ();
+    }
+
+  return m_timeSlotArena;
+}
+
+void
+SatTbtpMessage::SetTimeSlotArena (Ptr<SatTimeSlotArena> arena)
+{
+  NS_LOG_FUNCTION (this << arena);
+
+  if ( !m_daTimeSlots.empty () )
+    {
+      NS_FATAL_ERROR ("Time slot arena shall be set before the time slots!!!");
+    }
+
+  m_timeSlotArena = arena;
+}
+
 const SatTbtpMessage::RaChannelInfoContainer_t
 SatTbtpMessage::GetRaChannels () const
 {
@@ -342,7 +417,7 @@ uint32_t SatTbtpMessage::GetSizeInBytes () const
   // add size of DA time slots
   for (DaTimeSlotMap_t::const_iterator it = m_daTimeSlots.begin (); it != m_daTimeSlots.end (); it++ )
     {
-      sizeInBytes += (it->second.second.size () * assignmentIdSizeInBytes);
+      sizeInBytes += (it->second.m_slotCount * assignmentIdSizeInBytes);
     }
 
   // add size of RA time slots
@@ -366,8 +441,8 @@ void SatTbtpMessage::Dump () const
        ++mit)
     {
       std::cout << "UT: " << mit->first << ": ";
-      std::cout << "Frame ID: " << mit->second.first << ": ";
-      std::cout << mit->second.second.size () << " ";
+      std::cout << "Frame ID: " << (uint32_t) mit->second.m_frameId << ": ";
+      std::cout << mit->second.m_slotCount << " ";
       std::cout << std::endl;
     }
 
@@ -181,6 +181,61 @@ public:
 private:
 };
 
+/**
+ * \ingroup satellite
+ * \brief Arena of the DA time slots of the TBTP messages of one superframe.
+ *
+ * The time slots are stored by value in one block, which the TBTP messages of
+ * the superframe share. The TBTP messages reference ranges of the block, so that
+ * no time slot is allocated individually, and the block is released at once when
+ * the last holder of the TBTP messages of the superframe releases them.
+ */
+class SatTimeSlotArena : public SimpleRefCount<SatTimeSlotArena>
+{
+public:
+  /**
+   * Constructor for SatTimeSlotArena
+   */
+  SatTimeSlotArena ();
+
+  /**
+   * Destructor for SatTimeSlotArena
+   */
+  ~SatTimeSlotArena ();
+
+  /**
+   * Add a time slot to the arena.
+   *
+   * \param conf Time slot configuration
+   * \return Index of the time slot in the arena
+   */
+  uint32_t AddTimeSlot (const SatTimeSlotConf &conf);
+
+  /**
+   * Get a time slot from the arena.
+   *
+   * \param index Index of the time slot in the arena
+   * \return Time slot configuration
+   */
+  inline const SatTimeSlotConf & GetTimeSlot (uint32_t index) const
+  {
+    return m_timeSlots[index];
+  }
+
+  /**
+   * Get the number of the time slots in the arena.
+   *
+   * \return Number of the time slots
+   */
+  inline uint32_t GetTimeSlotCount () const
+  {
+    return m_timeSlots.size ();
+  }
+
+private:
+  std::vector<SatTimeSlotConf> m_timeSlots;
+};
+
 /**
  * \ingroup satellite
  * \brief The packet for the Terminal Burst Time Plan (TBTP) messages.
@@ -193,18 +248,18 @@ private:
 class SatTbtpMessage : public SatControlMessage
 {
 public:
-  /**
-   * Container for time slot configurations in time slot map item DaTimeSlotMapItem_t.
-   */
-  typedef std::vector< Ptr<SatTimeSlotConf> >  DaTimeSlotConfContainer_t;
-
   /**
    * Item for DA time slot information.
    *
-   * Stored information is pair, which member first holds frame id
-   * of the time slots and member second holds container of time slot configurations.
+   * Stored information is frame id of the time slots and the range of
+   * the time slots of the UT in the time slot arena of the message.
    */
-  typedef std::pair<uint8_t, DaTimeSlotConfContainer_t>  DaTimeSlotInfoItem_t;
+  typedef struct
+  {
+    uint8_t m_frameId;
+    uint32_t m_firstSlot;
+    uint32_t m_slotCount;
+  } DaTimeSlotInfoItem_t;
 
   /**
    * Container for RA channel information
@@ -320,18 +375,44 @@ public:
    * Get the information of the DA time slots.
    *
    * \param utId  id of the UT which time slot information is requested
-   * \return vector containing DA time slot info
+   * \return DA time slot info, the slot count of which is zero, if the UT has no time slots
    */
-  const DaTimeSlotInfoItem_t& GetDaTimeslots (Address utId);
+  const DaTimeSlotInfoItem_t& GetDaTimeslots (Address utId) const;
 
   /**
-   * Set a DA time slot information
+   * Get a DA time slot of a UT.
+   *
+   * \param info DA time slot info of the UT got with GetDaTimeslots
+   * \param index Index of the time slot among the time slots of the UT
+   * \return Time slot configuration
+   */
+  const SatTimeSlotConf & GetDaTimeslot (const DaTimeSlotInfoItem_t &info, uint32_t index) const;
+
+  /**
+   * Set a DA time slot information. The time slots of a UT shall be set
+   * consecutively, and the time slot is copied to the time slot arena.
    *
    * \param utId id of the UT which time slot information is set
    * \param frameId Frame ID of the time slot
-   * \param conf Pointer to time slot configuration
+   * \param conf Time slot configuration
+   */
+  void SetDaTimeslot (Mac48Address utId, uint8_t frameId, const SatTimeSlotConf &conf);
+
+  /**
+   * Get the arena of the DA time slots of the message. The arena is created,
+   * if not set before.
+   *
+   * \return Time slot arena
+   */
+  Ptr<SatTimeSlotArena> GetTimeSlotArena ();
+
+  /**
+   * Set the arena for the DA time slots of the message. The messages of
+   * the same superframe share the arena. Shall be set before any time slot.
+   *
+   * \param arena Time slot arena
    */
-  void SetDaTimeslot (Mac48Address utId, uint8_t frameId, Ptr<SatTimeSlotConf> conf);
+  void SetTimeSlotArena (Ptr<SatTimeSlotArena> arena);
 
   /**
    * Get the information of the RA channels.
@@ -373,6 +454,7 @@ private:
   typedef std::map<Address, DaTimeSlotInfoItem_t > DaTimeSlotMap_t;
 
   DaTimeSlotMap_t   m_daTimeSlots;
+  Ptr<SatTimeSlotArena> m_timeSlotArena;
   RaChannelMap_t    m_raChannels;
   uint32_t          m_superframeCounter;
   uint8_t           m_superframeSeqId;
@@ -0,0 +1,357 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Sami Rantanen <sami.rantanen@magister.fi>
+ */
+
+#include <algorithm>
+
+#include "ns3/log.h"
+#include "satellite-const-variables.h"
+#include "satellite-enums.h"
+#include "satellite-dama-table.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatDamaTable");
+
+namespace ns3 {
+
+
+SatDamaTable::SatDamaTable ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatDamaTable::~SatDamaTable ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+SatDamaTable::AddUt (Ptr<SatLowerLayerServiceConf> llsConf, Ptr<SatCnoEstimator> cnoEstimator)
+{
+  NS_LOG_FUNCTION (this << llsConf << cnoEstimator);
+
+  uint32_t utIndex = m_rcCounts.size ();
+  uint8_t rcCount = llsConf->GetDaServiceCount ();
+
+  m_firstRcPositions.push_back (m_craInKbps.size ());
+  m_rcCounts.push_back (rcCount);
+  m_dynamicRatePersistenceLimits.push_back (llsConf->GetDynamicRatePersistence ());
+  m_dynamicRatePersistences.push_back (0);
+  m_volumeBacklogPersistenceLimits.push_back (llsConf->GetVolumeBacklogPersistence ());
+  m_volumeBacklogPersistences.push_back (0);
+  m_rbdcCrsReceived.push_back (false);
+  m_cnoEstimators.push_back (cnoEstimator);
+
+  for (uint8_t i = 0; i < rcCount; i++)
+    {
+      uint16_t cra (0);
+
+      if (llsConf->GetDaConstantAssignmentProvided (i))
+        {
+          cra = llsConf->GetDaConstantServiceRateInKbps (i);
+        }
+
+      uint16_t minRbdc (0);
+
+      if (llsConf->GetDaRbdcAllowed (i))
+        {
+          minRbdc = std::max<uint16_t> (llsConf->GetDaMinimumServiceRateInKbps (i), cra);
+        }
+
+      m_rbdcAllowed.push_back (llsConf->GetDaRbdcAllowed (i));
+      m_volumeAllowed.push_back (llsConf->GetDaVolumeAllowed (i));
+      m_craInKbps.push_back (cra);
+      m_minRbdcInKbps.push_back (minRbdc);
+      m_maxServiceRateInKbps.push_back (llsConf->GetDaMaximumServiceRateInKbps (i));
+      m_maxRbdcInKbps.push_back (std::max<double> ( 0.0, (llsConf->GetDaMaximumServiceRateInKbps (i) - llsConf->GetDaConstantServiceRateInKbps (i))));
+      m_maxBacklogInBytes.push_back (SatConstVariables::BYTES_IN_KBYTE * llsConf->GetDaMaximumBacklogInKbytes (i));
+
+      m_dynamicRateRequestedInKbps.push_back (0);
+      m_volumeBacklogRequestedInBytes.push_back (0);
+      m_rbdcCrReceived.push_back (false);
+      m_rbdcCrSumInKbps.push_back (0);
+    }
+
+  return utIndex;
+}
+
+uint8_t
+SatDamaTable::GetRcCount (uint32_t utIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex);
+
+  NS_ASSERT (utIndex < m_rcCounts.size ());
+
+  return m_rcCounts[utIndex];
+}
+
+uint32_t
+SatDamaTable::GetMinRateBasedBytes (uint32_t utIndex, Time duration) const
+{
+  NS_LOG_FUNCTION (this << utIndex << duration);
+
+  uint32_t totalBytes = 0;
+
+  for ( uint8_t i = 0; i < GetRcCount (utIndex); i++)
+    {
+      uint32_t position = GetRcPosition (utIndex, i);
+      uint16_t minRateInKbps = m_rbdcAllowed[position] ? m_minRbdcInKbps[position] : m_craInKbps[position];
+
+      totalBytes += (SatConstVariables::BITS_IN_KBIT * minRateInKbps * duration.GetSeconds ()) / (double)(SatConstVariables::BITS_PER_BYTE);
+    }
+
+  return totalBytes;
+}
+
+uint16_t
+SatDamaTable::GetCraInKbps (uint32_t utIndex, uint8_t rcIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex);
+
+  return m_craInKbps[GetRcPosition (utIndex, rcIndex)];
+}
+
+uint16_t
+SatDamaTable::GetMinRbdcInKbps (uint32_t utIndex, uint8_t rcIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex);
+
+  uint16_t minRbdc (0);
+
+  if (m_dynamicRatePersistences[utIndex] > 0)
+    {
+      minRbdc = m_minRbdcInKbps[GetRcPosition (utIndex, rcIndex)];
+    }
+
+  return minRbdc;
+}
+
+uint16_t
+SatDamaTable::GetRbdcInKbps (uint32_t utIndex, uint8_t rcIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex);
+
+  return m_dynamicRateRequestedInKbps[GetRcPosition (utIndex, rcIndex)];
+}
+
+uint32_t
+SatDamaTable::GetVbdcInBytes (uint32_t utIndex, uint8_t rcIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex);
+
+  return m_volumeBacklogRequestedInBytes[GetRcPosition (utIndex, rcIndex)];
+}
+
+void
+SatDamaTable::SetVbdcInBytes (uint32_t utIndex, uint8_t rcIndex, uint32_t volumeInBytes)
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex << volumeInBytes);
+
+  uint32_t position = GetRcPosition (utIndex, rcIndex);
+
+  if ( m_volumeAllowed[position] )
+    {
+      NS_LOG_INFO ("Set VBDC bytes to " << volumeInBytes << " for UT index: " << utIndex << " RC index: " << (uint32_t) rcIndex);
+
+      m_volumeBacklogRequestedInBytes[position] = std::min (volumeInBytes, m_maxBacklogInBytes[position]);
+    }
+}
+
+void
+SatDamaTable::ReceiveCr (uint32_t utIndex, const SatCrMessage::RequestContainer_t &crContent)
+{
+  NS_LOG_FUNCTION (this << utIndex);
+
+  for ( SatCrMessage::RequestContainer_t::const_iterator descriptorIt = crContent.begin (); descriptorIt != crContent.end (); descriptorIt++ )
+    {
+      uint8_t rcIndex = descriptorIt->first.first;
+
+      switch (descriptorIt->first.second)
+        {
+        case SatEnums::DA_RBDC:
+          {
+            // RBDC requests are summed up per RC until the next scheduling round
+            uint32_t position = GetRcPosition (utIndex, rcIndex);
+
+            m_rbdcCrSumInKbps[position] += descriptorIt->second;
+            m_rbdcCrReceived[position] = true;
+            m_rbdcCrsReceived[utIndex] = true;
+            break;
+          }
+
+        case SatEnums::DA_VBDC:
+          {
+            m_volumeBacklogPersistences[utIndex] = m_volumeBacklogPersistenceLimits[utIndex];
+            UpdateVbdcInBytes (utIndex, rcIndex, descriptorIt->second);
+            break;
+          }
+
+        case SatEnums::DA_AVBDC:
+          {
+            m_volumeBacklogPersistences[utIndex] = m_volumeBacklogPersistenceLimits[utIndex];
+            SetVbdcInBytes (utIndex, rcIndex, descriptorIt->second);
+            break;
+          }
+
+        default:
+          break;
+        }
+    }
+}
+
+void
+SatDamaTable::UpdateRbdcFromCrs ()
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t ut = 0; ut < m_rcCounts.size (); ut++)
+    {
+      if (!m_rbdcCrsReceived[ut])
+        {
+          continue;
+        }
+
+      m_dynamicRatePersistences[ut] = m_dynamicRatePersistenceLimits[ut];
+
+      for (uint8_t i = 0; i < m_rcCounts[ut]; i++)
+        {
+          uint32_t position = m_firstRcPositions[ut] + i;
+
+          if (m_rbdcCrReceived[position])
+            {
+              UpdateRbdcInKbps (ut, i, m_rbdcCrSumInKbps[position]);
+
+              m_rbdcCrReceived[position] = false;
+              m_rbdcCrSumInKbps[position] = 0;
+            }
+        }
+
+      m_rbdcCrsReceived[ut] = false;
+    }
+}
+
+void
+SatDamaTable::DecrementPersistences ()
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t ut = 0; ut < m_rcCounts.size (); ut++)
+    {
+      std::vector<uint16_t>::iterator rbdcBegin = m_dynamicRateRequestedInKbps.begin () + m_firstRcPositions[ut];
+      std::vector<uint32_t>::iterator vbdcBegin = m_volumeBacklogRequestedInBytes.begin () + m_firstRcPositions[ut];
+
+      if ( m_dynamicRatePersistences[ut] > 0)
+        {
+          m_dynamicRatePersistences[ut]--;
+        }
+
+      if (m_dynamicRatePersistences[ut] == 0)
+        {
+          std::fill (rbdcBegin, rbdcBegin + m_rcCounts[ut], 0);
+        }
+
+      if ( m_volumeBacklogPersistences[ut] > 0)
+        {
+          m_volumeBacklogPersistences[ut]--;
+        }
+
+      if (m_volumeBacklogPersistences[ut] == 0)
+        {
+          std::fill (vbdcBegin, vbdcBegin + m_rcCounts[ut], 0);
+        }
+    }
+}
+
+void
+SatDamaTable::AddCnoSample (uint32_t utIndex, double sample)
+{
+  NS_LOG_FUNCTION (this << utIndex << sample);
+
+  NS_ASSERT (utIndex < m_cnoEstimators.size ());
+
+  m_cnoEstimators[utIndex]->AddSample (sample);
+}
+
+double
+SatDamaTable::GetCnoEstimation (uint32_t utIndex) const
+{
+  NS_LOG_FUNCTION (this << utIndex);
+
+  NS_ASSERT (utIndex < m_cnoEstimators.size ());
+
+  return m_cnoEstimators[utIndex]->GetCnoEstimation ();
+}
+
+uint32_t
+SatDamaTable::GetRcPosition (uint32_t utIndex, uint8_t rcIndex) const
+{
+  NS_ASSERT (utIndex < m_rcCounts.size ());
+
+  if ( rcIndex >= m_rcCounts[utIndex])
+    {
+      NS_FATAL_ERROR ("RC index requested is out of range!!!");
+    }
+
+  return m_firstRcPositions[utIndex] + rcIndex;
+}
+
+void
+SatDamaTable::UpdateRbdcInKbps (uint32_t utIndex, uint8_t rcIndex, uint16_t rateInKbps)
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex << rateInKbps);
+
+  uint32_t position = GetRcPosition (utIndex, rcIndex);
+
+  if ( m_rbdcAllowed[position] )
+    {
+      double craRbdcSum = m_craInKbps[position] + rateInKbps;
+      uint16_t minRbdc = GetMinRbdcInKbps (utIndex, rcIndex);
+
+      if (craRbdcSum < minRbdc )
+        {
+          m_dynamicRateRequestedInKbps[position] = minRbdc - m_craInKbps[position];
+        }
+      else if (craRbdcSum > m_maxServiceRateInKbps[position])
+        {
+          m_dynamicRateRequestedInKbps[position] = m_maxRbdcInKbps[position];
+        }
+      else
+        {
+          m_dynamicRateRequestedInKbps[position] = rateInKbps;
+        }
+    }
+}
+
+void
+SatDamaTable::UpdateVbdcInBytes (uint32_t utIndex, uint8_t rcIndex, uint32_t volumeInBytes)
+{
+  NS_LOG_FUNCTION (this << utIndex << (uint32_t) rcIndex << volumeInBytes);
+
+  uint32_t position = GetRcPosition (utIndex, rcIndex);
+
+  if ( m_volumeAllowed[position] )
+    {
+      NS_LOG_INFO ("Update VBDC! UT index: " << utIndex << " RC index: " << (uint32_t) rcIndex <<
+                    " existing VBDC bytes: " << m_volumeBacklogRequestedInBytes[position] <<
+                    " updated with " << volumeInBytes << " bytes!");
+
+      SetVbdcInBytes (utIndex, rcIndex, m_volumeBacklogRequestedInBytes[position] + volumeInBytes);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Sami Rantanen <sami.rantanen@magister.fi>
+ */
+
+#ifndef SATELLITE_DAMA_TABLE_H
+#define SATELLITE_DAMA_TABLE_H
+
+#include <vector>
+
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "satellite-lower-layer-service.h"
+#include "satellite-control-message.h"
+#include "satellite-cno-estimator.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ * \brief class for module SatDamaTable.
+ *
+ * This SatDamaTable class holds the DAMA state of all the UTs of a beam.
+ * It is created and used by the beam scheduler of the NCC.
+ *
+ * The UTs are identified by a dense UT index given when the UT is added,
+ * and the state is stored column by column: one array per UT for the
+ * per UT state (persistence counters, C/N0 estimators) and one array per
+ * RC of all the UTs for the per RC state (configured rates, RBDC and VBDC
+ * requests). The RCs of a UT are consecutive in the per RC arrays. This way
+ * the per superframe updates are tight loops over the arrays.
+ *
+ * The received capacity requests are decoded to the table when they are
+ * received. VBDC and AVBDC requests are applied immediately, whereas the
+ * RBDC requests received within a superframe are summed up per RC and
+ * applied by UpdateRbdcFromCrs at the beginning of the scheduling.
+ */
+class SatDamaTable
+{
+public:
+  /**
+   * Construct an empty SatDamaTable.
+   */
+  SatDamaTable ();
+
+  /**
+   * Destroy a SatDamaTable
+   *
+   * This is the destructor for the SatDamaTable.
+   */
+  ~SatDamaTable ();
+
+  /**
+   * Add a UT to the table.
+   *
+   * \param llsConf Lower layer service configuration of the UT.
+   * \param cnoEstimator C/N0 estimator of the UT.
+   * \return Index of the UT in the table.
+   */
+  uint32_t AddUt (Ptr<SatLowerLayerServiceConf> llsConf, Ptr<SatCnoEstimator> cnoEstimator);
+
+  /**
+   * Get number of UTs in the table.
+   *
+   * \return Number of UTs in the table.
+   */
+  inline uint32_t GetUtCount () const
+  {
+    return m_rcCounts.size ();
+  }
+
+  /**
+   * Get number of RCs of a UT.
+   *
+   * \param utIndex Index of the UT.
+   * \return Number of RCs of the UT.
+   */
+  uint8_t GetRcCount (uint32_t utIndex) const;
+
+  /**
+   * Get minimum rate based bytes of a UT with given duration.
+   *
+   * \param utIndex Index of the UT.
+   * \param duration Duration of the transmission
+   * \return Rate based bytes with given duration.
+   */
+  uint32_t GetMinRateBasedBytes (uint32_t utIndex, Time duration) const;
+
+  /**
+   * Get configured value of the CRA.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which CRA is requested.
+   * \return Configured value of the CRA requested [kBps].
+   */
+  uint16_t GetCraInKbps (uint32_t utIndex, uint8_t rcIndex) const;
+
+  /**
+   * Get configured value of the minimum RBDC.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which minimum RBDC is requested.
+   * \return Configured value of the minimum RBDC requested [kBps].
+   */
+  uint16_t GetMinRbdcInKbps (uint32_t utIndex, uint8_t rcIndex) const;
+
+  /**
+   * Get current value of the RBDC requested.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which dynamic rate is requested.
+   * \return Current value of the RBDC requested [kBps].
+   */
+  uint16_t GetRbdcInKbps (uint32_t utIndex, uint8_t rcIndex) const;
+
+  /**
+   * Get current value of the VBDC requested.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which volume backlog is requested.
+   * \return Current value of the VBDC requested in bytes.
+   */
+  uint32_t GetVbdcInBytes (uint32_t utIndex, uint8_t rcIndex) const;
+
+  /**
+   * Set VBDC request of the RC.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which VBDC is updated.
+   * \param volumeInBytes VBDC value [bytes] to set
+   */
+  void SetVbdcInBytes (uint32_t utIndex, uint8_t rcIndex, uint32_t volumeInBytes);
+
+  /**
+   * Decode the content of a received CR message to the table.
+   *
+   * \param utIndex Index of the UT sending the CR.
+   * \param crContent Capacity request content of the CR message.
+   */
+  void ReceiveCr (uint32_t utIndex, const SatCrMessage::RequestContainer_t &crContent);
+
+  /**
+   * Update the RBDC requests of all the UTs with the RBDC requests
+   * received since the last update.
+   */
+  void UpdateRbdcFromCrs ();
+
+  /**
+   * Decrement the dynamic rate and volume backlog persistence of all the UTs.
+   */
+  void DecrementPersistences ();
+
+  /**
+   * Add C/N0 sample to the estimator of a UT.
+   *
+   * \param utIndex Index of the UT.
+   * \param sample C/N0 sample value to add.
+   */
+  void AddCnoSample (uint32_t utIndex, double sample);
+
+  /**
+   * Get estimated C/N0 value of a UT based on added samples.
+   *
+   * \param utIndex Index of the UT.
+   * \return C/N0 estimation.
+   */
+  double GetCnoEstimation (uint32_t utIndex) const;
+
+private:
+  /**
+   * Get the position of the RC of a UT in the per RC arrays.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of the RC.
+   * \return Position of the RC in the per RC arrays.
+   */
+  uint32_t GetRcPosition (uint32_t utIndex, uint8_t rcIndex) const;
+
+  /**
+   * Update RBDC request of a RC.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which dynamic rate is updated.
+   * \param rateInKbps RBDC [kBps] for update
+   */
+  void UpdateRbdcInKbps (uint32_t utIndex, uint8_t rcIndex, uint16_t rateInKbps);
+
+  /**
+   * Update VBDC request of the RC.
+   *
+   * \param utIndex Index of the UT.
+   * \param rcIndex Index of RC, which VBDC is updated.
+   * \param volumeInBytes VBDC value [bytes] for update
+   */
+  void UpdateVbdcInBytes (uint32_t utIndex, uint8_t rcIndex, uint32_t volumeInBytes);
+
+  // per UT state
+  std::vector<uint32_t>               m_firstRcPositions;
+  std::vector<uint8_t>                m_rcCounts;
+  std::vector<uint8_t>                m_dynamicRatePersistenceLimits;
+  std::vector<uint8_t>                m_dynamicRatePersistences;
+  std::vector<uint8_t>                m_volumeBacklogPersistenceLimits;
+  std::vector<uint8_t>                m_volumeBacklogPersistences;
+  std::vector<bool>                   m_rbdcCrsReceived;
+  std::vector<Ptr<SatCnoEstimator> >  m_cnoEstimators;
+
+  // per RC configuration
+  std::vector<bool>                   m_rbdcAllowed;
+  std::vector<bool>                   m_volumeAllowed;
+  std::vector<uint16_t>               m_craInKbps;
+  std::vector<uint16_t>               m_minRbdcInKbps;
+  std::vector<uint16_t>               m_maxServiceRateInKbps;
+  std::vector<uint16_t>               m_maxRbdcInKbps;
+  std::vector<uint32_t>               m_maxBacklogInBytes;
+
+  // per RC state
+  std::vector<uint16_t>               m_dynamicRateRequestedInKbps;
+  std::vector<uint32_t>               m_volumeBacklogRequestedInBytes;
+  std::vector<bool>                   m_rbdcCrReceived;
+  std::vector<uint16_t>               m_rbdcCrSumInKbps;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_DAMA_TABLE_H */
@@ -359,6 +359,17 @@ public:
     RX_PWR_INPUT_TRACE = 1,
   } RxPowerCalculationMode_t;
 
+  /**
+   * \enum RxFilterResult_t
+   * \brief Results of the receive filtering done before the Rx power calculation.
+   */
+  typedef enum
+  {
+    RX_FILTER_RECEIVE = 0,
+    RX_FILTER_INTERFERENCE_ONLY = 1,
+    RX_FILTER_DISCARD = 2,
+  } RxFilterResult_t;
+
   static inline std::string GetChannelTypeName (ChannelType_t channelType)
   {
     switch (channelType)
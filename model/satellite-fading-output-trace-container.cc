@@ -34,7 +34,7 @@ TypeId
 SatFadingOutputTraceContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatFadingOutputTraceContainer")
-    .SetParent<SatBaseTraceContainer> ()
+    .SetParent<SatBaseOutputTraceContainer> ()
     .AddConstructor<SatFadingOutputTraceContainer> ();
   return tid;
 }
@@ -48,7 +48,7 @@ SatFadingOutputTraceContainer::GetInstanceTypeId (void) const
 }
 
 SatFadingOutputTraceContainer::SatFadingOutputTraceContainer ()
-  : m_enableFigureOutput (true)
+  : SatBaseOutputTraceContainer (SatBaseTraceContainer::FADING_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -67,21 +67,7 @@ SatFadingOutputTraceContainer::DoDispose ()
 
   Reset ();
 
-  SatBaseTraceContainer::DoDispose ();
-}
-
-void
-SatFadingOutputTraceContainer::Reset ()
-{
-  NS_LOG_FUNCTION (this);
-
-  if (!m_container.empty ())
-    {
-      WriteToFile ();
-
-      m_container.clear ();
-    }
-  m_enableFigureOutput = true;
+  SatBaseOutputTraceContainer::DoDispose ();
 }
 
 Ptr<SatOutputFileStreamDoubleContainer>
@@ -125,21 +111,6 @@ SatFadingOutputTraceContainer::AddNode (key_t key)
     }
 }
 
-Ptr<SatOutputFileStreamDoubleContainer>
-SatFadingOutputTraceContainer::FindNode (key_t key)
-{
-  NS_LOG_FUNCTION (this);
-
-  container_t::iterator iter = m_container.find (key);
-
-  if (iter == m_container.end ())
-    {
-      return AddNode (key);
-    }
-
-  return iter->second;
-}
-
 void
 SatFadingOutputTraceContainer::WriteToFile ()
 {
@@ -162,22 +133,4 @@ SatFadingOutputTraceContainer::WriteToFile ()
     }
 }
 
-void
-SatFadingOutputTraceContainer::AddToContainer (key_t key, std::vector<double> newItem)
-{
-  NS_LOG_FUNCTION (this);
-
-  if (newItem.size () != SatBaseTraceContainer::FADING_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
-    {
-      NS_FATAL_ERROR ("SatFadingOutputTraceContainer::AddToContainer - Incorrect vector size");
-    }
-
-  Ptr<SatOutputFileStreamDoubleContainer> node = FindNode (key);
-
-  if (node != NULL)
-    {
-      node->AddToContainer (newItem);
-    }
-}
-
 } // namespace ns3
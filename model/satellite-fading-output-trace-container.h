@@ -20,9 +20,7 @@
 #ifndef SATELLITE_FADING_OUTPUT_TRACE_CONTAINER_H
 #define SATELLITE_FADING_OUTPUT_TRACE_CONTAINER_H
 
-#include "satellite-base-trace-container.h"
-#include "ns3/satellite-output-fstream-double-container.h"
-#include "satellite-enums.h"
+#include "satellite-base-output-trace-container.h"
 #include "ns3/mac48-address.h"
 
 namespace ns3 {
@@ -33,19 +31,9 @@ namespace ns3 {
  * \brief Class for fading output trace container. The class contains
  * multiple fading output sample traces and provides an interface to them.
  */
-class SatFadingOutputTraceContainer : public SatBaseTraceContainer
+class SatFadingOutputTraceContainer : public SatBaseOutputTraceContainer
 {
 public:
-  /**
-   * \brief typedef for map key
-   */
-  typedef std::pair<Address,SatEnums::ChannelType_t> key_t;
-
-  /**
-   * \brief typedef for map of containers
-   */
-  typedef std::map <key_t, Ptr<SatOutputFileStreamDoubleContainer> > container_t;
-
   /**
    * \brief Constructor
    */
@@ -73,56 +61,18 @@ public:
    */
   void DoDispose ();
 
-  /**
-   * \brief Add the vector containing the values to container matching the key
-   * \param key key
-   * \param newItem vector of values
-   */
-  void AddToContainer (key_t key, std::vector<double> newItem);
-
-  /**
-   * Function for enabling / disabling figure output
-   * \param enableFigureOutput
-   */
-  void EnableFigureOutput (bool enableFigureOutput)
-  {
-    m_enableFigureOutput = enableFigureOutput;
-  }
-
-  /**
-   * \brief Function for resetting the variables
-   */
-  void Reset ();
-
 private:
   /**
    * \brief Function for adding the node to the map
    * \param key key
    * \return pointer to the added container
    */
-  Ptr<SatOutputFileStreamDoubleContainer> AddNode (std::pair<Address,SatEnums::ChannelType_t> key);
-
-  /**
-   * \brief Function for finding the container matching the key
-   * \param key key
-   * \return matching container
-   */
-  Ptr<SatOutputFileStreamDoubleContainer> FindNode (key_t key);
+  Ptr<SatOutputFileStreamDoubleContainer> AddNode (key_t key);
 
   /**
    * \brief Write the contents of a container matching to the key into a file
    */
   void WriteToFile ();
-
-  /**
-   * \brief Map for containers
-   */
-  container_t m_container;
-
-  /**
-   * \brief Switch for figure output
-   */
-  bool m_enableFigureOutput;
 };
 
 } // namespace ns3
@@ -526,39 +526,40 @@ SatFrameAllocator::GenerateTimeSlots (SatFrameAllocator::TbtpMsgContainer_t& tbt
 
       while ( utSymbolsLeft > 0 )
         {
-          Ptr<SatTimeSlotConf> timeSlot = NULL;
+          SatTimeSlotConf timeSlot (Seconds (0), 0, 0, SatTimeSlotConf::SLOT_TYPE_TRC);
+          bool timeSlotCreated = false;
 
           // try to first create Control slot if present in request and is not already created
           // otherwise create TRC slot
           if ( (currentRcIndex == rcIndices.begin ()) && m_utAllocs[*it].m_request.m_ctrlSlotPresent
                && (m_utAllocs[*it].m_allocation.m_ctrlSlotPresent == false ))
             {
-              timeSlot = CreateCtrlTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, rcBasedAllocationEnabled );
+              timeSlotCreated = CreateCtrlTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, rcBasedAllocationEnabled, timeSlot );
 
               // if control slot creation fails try to allocate TRC slot,
               // this i because control and TRC slot may use different waveforms (different amount of symbols)
-              if ( timeSlot )
+              if ( timeSlotCreated )
                 {
                   m_utAllocs[*it].m_allocation.m_ctrlSlotPresent = true;
                 }
               else
                 {
-                  timeSlot = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
+                  timeSlotCreated = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled, timeSlot );
                 }
             }
           else
             {
-              timeSlot = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled );
+              timeSlotCreated = CreateTimeSlot (*currentCarrier, utSymbolsToUse, carrierSymbolsToUse, utSymbolsLeft, rcSymbolsLeft, m_utAllocs[*it].m_cno, rcBasedAllocationEnabled, timeSlot );
             }
 
           // if creation succeeded, add slot to TBTP and update allocation info container
-          if ( timeSlot )
+          if ( timeSlotCreated )
             {
               // trace first used wave form per UT
               if ( !waveformIdTraced )
                 {
                   waveformIdTraced = true;
-                  waveformTrace (timeSlot->GetWaveFormId ());
+                  waveformTrace (timeSlot.GetWaveFormId ());
                   utCount++;
                 }
 
@@ -567,7 +568,7 @@ SatFrameAllocator::GenerateTimeSlots (SatFrameAllocator::TbtpMsgContainer_t& tbt
                   tbtpToFill = CreateNewTbtp (tbtpContainer);
                 }
 
-              timeSlot->SetRcIndex (*currentRcIndex);
+              timeSlot.SetRcIndex (*currentRcIndex);
 
               if (timeslotCount > SatFrameConf::m_maxTimeSlotCount)
                 {
@@ -578,7 +579,7 @@ SatFrameAllocator::GenerateTimeSlots (SatFrameAllocator::TbtpMsgContainer_t& tbt
               timeslotCount++;
 
               // store needed information to UT allocation container
-              Ptr<SatWaveform> waveform = m_waveformConf->GetWaveform (timeSlot->GetWaveFormId ());
+              Ptr<SatWaveform> waveform = m_waveformConf->GetWaveform (timeSlot.GetWaveFormId ());
 
               UtAllocInfoContainer_t::iterator utAlloc = GetUtAllocItem (utAllocContainer, *it);
               utAlloc->second.first.at (*currentRcIndex) += waveform->GetPayloadInBytes ();
@@ -790,13 +791,14 @@ void SatFrameAllocator::ShareSymbols (bool fcaEnabled)
     }
 }
 
-Ptr<SatTimeSlotConf>
+bool
 SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
-                                   int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled)
+                                   int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled,
+                                   SatTimeSlotConf& timeSlotConf)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> timeSlotConf = NULL;
+  bool timeSlotCreated = false;
   int64_t symbolsToUse = std::min<int64_t> (carrierSymbolsToUse, utSymbolsToUse);
   uint32_t waveformId = 0;
   int64_t timeSlotSymbols = 0;
@@ -829,7 +831,9 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
         case SatSuperframeConf::CONFIG_TYPE_0:
           {
             uint16_t index = (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / timeSlotSymbols;
+            // the slot of the frame configuration is copied, since the RC index is set to the copy
             timeSlotConf = m_frameConf->GetTimeSlotConf (carrierId, index);
+            timeSlotCreated = true;
           }
           break;
 
@@ -837,7 +841,8 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
         case SatSuperframeConf::CONFIG_TYPE_2:
           {
             Time startTime = Seconds ( (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / m_frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
-            timeSlotConf = Create<SatTimeSlotConf> (startTime, waveformId, carrierId, SatTimeSlotConf::SLOT_TYPE_TRC);
+            timeSlotConf = SatTimeSlotConf (startTime, waveformId, carrierId, SatTimeSlotConf::SLOT_TYPE_TRC);
+            timeSlotCreated = true;
           }
           break;
 
@@ -847,7 +852,7 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
           break;
         }
 
-      if (timeSlotConf)
+      if (timeSlotCreated)
         {
           carrierSymbolsToUse -= timeSlotSymbols;
           utSymbolsToUse -= timeSlotSymbols;
@@ -865,16 +870,17 @@ SatFrameAllocator::CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse,
         }
     }
 
-  return timeSlotConf;
+  return timeSlotCreated;
 }
 
-Ptr<SatTimeSlotConf>
+bool
 SatFrameAllocator::CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse,
-                                       int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled)
+                                       int64_t& utSymbolsLeft, int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled,
+                                       SatTimeSlotConf& timeSlotConf)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> timeSlotConf = NULL;
+  bool timeSlotCreated = false;
   int64_t symbolsToUse = std::min<int64_t> (carrierSymbolsToUse, utSymbolsToUse);
 
   int64_t timeSlotSymbols = m_mostRobustWaveform->GetBurstLengthInSymbols ();
@@ -882,7 +888,8 @@ SatFrameAllocator::CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToU
   if ( timeSlotSymbols <= symbolsToUse )
     {
       Time startTime = Seconds ( (m_maxSymbolsPerCarrier - carrierSymbolsToUse) / m_frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
-      timeSlotConf = Create<SatTimeSlotConf> (startTime, m_mostRobustWaveform->GetWaveformId (), carrierId, SatTimeSlotConf::SLOT_TYPE_C);
+      timeSlotConf = SatTimeSlotConf (startTime, m_mostRobustWaveform->GetWaveformId (), carrierId, SatTimeSlotConf::SLOT_TYPE_C);
+      timeSlotCreated = true;
 
       carrierSymbolsToUse -= timeSlotSymbols;
       utSymbolsToUse -= timeSlotSymbols;
@@ -899,7 +906,7 @@ SatFrameAllocator::CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToU
       rcSymbolsLeft -= timeSlotSymbols;
     }
 
-  return timeSlotConf;
+  return timeSlotCreated;
 }
 
 uint32_t
@@ -1207,6 +1214,7 @@ SatFrameAllocator::CreateNewTbtp (TbtpMsgContainer_t& tbtpContainer)
 
   Ptr<SatTbtpMessage> newTbtp = CreateObject<SatTbtpMessage> (tbtpContainer.back ()->GetSuperframeSeqId ());
   newTbtp->SetSuperframeCounter ( tbtpContainer.back ()->GetSuperframeCounter ());
+  newTbtp->SetTimeSlotArena (tbtpContainer.back ()->GetTimeSlotArena ());
 
   tbtpContainer.push_back (newTbtp);
 
@@ -470,10 +470,11 @@ private:
    * \param rcSymbolsLeft Symbols left for RC
    * \param cno Estimated C/N0 of the UT.
    * \param rcBasedAllocationEnabled If time slot generated per RC
-   * \return Create time slot configuration
+   * \param timeSlotConf Variable to store the created time slot configuration
+   * \return true, if the time slot was created
    */
-  Ptr<SatTimeSlotConf> CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
-                                       int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled);
+  bool CreateTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
+                       int64_t& rcSymbolsLeft, double cno, bool rcBasedAllocationEnabled, SatTimeSlotConf& timeSlotConf);
 
   /**
    * Create control time slot.
@@ -484,10 +485,11 @@ private:
    * \param utSymbolsLeft Symbols left for the UT
    * \param rcSymbolsLeft Symbols left for RC
    * \param rcBasedAllocationEnabled If time slot generated per RC
-   * \return Create time slot configuration
+   * \param timeSlotConf Variable to store the created time slot configuration
+   * \return true, if the time slot was created
    */
-  Ptr<SatTimeSlotConf> CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
-                                           int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled);
+  bool CreateCtrlTimeSlot (uint16_t carrierId, int64_t& utSymbolsToUse, int64_t& carrierSymbolsToUse, int64_t& utSymbolsLeft,
+                           int64_t& rcSymbolsLeft, bool rcBasedAllocationEnabled, SatTimeSlotConf& timeSlotConf);
 
   /**
    * Update RC/CC requested according to carrier limit
@@ -538,7 +540,8 @@ private:
 
   /**
    *  Creates new TBTP to given container with information of the
-   *  last TBTP in container.
+   *  last TBTP in container. The new TBTP shares the time slot arena
+   *  of the last TBTP.
    *
    * \param tbtpContainer TBTP container
    * \return Pointer to created TBTP
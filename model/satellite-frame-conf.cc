@@ -112,7 +112,8 @@ SatFrameConf::SatFrameConf ()
     m_btuConf (0),
     m_carrierCount (0),
     m_maxSymbolsPerCarrier (0),
-    m_minPayloadPerCarrierInBytes (0)
+    m_minPayloadPerCarrierInBytes (0),
+    m_carrierTimeSlotCount (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -169,22 +170,20 @@ SatFrameConf::SatFrameConf ( double bandwidthHz, Time targetDuration, Ptr<SatBtu
       m_minPayloadPerCarrierInBytes = carrierSlotCount * waveform->GetPayloadInBytes ();
     }
 
-  uint32_t frameTimeSlotCount = 0;
+  if ( checkSlotLimit && ((m_carrierCount * carrierSlotCount) > m_maxTimeSlotCount) )
+    {
+      NS_FATAL_ERROR ("Time slot count is over limit. Check frame configuration!!!");
+    }
+
+  m_carrierTimeSlotCount = carrierSlotCount;
+  m_timeSlotConfs.reserve (m_carrierCount * carrierSlotCount);
 
   // Created time slots for every carrier and add them to frame configuration
   for (uint32_t i = 0; i < m_carrierCount; i++)
     {
       for (uint32_t j = 0; j < carrierSlotCount; j++)
         {
-          Ptr<SatTimeSlotConf> timeSlot = Create<SatTimeSlotConf> (Time (j * timeSlotDuration.GetInteger ()), defWaveFormId, i, SatTimeSlotConf::SLOT_TYPE_TRC);
-          AddTimeSlotConf (timeSlot);
-
-          frameTimeSlotCount++;
-
-          if ( checkSlotLimit && (frameTimeSlotCount > m_maxTimeSlotCount) )
-            {
-              NS_FATAL_ERROR ("Time slot count is over limit. Check frame configuration!!!");
-            }
+          m_timeSlotConfs.push_back (SatTimeSlotConf (Time (j * timeSlotDuration.GetInteger ()), defWaveFormId, i, SatTimeSlotConf::SLOT_TYPE_TRC));
         }
     }
 }
@@ -243,108 +242,48 @@ SatFrameConf::GetTimeSlotCount () const
 {
   NS_LOG_FUNCTION (this);
 
-  uint16_t slotCount = 0;
-
-  if ( m_timeSlotConfMap.empty () == false )
-    {
-      slotCount = m_timeSlotConfMap.size () * m_timeSlotConfMap.begin ()->second.size ();
-    }
-
-  return slotCount;
+  return m_timeSlotConfs.size ();
 }
 
-Ptr<SatTimeSlotConf>
+const SatTimeSlotConf &
 SatFrameConf::GetTimeSlotConf (uint16_t carrierId, uint16_t index) const
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> foundTimeSlot = NULL;
-
-  SatTimeSlotConfMap_t::const_iterator foundCarrier = m_timeSlotConfMap.find (carrierId);
-
-  if ( foundCarrier != m_timeSlotConfMap.end () && index < foundCarrier->second.size () )
-    {
-      foundTimeSlot = foundCarrier->second[index];
-    }
-  else
+  if ( carrierId >= m_carrierCount || index >= m_carrierTimeSlotCount )
     {
       NS_FATAL_ERROR ("Index is invalid!!!");
     }
 
-  return foundTimeSlot;
+  return m_timeSlotConfs[carrierId * m_carrierTimeSlotCount + index];
 }
 
-Ptr<SatTimeSlotConf>
+const SatTimeSlotConf &
 SatFrameConf::GetTimeSlotConf (uint16_t index) const
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<SatTimeSlotConf> foundTimeSlot = NULL;
-  uint32_t carrierId = index / m_timeSlotConfMap.begin ()->second.size ();
-  uint16_t timeSlotIndex = index % m_timeSlotConfMap.begin ()->second.size ();
-
-  foundTimeSlot = GetTimeSlotConf (carrierId, timeSlotIndex);
-
-  return foundTimeSlot;
-}
-
-SatFrameConf::SatTimeSlotConfContainer_t
-SatFrameConf::GetTimeSlotConfs (uint16_t carrierId) const
-{
-  NS_LOG_FUNCTION (this);
-
-  SatTimeSlotConfContainer_t timeSlots;
-
-  SatTimeSlotConfMap_t::const_iterator it = m_timeSlotConfMap.find (carrierId);
-
-  if ( it != m_timeSlotConfMap.end () )
-    {
-      timeSlots = it->second;
-    }
-  else
+  if ( index >= m_timeSlotConfs.size () )
     {
-      NS_FATAL_ERROR ("Carrier not found!!!");
+      NS_FATAL_ERROR ("Index is invalid!!!");
     }
 
-  return timeSlots;
+  return m_timeSlotConfs[index];
 }
 
-uint16_t
-SatFrameConf::AddTimeSlotConf (Ptr<SatTimeSlotConf> conf)
+SatFrameConf::SatTimeSlotConfRange_t
+SatFrameConf::GetTimeSlotConfs (uint16_t carrierId) const
 {
   NS_LOG_FUNCTION (this);
 
-  NS_LOG_FUNCTION (this << conf);
-
-  // find container for the Carrier from map
-  SatTimeSlotConfMap_t::iterator it = m_timeSlotConfMap.find (conf->GetCarrierId ());
-
-  // If not found, add new Carrier container to map,
-  // otherwise use container found from map
-  if ( it == m_timeSlotConfMap.end () )
+  if ( carrierId >= m_carrierCount )
     {
-      std::pair<SatTimeSlotConfMap_t::iterator, bool> result = m_timeSlotConfMap.insert (std::make_pair (conf->GetCarrierId (), SatTimeSlotConfContainer_t ()));
-
-      if ( result.second )
-        {
-          it = result.first;
-        }
-      else
-        {
-          it = m_timeSlotConfMap.end ();
-        }
-    }
-
-  // container creation for carrier has failed, so we need to crash
-  if (it == m_timeSlotConfMap.end ())
-    {
-      NS_FATAL_ERROR ("Cannot insert slot to container!!!");
+      NS_FATAL_ERROR ("Carrier not found!!!");
     }
 
-  // store time slot info to carrier specific container
-  it->second.push_back (conf);
+  SatTimeSlotConfIterator_t first = m_timeSlotConfs.begin () + carrierId * m_carrierTimeSlotCount;
 
-  return 0;
+  return std::make_pair (first, first + m_carrierTimeSlotCount);
 }
 
 NS_OBJECT_ENSURE_REGISTERED (SatSuperframeConf);
@@ -738,30 +677,24 @@ SatSuperframeConf::Configure (double allocatedBandwidthHz, Time targetDuration,
     }
 }
 
-SatFrameConf::SatTimeSlotConfContainer_t
-SatSuperframeConf::GetRaSlots (uint8_t raChannel)
+SatFrameConf::SatTimeSlotConfRange_t
+SatSuperframeConf::GetRaSlots (uint8_t raChannel) const
 {
   NS_LOG_FUNCTION (this);
 
-  SatFrameConf::SatTimeSlotConfContainer_t timeSlots;
-
-  if ( raChannel < m_raChannels.size ())
-    {
-      uint8_t frameId = m_raChannels[raChannel].first;
-      uint32_t carrierId = m_raChannels[raChannel].second;
-
-      timeSlots = m_frames[frameId]->GetTimeSlotConfs (carrierId);
-    }
-  else
+  if ( raChannel >= m_raChannels.size ())
     {
       NS_FATAL_ERROR ("Channel out of range!!!");
     }
 
-  return timeSlots;
+  uint8_t frameId = m_raChannels[raChannel].first;
+  uint32_t carrierId = m_raChannels[raChannel].second;
+
+  return m_frames[frameId]->GetTimeSlotConfs (carrierId);
 }
 
 uint16_t
-SatSuperframeConf::GetRaSlotCount (uint8_t raChannel)
+SatSuperframeConf::GetRaSlotCount (uint8_t raChannel) const
 {
   NS_LOG_FUNCTION (this);
 
@@ -770,9 +703,8 @@ SatSuperframeConf::GetRaSlotCount (uint8_t raChannel)
   if ( raChannel < m_raChannels.size ())
     {
       uint8_t frameId = m_raChannels[raChannel].first;
-      uint32_t carrierId = m_raChannels[raChannel].second;
 
-      slotCount = m_frames[frameId]->GetTimeSlotConfs (carrierId).size ();
+      slotCount = m_frames[frameId]->GetCarrierTimeSlotCount ();
     }
   else
     {
@@ -818,8 +750,8 @@ SatSuperframeConf::GetRaChannelTimeSlotPayloadInBytes (uint8_t raChannel) const
   if ( raChannel < m_raChannels.size ())
     {
       uint8_t frameId = m_raChannels[raChannel].first;
-      Ptr<SatTimeSlotConf> timeSlotConf = (*m_frames[frameId]->GetTimeSlotConfs (0).begin ());
-      Ptr<SatWaveform> waveform = m_frames[frameId]->GetWaveformConf ()->GetWaveform ( timeSlotConf->GetWaveFormId ());
+      const SatTimeSlotConf &timeSlotConf = m_frames[frameId]->GetTimeSlotConf (0, 0);
+      Ptr<SatWaveform> waveform = m_frames[frameId]->GetWaveformConf ()->GetWaveform ( timeSlotConf.GetWaveFormId ());
 
       payloadInBytes = waveform->GetPayloadInBytes ();
     }
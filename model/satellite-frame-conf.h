@@ -190,7 +190,7 @@ public:
    *
    * \return RC index of the time slot.
    */
-  inline uint8_t GetRcIndex ()
+  inline uint8_t GetRcIndex () const
   {
     return m_rcIndex;
   }
@@ -236,7 +236,17 @@ public:
   /**
    * Define type SatTimeSlotConfContainer_t
    */
-  typedef std::vector<Ptr<SatTimeSlotConf> > SatTimeSlotConfContainer_t;
+  typedef std::vector<SatTimeSlotConf> SatTimeSlotConfContainer_t;
+
+  /**
+   * Define type SatTimeSlotConfIterator_t
+   */
+  typedef SatTimeSlotConfContainer_t::const_iterator SatTimeSlotConfIterator_t;
+
+  /**
+   * Define type SatTimeSlotConfRange_t, first = begin of the range, second = end of the range
+   */
+  typedef std::pair<SatTimeSlotConfIterator_t, SatTimeSlotConfIterator_t> SatTimeSlotConfRange_t;
 
   static const uint16_t m_maxTimeSlotCount = SatConstVariables::MAXIMUM_TIME_SLOT_ID + 1;
 
@@ -270,7 +280,7 @@ public:
    * \param index Id of the time slot requested in frame.
    * \return      The requested time slot configuration of frame.
    */
-  Ptr<SatTimeSlotConf> GetTimeSlotConf (uint16_t index) const;
+  const SatTimeSlotConf & GetTimeSlotConf (uint16_t index) const;
 
   /**
    * Get time slot conf of the frame. Possible values for id are from 0 to Carrier count - 1.
@@ -279,7 +289,7 @@ public:
    * \param index Id of the time slot requested in the carrier of the frame.
    * \return The requested time slot configuration of frame.
   */
-  Ptr<SatTimeSlotConf> GetTimeSlotConf (uint16_t carrierId, uint16_t index) const;
+  const SatTimeSlotConf & GetTimeSlotConf (uint16_t carrierId, uint16_t index) const;
 
   /**
    * Get bandwidth of the frame.
@@ -351,7 +361,7 @@ public:
    *
    * \return The carrier count of the frame.
    */
-  inline uint16_t GetCarrierCount ()
+  inline uint16_t GetCarrierCount () const
   {
     return m_carrierCount;
   }
@@ -363,13 +373,23 @@ public:
    */
   uint16_t GetTimeSlotCount () const;
 
+  /**
+   * Get time slot count of a carrier of the frame.
+   *
+   * \return The time slot count of a carrier of the frame.
+   */
+  inline uint32_t GetCarrierTimeSlotCount () const
+  {
+    return m_carrierTimeSlotCount;
+  }
+
   /**
    * Get time slot of the specific carrier.
    *
    * \param carrierId Id of the carrier which time slots are requested.
-   * \return  Container containing time slots.
+   * \return  Range of the time slots of the carrier in the slot table of the frame.
    */
-  SatTimeSlotConfContainer_t GetTimeSlotConfs (uint16_t carrierId) const;
+  SatTimeSlotConfRange_t GetTimeSlotConfs (uint16_t carrierId) const;
 
   /**
    * Get state if frame is random access frame.
@@ -390,8 +410,6 @@ public:
   }
 
 private:
-  typedef std::map<uint16_t, SatTimeSlotConfContainer_t > SatTimeSlotConfMap_t; // key = carrier ID
-
   double    m_bandwidthHz;
   Time      m_duration;
   bool      m_isRandomAccess;
@@ -401,15 +419,14 @@ private:
   uint16_t              m_carrierCount;
   uint32_t              m_maxSymbolsPerCarrier;
   uint32_t              m_minPayloadPerCarrierInBytes;
-  SatTimeSlotConfMap_t  m_timeSlotConfMap;
+  uint32_t              m_carrierTimeSlotCount;
 
   /**
-   * Add time slot.
-   *
-   * \param conf  Time slot configuration added.
-   * \return ID of the added time slot.
+   * Time slots of the frame in carrier-major order, i.e. the slots of a carrier
+   * start from offset carrier ID * m_carrierTimeSlotCount. The table is not
+   * modified after the construction of the frame.
    */
-  uint16_t AddTimeSlotConf ( Ptr<SatTimeSlotConf> conf);
+  SatTimeSlotConfContainer_t  m_timeSlotConfs;
 };
 
 
@@ -594,7 +611,7 @@ public:
    * \param raChannel RA channel, which slot are requested
    * \return RA channel time slots
    */
-  SatFrameConf::SatTimeSlotConfContainer_t GetRaSlots (uint8_t raChannel);
+  SatFrameConf::SatTimeSlotConfRange_t GetRaSlots (uint8_t raChannel) const;
 
   /**
    * Get RA channel time slot count
@@ -602,7 +619,7 @@ public:
    * \param raChannel RA channel, which slot count is requested
    * \return RA channel time slot count
    */
-  uint16_t GetRaSlotCount (uint8_t raChannel);
+  uint16_t GetRaSlotCount (uint8_t raChannel) const;
 
   /**
    * Get the number of the RA channels in super frame configuration.
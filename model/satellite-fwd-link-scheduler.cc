@@ -134,7 +134,8 @@ SatFwdLinkScheduler::GetTypeId (void)
                    MakeEnumAccessor (&SatFwdLinkScheduler::m_cnoEstimatorMode),
                    MakeEnumChecker (SatCnoEstimator::LAST, "LastValueInWindow",
                                     SatCnoEstimator::MINIMUM, "MinValueInWindow",
-                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow"))
+                                    SatCnoEstimator::AVERAGE, "AverageValueInWindow",
+                                    SatCnoEstimator::EXPONENTIAL_AVERAGE, "ExponentialAverage"))
     .AddAttribute ( "CnoEstimationWindow",
                     "Time window for C/N0 estimation.",
                     TimeValue (Seconds (5000)),
@@ -242,6 +243,15 @@ SatFwdLinkScheduler::GetNextFrame ()
   return frame;
 }
 
+int64_t
+SatFwdLinkScheduler::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_random->SetStream (stream);
+  return 1;
+}
+
 void
 SatFwdLinkScheduler::CnoInfoUpdated (Mac48Address utAddress, double cnoEstimate)
 {
@@ -426,6 +436,7 @@ SatFwdLinkScheduler::CreateCnoEstimator ()
     case SatCnoEstimator::LAST:
     case SatCnoEstimator::MINIMUM:
     case SatCnoEstimator::AVERAGE:
+    case SatCnoEstimator::EXPONENTIAL_AVERAGE:
       estimator = Create<SatBasicCnoEstimator> (m_cnoEstimatorMode, m_cnoEstimationWindow);
       break;
 
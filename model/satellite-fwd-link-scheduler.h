@@ -180,6 +180,14 @@ public:
    */
   void CnoInfoUpdated (Mac48Address utAddress, double cnoEstimate);
 
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by the scheduler.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
 private:
   typedef std::map<Mac48Address, Ptr<SatCnoEstimator> > CnoEstimatorMap_t;
 
@@ -289,4 +289,24 @@ SatGeoNetDevice::AddFeederPhy (Ptr<SatPhy> phy, uint32_t beamId)
   m_feederPhy.insert (std::pair<uint32_t, Ptr<SatPhy> > (beamId, phy));
 }
 
+int64_t
+SatGeoNetDevice::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  for (std::map<uint32_t, Ptr<SatPhy> >::iterator it = m_userPhy.begin (); it != m_userPhy.end (); ++it)
+    {
+      currentStream += it->second->GetPhyRx ()->AssignStreams (currentStream);
+    }
+
+  for (std::map<uint32_t, Ptr<SatPhy> >::iterator it = m_feederPhy.begin (); it != m_feederPhy.end (); ++it)
+    {
+      currentStream += it->second->GetPhyRx ()->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 } // namespace ns3
@@ -88,6 +88,14 @@ public:
    */
   void AddFeederPhy (Ptr<SatPhy> phy, uint32_t beamId);
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the user and feeder PHYs of the beams.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * Attach a receive ErrorModel to the SatGeoNetDevice.
    * \param em Ptr to the ErrorModel.
@@ -62,6 +62,8 @@ SatGwLlc::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_macQueueEventCb.Nullify ();
+
   SatLlc::DoDispose ();
 }
 
@@ -120,6 +122,12 @@ SatGwLlc::CreateEncap (Ptr<EncapKey> key)
     }
 
   Ptr<SatQueue> queue = CreateObject<SatQueue> (key->m_flowId);
+
+  if (!m_macQueueEventCb.IsNull ())
+    {
+      queue->AddQueueEventCallback (m_macQueueEventCb);
+    }
+
   gwEncap->SetQueue (queue);
 
   NS_LOG_INFO ("Create encapsulator with key (" << key->m_source << ", " << key->m_destination << ", " << (uint32_t) key->m_flowId << ")");
@@ -231,6 +239,12 @@ SatGwLlc::GetNPacketsInQueue (Mac48Address utAddress) const
   return sum;
 }
 
-} // namespace ns3
+void
+SatGwLlc::SetMacQueueEventCallback (SatQueue::QueueEventCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
 
+  m_macQueueEventCb = cb;
+}
 
+} // namespace ns3
@@ -95,6 +95,13 @@ public:
    */
   virtual uint32_t GetNPacketsInQueue (Mac48Address utAddress) const;
 
+  /**
+   * \brief Set the callback to send queue events of the encapsulator
+   * queues to the MAC layer.
+   * \param cb Queue event callback
+   */
+  void SetMacQueueEventCallback (SatQueue::QueueEventCallback cb);
+
 protected:
 
   /**
@@ -114,6 +121,13 @@ protected:
    */
   virtual void CreateDecap (Ptr<EncapKey> key);
 
+  /**
+   * Callback to send queue events to the MAC layer. Note, that this
+   * is not actually used by the LLC but the queues of the encapsulators.
+   * It is just stored here.
+   */
+  SatQueue::QueueEventCallback m_macQueueEventCb;
+
 };
 
 } // namespace ns3
@@ -65,6 +65,13 @@ SatGwMac::GetTypeId (void)
                    TimeValue (MicroSeconds (1)),
                    MakeTimeAccessor (&SatGwMac::m_guardTime),
                    MakeTimeChecker ())
+    .AddAttribute ("IdleSleepEnabled",
+                   "Flag to tell, if the transmissions are stopped while there is nothing to send "
+                   "and dummy frames are not sent. The transmissions are continued when the LLC "
+                   "buffers new packets.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatGwMac::m_idleSleepEnabled),
+                   MakeBooleanChecker ())
     .AddTraceSource ("BBFrameTxTrace",
                      "Trace for transmitted BB Frames.",
                      MakeTraceSourceAccessor (&SatGwMac::m_bbFrameTxTrace),
@@ -77,7 +84,11 @@ SatGwMac::SatGwMac ()
   : SatMac (),
     m_fwdScheduler (),
     m_dummyFrameSendingEnabled (false),
-    m_guardTime (MicroSeconds (1))
+    m_guardTime (MicroSeconds (1)),
+    m_idleSleepEnabled (true),
+    m_idle (false),
+    m_idleStartTime (Seconds (0)),
+    m_idleFrameDuration (Seconds (0))
 {
   NS_LOG_FUNCTION (this);
 }
@@ -86,7 +97,11 @@ SatGwMac::SatGwMac (uint32_t beamId)
   : SatMac (beamId),
     m_fwdScheduler (),
     m_dummyFrameSendingEnabled (false),
-    m_guardTime (MicroSeconds (1))
+    m_guardTime (MicroSeconds (1)),
+    m_idleSleepEnabled (true),
+    m_idle (false),
+    m_idleStartTime (Seconds (0)),
+    m_idleFrameDuration (Seconds (0))
 {
   NS_LOG_FUNCTION (this);
 }
@@ -241,9 +256,76 @@ SatGwMac::StartTransmission (uint32_t carrierId)
    * modify the FWD link scheduler to schedule separately each FWD link
    * carrier.
    */
+  if ( m_idleSleepEnabled && !m_dummyFrameSendingEnabled
+       && ( bbFrame->GetFrameType () == SatEnums::DUMMY_FRAME ) )
+    {
+      /**
+       * Nothing was scheduled even though the scheduler polled the LLC for
+       * the dummy frame, thus stop the transmissions until the LLC buffers
+       * new packets.
+       */
+      NS_LOG_INFO ("GW MAC " << m_nodeInfo->GetMacAddress () << " idle at: " << Simulator::Now ().GetSeconds ());
+
+      m_idle = true;
+      m_idleStartTime = Simulator::Now () + txDuration;
+      m_idleFrameDuration = txDuration;
+      return;
+    }
+
   Simulator::Schedule (txDuration, &SatGwMac::StartTransmission, this, 0);
 }
 
+void
+SatGwMac::WakeUp ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_idle = false;
+
+  // Continue at the next dummy frame start time
+  Time txTime = m_idleStartTime;
+  Time now = Simulator::Now ();
+
+  if ( txTime < now )
+    {
+      int64_t frames = (now - txTime).GetInteger () / m_idleFrameDuration.GetInteger ();
+      txTime += TimeStep (m_idleFrameDuration.GetInteger () * frames);
+
+      if ( txTime < now )
+        {
+          txTime += m_idleFrameDuration;
+        }
+    }
+
+  NS_LOG_INFO ("GW MAC " << m_nodeInfo->GetMacAddress () << " woken up, next frame at: " << txTime.GetSeconds ());
+
+  Simulator::Schedule (txTime - now, &SatGwMac::StartTransmission, this, 0);
+}
+
+void
+SatGwMac::ReceiveQueueEvent (SatQueue::QueueEvent_t event, uint8_t flowId)
+{
+  NS_LOG_FUNCTION (this << event << (uint32_t) flowId);
+
+  if ( m_idle )
+    {
+      WakeUp ();
+    }
+}
+
+int64_t
+SatGwMac::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  if (m_fwdScheduler == NULL)
+    {
+      return 0;
+    }
+
+  return m_fwdScheduler->AssignStreams (stream);
+}
+
 void
 SatGwMac::ReceiveSignalingPacket (Ptr<Packet> packet)
 {
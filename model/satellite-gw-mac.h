@@ -27,6 +27,7 @@
 #include <ns3/nstime.h>
 #include <ns3/satellite-mac.h>
 #include <ns3/satellite-phy.h>
+#include <ns3/satellite-queue.h>
 
 namespace ns3 {
 
@@ -119,6 +120,22 @@ public:
    */
   void SetTxOpportunityCallback (SatGwMac::TxOpportunityCallback cb);
 
+  /**
+   * Receive a queue event from the LLC queues. An idle MAC is woken up
+   * to continue the transmissions, when new packets are buffered.
+   * \param event Queue event from SatQueue
+   * \param flowId Identifier of the queue
+   */
+  void ReceiveQueueEvent (SatQueue::QueueEvent_t event, uint8_t flowId);
+
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by the forward link scheduler of this MAC.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
 private:
   SatGwMac& operator = (const SatGwMac &);
   SatGwMac (const SatGwMac &);
@@ -136,6 +153,13 @@ private:
    */
   void StartTransmission (uint32_t carrierId);
 
+  /**
+   * Wake up the idle MAC. The transmissions are continued at the first
+   * frame start time, which would have been used if dummy frames had been
+   * transmitted during the idle period.
+   */
+  void WakeUp ();
+
   /**
    * Signaling packet receiver, which handles all the signaling packet
    * receptions.
@@ -160,6 +184,30 @@ private:
    */
   Time m_guardTime;
 
+  /**
+   * Flag indicating if the MAC is allowed to stop the transmissions while
+   * there is nothing to transmit and dummy frames are not sent. The MAC is
+   * woken up by the queue events of the LLC.
+   */
+  bool m_idleSleepEnabled;
+
+  /**
+   * Flag indicating if the MAC is currently idle, i.e. not transmitting.
+   */
+  bool m_idle;
+
+  /**
+   * Time when the transmission of the next frame would have started, when
+   * the MAC went idle.
+   */
+  Time m_idleStartTime;
+
+  /**
+   * Duration of the dummy frame, which determines the frame start times
+   * during the idle period.
+   */
+  Time m_idleFrameDuration;
+
   /**
    * Trace for transmitted BB frames.
    */
@@ -46,6 +46,7 @@ SatInterferenceInputTraceContainer::GetInstanceTypeId (void) const
 }
 
 SatInterferenceInputTraceContainer::SatInterferenceInputTraceContainer ()
+  : m_resetCount (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -72,13 +73,18 @@ SatInterferenceInputTraceContainer::Reset ()
 {
   NS_LOG_FUNCTION (this);
 
-  if (!m_container.empty ())
+  if (!m_traceIndexes.empty ())
     {
-      m_container.clear ();
+      m_traceIndexes.clear ();
     }
+
+  m_traces.clear ();
+
+  // the trace indexes kept by the users are not valid anymore
+  m_resetCount++;
 }
 
-Ptr<SatInputFileStreamTimeDoubleContainer>
+uint32_t
 SatInterferenceInputTraceContainer::AddNode (key_t key)
 {
   NS_LOG_FUNCTION (this);
@@ -92,44 +98,43 @@ SatInterferenceInputTraceContainer::AddNode (key_t key)
 
   if (beamId < 0 || (utId < 0 && gwId < 0))
     {
-      return NULL;
+      NS_FATAL_ERROR ("SatInterferenceInputTraceContainer::AddNode - no trace for MAC " << key.first);
     }
-  else
-    {
-      if (utId >= 0 && gwId < 0)
-        {
-          filename << dataPath << "/interferencetraces/input/BEAM_" << beamId << "_UT_" << utId << "_channelType_" << SatEnums::GetChannelTypeName (key.second);
-        }
 
-      if (gwId >= 0 && utId < 0)
-        {
-          filename << dataPath << "/interferencetraces/input/BEAM_" << beamId << "_GW_" << gwId << "_channelType_" << SatEnums::GetChannelTypeName (key.second);
-        }
+  if (utId >= 0 && gwId < 0)
+    {
+      filename << dataPath << "/interferencetraces/input/BEAM_" << beamId << "_UT_" << utId << "_channelType_" << SatEnums::GetChannelTypeName (key.second);
+    }
 
-      std::pair <container_t::iterator, bool> result = m_container.insert (std::make_pair (key, CreateObject<SatInputFileStreamTimeDoubleContainer> (filename.str ().c_str (), std::ios::in, SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS)));
+  if (gwId >= 0 && utId < 0)
+    {
+      filename << dataPath << "/interferencetraces/input/BEAM_" << beamId << "_GW_" << gwId << "_channelType_" << SatEnums::GetChannelTypeName (key.second);
+    }
 
-      if (result.second == false)
-        {
-          NS_FATAL_ERROR ("SatInterferenceInputTraceContainer::AddNode failed");
-        }
+  uint32_t traceIndex = m_traces.size ();
 
-      NS_LOG_INFO ("SatInterferenceInputTraceContainer::AddNode: Added node with MAC " << key.first << " channel type " << key.second);
+  std::pair <indexMap_t::iterator, bool> result = m_traceIndexes.insert (std::make_pair (key, traceIndex));
 
-      return result.first->second;
+  if (result.second == false)
+    {
+      NS_FATAL_ERROR ("SatInterferenceInputTraceContainer::AddNode failed");
     }
 
-  NS_FATAL_ERROR ("SatInterferenceInputTraceContainer::AddNode failed");
-  return NULL;
+  m_traces.push_back (CreateObject<SatInputFileStreamTimeDoubleContainer> (filename.str ().c_str (), std::ios::in, SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS));
+
+  NS_LOG_INFO ("SatInterferenceInputTraceContainer::AddNode: Added node with MAC " << key.first << " channel type " << key.second << " as trace " << traceIndex);
+
+  return traceIndex;
 }
 
-Ptr<SatInputFileStreamTimeDoubleContainer>
-SatInterferenceInputTraceContainer::FindNode (key_t key)
+uint32_t
+SatInterferenceInputTraceContainer::GetTraceIndex (key_t key)
 {
   NS_LOG_FUNCTION (this);
 
-  container_t::iterator iter = m_container.find (key);
+  indexMap_t::iterator iter = m_traceIndexes.find (key);
 
-  if (iter == m_container.end ())
+  if (iter == m_traceIndexes.end ())
     {
       return AddNode (key);
     }
@@ -142,7 +147,20 @@ SatInterferenceInputTraceContainer::GetInterferenceDensity (key_t key)
 {
   NS_LOG_FUNCTION (this);
 
-  return FindNode (key)->ProceedToNextClosestTimeSample ().at (SatBaseTraceContainer::INTF_TRACE_DEFAULT_INTF_DENSITY_INDEX);
+  return GetInterferenceDensity (GetTraceIndex (key));
+}
+
+double
+SatInterferenceInputTraceContainer::GetInterferenceDensity (uint32_t traceIndex)
+{
+  NS_LOG_FUNCTION (this << traceIndex);
+
+  if (traceIndex >= m_traces.size ())
+    {
+      NS_FATAL_ERROR ("SatInterferenceInputTraceContainer::GetInterferenceDensity - trace " << traceIndex << " not loaded");
+    }
+
+  return m_traces[traceIndex]->ProceedToNextClosestTimeSample (SatBaseTraceContainer::INTF_TRACE_DEFAULT_INTF_DENSITY_INDEX);
 }
 
 } // namespace ns3
@@ -32,6 +32,11 @@ namespace ns3 {
  *
  * \brief Class for interference input trace container. The class contains
  * multiple interference input sample traces and provides an interface to them.
+ *
+ * The traces are stored in a vector by a dense trace index, which is given
+ * to a trace when it is loaded. The receivers look up the index of their
+ * trace once with GetTraceIndex and read the samples by the index, so that
+ * no map search is needed per reception.
  */
 class SatInterferenceInputTraceContainer : public SatBaseTraceContainer
 {
@@ -42,9 +47,9 @@ public:
   typedef std::pair<Address,SatEnums::ChannelType_t> key_t;
 
   /**
-   * \brief typedef for map of containers
+   * \brief typedef for map of trace indexes
    */
-  typedef std::map <key_t, Ptr<SatInputFileStreamTimeDoubleContainer> > container_t;
+  typedef std::map <key_t, uint32_t> indexMap_t;
 
   /**
    * \brief Constructor
@@ -81,29 +86,58 @@ public:
   double GetInterferenceDensity (key_t key);
 
   /**
-   * \brief Function for resetting the variables
+   * \brief Function for getting the interference density
+   * \param traceIndex index of the trace, see GetTraceIndex
+   * \return Interference density
+   */
+  double GetInterferenceDensity (uint32_t traceIndex);
+
+  /**
+   * \brief Function for getting the index of the trace matching the key.
+   * The trace is loaded, if it is not loaded already.
+   * \param key key
+   * \return index of the trace
+   */
+  uint32_t GetTraceIndex (key_t key);
+
+  /**
+   * \brief Function for resetting the variables. The trace indexes got
+   * earlier are not valid after the reset.
    */
   void Reset ();
 
+  /**
+   * \brief Get the number of times the container has been reset. A user
+   * keeping a trace index shall get it again, when the count has changed.
+   * \return reset count
+   */
+  uint32_t GetResetCount () const
+  {
+    return m_resetCount;
+  }
+
 private:
   /**
    * \brief Function for adding the node to the map
    * \param key key
-   * \return pointer to the added container
+   * \return index of the added trace
    */
-  Ptr<SatInputFileStreamTimeDoubleContainer> AddNode (std::pair<Address,SatEnums::ChannelType_t> key);
+  uint32_t AddNode (std::pair<Address,SatEnums::ChannelType_t> key);
 
   /**
-   * \brief Function for finding the container matching the key
-   * \param key key
-   * \return matching container
+   * \brief Map for trace indexes
+   */
+  indexMap_t m_traceIndexes;
+
+  /**
+   * \brief Traces by trace index
    */
-  Ptr<SatInputFileStreamTimeDoubleContainer> FindNode (key_t key);
+  std::vector<Ptr<SatInputFileStreamTimeDoubleContainer> > m_traces;
 
   /**
-   * \brief Map for containers
+   * \brief Number of resets
    */
-  container_t m_container;
+  uint32_t m_resetCount;
 };
 
 } // namespace ns3
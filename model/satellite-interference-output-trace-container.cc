@@ -34,7 +34,7 @@ TypeId
 SatInterferenceOutputTraceContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatInterferenceOutputTraceContainer")
-    .SetParent<SatBaseTraceContainer> ()
+    .SetParent<SatBaseOutputTraceContainer> ()
     .AddConstructor<SatInterferenceOutputTraceContainer> ();
   return tid;
 }
@@ -48,7 +48,7 @@ SatInterferenceOutputTraceContainer::GetInstanceTypeId (void) const
 }
 
 SatInterferenceOutputTraceContainer::SatInterferenceOutputTraceContainer ()
-  : m_enableFigureOutput (true)
+  : SatBaseOutputTraceContainer (SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -67,21 +67,7 @@ SatInterferenceOutputTraceContainer::DoDispose ()
 
   Reset ();
 
-  SatBaseTraceContainer::DoDispose ();
-}
-
-void
-SatInterferenceOutputTraceContainer::Reset ()
-{
-  NS_LOG_FUNCTION (this);
-
-  if (!m_container.empty ())
-    {
-      WriteToFile ();
-
-      m_container.clear ();
-    }
-  m_enableFigureOutput = true;
+  SatBaseOutputTraceContainer::DoDispose ();
 }
 
 Ptr<SatOutputFileStreamDoubleContainer>
@@ -125,21 +111,6 @@ SatInterferenceOutputTraceContainer::AddNode (key_t key)
     }
 }
 
-Ptr<SatOutputFileStreamDoubleContainer>
-SatInterferenceOutputTraceContainer::FindNode (key_t key)
-{
-  NS_LOG_FUNCTION (this);
-
-  container_t::iterator iter = m_container.find (key);
-
-  if (iter == m_container.end ())
-    {
-      return AddNode (key);
-    }
-
-  return iter->second;
-}
-
 void
 SatInterferenceOutputTraceContainer::WriteToFile ()
 {
@@ -162,22 +133,4 @@ SatInterferenceOutputTraceContainer::WriteToFile ()
     }
 }
 
-void
-SatInterferenceOutputTraceContainer::AddToContainer (key_t key, std::vector<double> newItem)
-{
-  NS_LOG_FUNCTION (this);
-
-  if (newItem.size () != SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
-    {
-      NS_FATAL_ERROR ("SatInterferenceOutputTraceContainer::AddToContainer - Incorrect vector size");
-    }
-
-  Ptr<SatOutputFileStreamDoubleContainer> node = FindNode (key);
-
-  if (node != NULL)
-    {
-      node->AddToContainer (newItem);
-    }
-}
-
 } // namespace ns3
@@ -125,6 +125,22 @@ SatInterference::Add (Time duration, double power, Address rxAddress)
   return DoAdd (duration, power, rxAddress);
 }
 
+void
+SatInterference::AddAggregated (Time duration, double power)
+{
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << power);
+
+  DoAddAggregated (duration, power);
+}
+
+void
+SatInterference::DoAddAggregated (Time duration, double power)
+{
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << power);
+
+  DoAdd (duration, power, Address ());
+}
+
 double
 SatInterference::Calculate (Ptr<SatInterference::InterferenceChangeEvent> event)
 {
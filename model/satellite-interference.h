@@ -125,6 +125,16 @@ private:
    */
   Ptr<SatInterference::InterferenceChangeEvent> Add (Time rxDuration, double rxPower, Address rxAddress);
 
+  /**
+   * Adds power of a transmission, which is not received but is only
+   * interference for the received transmissions, to interference object.
+   * No interference event is created for the transmission.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   */
+  void AddAggregated (Time rxDuration, double rxPower);
+
   /**
    * Calculates interference power for the given reference
    *
@@ -171,6 +181,16 @@ private:
    */
   virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd (Time rxDuration, double rxPower, Address rxAddress) = 0;
 
+  /**
+   * Adds power of a transmission, which is only interference, to interference
+   * object. By default the transmission is added as an ordinary interference
+   * event.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   */
+  virtual void DoAddAggregated (Time rxDuration, double rxPower);
+
   /**
    * Calculates interference power for the given reference
    * Sets final power at end time to finalPower.
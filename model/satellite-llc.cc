@@ -361,6 +361,22 @@ SatLlc::ControlBuffersEmpty () const
   return true;
 }
 
+bool
+SatLlc::BuffersIdle () const
+{
+  for (EncapContainer_t::const_iterator it = m_encaps.begin ();
+       it != m_encaps.end ();
+       ++it)
+    {
+      if (it->second->GetTxBufferSizeInBytes () > 0
+          || it->second->HasUnacknowledgedData ())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
 uint32_t
 SatLlc::GetNBytesInQueue () const
 {
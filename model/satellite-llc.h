@@ -256,6 +256,13 @@ public:
    */
   virtual bool ControlBuffersEmpty () const;
 
+  /**
+   * \brief Are buffers idle, i.e. empty and without unacknowledged data
+   * which could be moved back to the buffers for retransmission?
+   * \return Boolean to indicate whether the buffers are idle or not.
+   */
+  virtual bool BuffersIdle () const;
+
   /**
    * \brief Get the number of (new) bytes at LLC queue for a certain UT. Method
    * checks only the SatQueue for packets, thus it does not count possible
@@ -23,6 +23,8 @@
 
 #include "ns3/log.h"
 #include "ns3/fatal-error.h"
+#include "ns3/singleton.h"
+#include "ns3/satellite-input-data-cache.h"
 #include "satellite-look-up-table.h"
 #include "satellite-utils.h"
 
@@ -34,6 +36,7 @@ NS_OBJECT_ENSURE_REGISTERED (SatLookUpTable);
 
 
 SatLookUpTable::SatLookUpTable (std::string linkResultPath)
+  : m_ifs (0)
 {
   NS_LOG_FUNCTION (this << linkResultPath);
   Load (linkResultPath);
@@ -176,53 +179,54 @@ SatLookUpTable::Load (std::string linkResultPath)
 {
   NS_LOG_FUNCTION (this << linkResultPath);
 
-  // READ FROM THE SPECIFIED INPUT FILE
+  // USE THE BINARY INPUT DATA CACHE, IF AVAILABLE
 
-  m_ifs = new std::ifstream (linkResultPath.c_str (), std::ifstream::in);
+  uint32_t rows = 0;
+  uint32_t columns = 0;
+  const double *table = Singleton<SatInputDataCache>::Get ()->GetTable (linkResultPath, rows, columns);
 
-  if (!m_ifs->is_open ())
+  if ((table != 0) && (columns == 2))
     {
-      // script might be launched by test.py, try a different base path
-      delete m_ifs;
-      linkResultPath = "../../" + linkResultPath;
-      m_ifs = new std::ifstream (linkResultPath.c_str (), std::ifstream::in);
-
-      if (!m_ifs->is_open ())
+      for (uint32_t i = 0; i < rows; i++)
         {
-          NS_FATAL_ERROR ("The file " << linkResultPath << " is not found.");
+          AddRow (linkResultPath, table[2 * i], table[2 * i + 1]);
         }
     }
+  else
+    {
+      // READ FROM THE SPECIFIED INPUT FILE
 
-  double lastEsNoDb = -100.0; // very low value
-  double lastBler = 1.0; // maximum value
+      m_ifs = new std::ifstream (linkResultPath.c_str (), std::ifstream::in);
 
-  double esNoDb, bler;
-  *m_ifs >> esNoDb >> bler;
+      if (!m_ifs->is_open ())
+        {
+          // script might be launched by test.py, try a different base path
+          delete m_ifs;
+          linkResultPath = "../../" + linkResultPath;
+          m_ifs = new std::ifstream (linkResultPath.c_str (), std::ifstream::in);
+
+          if (!m_ifs->is_open ())
+            {
+              NS_FATAL_ERROR ("The file " << linkResultPath << " is not found.");
+            }
+        }
 
-  while (m_ifs->good ())
-    {
-      NS_LOG_DEBUG (this << " sinrDb=" << esNoDb << ", bler=" << bler);
+      double esNoDb, bler;
+      *m_ifs >> esNoDb >> bler;
 
-      // SANITY CHECK PART I
-      if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
+      while (m_ifs->good ())
         {
-          NS_FATAL_ERROR ("The file " << linkResultPath << " is not properly sorted.");
-        }
+          AddRow (linkResultPath, esNoDb, bler);
 
-      // record the values
-      m_esNoDb.push_back (esNoDb);
-      m_bler.push_back (bler);
-      lastEsNoDb = esNoDb;
-      lastBler = bler;
+          // get next row
+          *m_ifs >> esNoDb >> bler;
+        }
 
-      // get next row
-      *m_ifs >> esNoDb >> bler;
+      m_ifs->close ();
+      delete m_ifs;
+      m_ifs = 0;
     }
 
-  m_ifs->close ();
-  delete m_ifs;
-  m_ifs = 0;
-
   // SANITY CHECK PART II
 
   // at least contains one row
@@ -237,4 +241,24 @@ SatLookUpTable::Load (std::string linkResultPath)
 } // end of void Load (std::string linkResultPath)
 
 
+void
+SatLookUpTable::AddRow (std::string linkResultPath, double esNoDb, double bler)
+{
+  NS_LOG_DEBUG (this << " sinrDb=" << esNoDb << ", bler=" << bler);
+
+  double lastEsNoDb = m_esNoDb.empty () ? -100.0 : m_esNoDb.back (); // very low value
+  double lastBler = m_bler.empty () ? 1.0 : m_bler.back (); // maximum value
+
+  // SANITY CHECK PART I
+  if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
+    {
+      NS_FATAL_ERROR ("The file " << linkResultPath << " is not properly sorted.");
+    }
+
+  // record the values
+  m_esNoDb.push_back (esNoDb);
+  m_bler.push_back (bler);
+}
+
+
 } // end of namespace ns3
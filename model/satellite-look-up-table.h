@@ -79,6 +79,14 @@ private:
    */
   void Load (std::string linkResultPath);
 
+  /**
+   * \brief Check and add one row of link results
+   * \param linkResultPath Path to the link results file, used in error messages
+   * \param esNoDb Es/No in dB
+   * \param bler BLER corresponding to the Es/No
+   */
+  void AddRow (std::string linkResultPath, double esNoDb, double bler);
+
   std::vector<double> m_esNoDb;
   std::vector<double> m_bler;
   std::ifstream *m_ifs;
@@ -149,6 +149,14 @@ SatMac::ReceiveQueueEvent (SatQueue::QueueEvent_t /*event*/, uint8_t /*flowIndex
   NS_LOG_FUNCTION (this);
 }
 
+int64_t
+SatMac::AssignStreams (int64_t /*stream*/)
+{
+  NS_LOG_FUNCTION (this);
+
+  return 0;
+}
+
 void
 SatMac::SendPacket (SatPhy::PacketContainer_t packets, uint32_t carrierId, Time duration, SatSignalParameters::txInfo_s txInfo)
 {
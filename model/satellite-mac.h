@@ -180,6 +180,14 @@ public:
    */
   virtual void ReceiveQueueEvent (SatQueue::QueueEvent_t event, uint8_t flowIndex);
 
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by this MAC. Base class does not use random variables.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
 private:
   SatMac& operator = (const SatMac &);
   SatMac (const SatMac &);
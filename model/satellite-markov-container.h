@@ -20,13 +20,11 @@
 #ifndef SATELLITE_MARKOV_CONTAINER_H
 #define SATELLITE_MARKOV_CONTAINER_H
 
-#include "satellite-markov-model.h"
 #include "satellite-markov-conf.h"
+#include "satellite-markov-fading-engine.h"
 #include "geo-coordinate.h"
 #include "ns3/vector.h"
 #include "satellite-base-fading.h"
-#include "satellite-loo-model.h"
-#include "satellite-rayleigh-model.h"
 #include "ns3/traced-callback.h"
 
 namespace ns3 {
@@ -34,11 +32,10 @@ namespace ns3 {
 /**
  * \ingroup satellite
  *
- * \brief Container for Markov-model. This class contains the
- * Markov-model state machines and implements the fading interface.
- * The class implements, e.g., the state machine selection and
- * contains the logic for deciding when the new fading value will
- * be calculated and state change evaluation should happen.
+ * \brief Container for Markov-model. This class implements the fading
+ * interface of one UT. The Markov-model state machine and the faders are
+ * implemented by SatMarkovFadingEngine, which is shared by all the
+ * containers using the same engine and stores only a compact state per UT.
  */
 class SatMarkovContainer : public SatBaseFading
 {
@@ -56,11 +53,11 @@ public:
 
   /**
    * \brief Constructor
-   * \param markovConf Markov configuration object.
+   * \param fadingEngine Markov fading engine shared with other containers.
    * \param elevation Elevation angle callback.
    * \param velocity Velocity callback.
    */
-  SatMarkovContainer (Ptr<SatMarkovConf> markovConf, SatBaseFading::ElevationCallback elevation, SatBaseFading::VelocityCallback velocity);
+  SatMarkovContainer (Ptr<SatMarkovFadingEngine> fadingEngine, SatBaseFading::ElevationCallback elevation, SatBaseFading::VelocityCallback velocity);
 
   /**
    * \brief Destructor
@@ -127,105 +124,25 @@ public:
 
 private:
   /**
-   * \brief Markov model object
+   * \brief Markov fading engine
    */
-  Ptr<SatMarkovModel> m_markovModel;
+  Ptr<SatMarkovFadingEngine> m_fadingEngine;
 
   /**
-   * \brief Markoc model configuration
+   * \brief Index of this UT in the Markov fading engine
    */
-  Ptr<SatMarkovConf> m_markovConf;
-
-  /**
-   * \brief Uplink fader
-   */
-  Ptr<SatBaseFader> m_fader_up;
-
-  /**
-   * \brief Downlink fader
-   */
-  Ptr<SatBaseFader> m_fader_down;
-
-  /**
-   * \brief Number of states available
-   */
-  uint32_t m_numOfStates;
-
-  /**
-   * \brief Number of parameter sets available
-   */
-  uint32_t m_numOfSets;
-
-  /**
-   * \brief Current parameter set
-   */
-  uint32_t m_currentSet;
-
-  /**
-   * \brief Current state
-   */
-  uint32_t m_currentState;
-
-  /**
-   * \brief Cooldown period length in time
-   */
-  Time m_cooldownPeriodLength;
-
-  /**
-   * \brief Minimum state change distance in meters
-   */
-  double m_minimumPositionChangeInMeters;
-
-  /**
-   * \brief Latest calculated uplink fading value
-   */
-  double m_latestCalculatedFadingValue_up;
-
-  /**
-   * \brief Latest calculated downlink fading value
-   */
-  double m_latestCalculatedFadingValue_down;
-
-  /**
-   * \brief Latest calculation time for uplink fading value
-   */
-  Time m_latestCalculationTime_up;
-
-  /**
-   * \brief Latest calculation time for downlink fading value
-   */
-  Time m_latestCalculationTime_down;
-
-  /**
-   * \brief Variable for disabling the parameter set change
-   */
-  bool m_enableSetLock;
-
-  /**
-   * \brief Variable for disabling state changes
-   */
-  bool m_enableStateLock;
+  uint32_t m_utIndex;
 
   /**
    * \brief Node movement velocity
    */
   VelocityCallback m_velocity;
 
-  /**
-   * \brief Latest calculation time for state change
-   */
-  Time m_latestStateChangeTime;
-
   /**
    * \brief Current elevation value
    */
   ElevationCallback m_currentElevation;
 
-  /**
-   * \brief Defines whether the calculations should return the fading value in decibels or not
-   */
-  bool m_useDecibels;
-
   /**
    * \brief Fading trace function
    */
@@ -235,55 +152,6 @@ private:
                   >
   m_fadingTrace;
 
-  /**
-   * \brief Function for updating the state change probabilities
-   * \param set parameter set
-   */
-  void UpdateProbabilities (uint32_t set);
-
-  /**
-   * \brief Function for evaluating state change
-   */
-  void EvaluateStateChange (SatEnums::ChannelType_t channelType);
-
-  /**
-   * \brief Function for calculating the fading value
-   * \param channelType channel type
-   * \return fading value
-   */
-  double CalculateFading (SatEnums::ChannelType_t channelType);
-
-  /**
-   * \brief Function for calculating the elevation
-   * \return elevation value
-   */
-  double CalculateElevation ();
-
-  /**
-   * \brief Function for checking whether the cooldown period has passed
-   * \param channelType channel type
-   * \return has cooldown period passed
-   */
-  bool HasCooldownPeriodPassed (SatEnums::ChannelType_t channelType);
-
-  /**
-   * \brief Function for getting the cached fading values
-   * \param channelType channel type
-   * \return cached fading value
-   */
-  double GetCachedFadingValue (SatEnums::ChannelType_t channelType);
-
-  /**
-   * \brief Function for creating the Markov state faders
-   */
-  void CreateFaders (SatMarkovConf::MarkovFaderType_t faderType);
-
-  /**
-   * \brief Function for calculating the distance since latest state change position
-   * \return distance
-   */
-  double CalculateDistanceSinceLastStateChange ();
-
   /**
    * \brief Clear used variables
    */
@@ -0,0 +1,518 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "satellite-markov-fading-engine.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatMarkovFadingEngine);
+NS_LOG_COMPONENT_DEFINE ("SatMarkovFadingEngine");
+
+TypeId
+SatMarkovFadingEngine::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatMarkovFadingEngine")
+    .SetParent<Object> ()
+    .AddConstructor<SatMarkovFadingEngine> ()
+    .AddAttribute ( "MaxTimeOffset", "Maximum time offset of the UTs sharing the same fader oscillators.",
+                    TimeValue (Seconds (1000.0)),
+                    MakeTimeAccessor (&SatMarkovFadingEngine::m_maxTimeOffset),
+                    MakeTimeChecker ());
+  return tid;
+}
+
+SatMarkovFadingEngine::SatMarkovFadingEngine ()
+  : m_markovConf (NULL),
+    m_faderType (SatMarkovConf::LOO_FADER),
+    m_numOfStates (),
+    m_numOfSets (),
+    m_cooldownPeriodLength (),
+    m_minimumPositionChangeInMeters (),
+    m_useDecibels (false),
+    m_maxTimeOffset (Seconds (1000.0))
+{
+  NS_LOG_FUNCTION (this);
+  NS_FATAL_ERROR ("SatMarkovFadingEngine::SatMarkovFadingEngine - Constructor not in use");
+}
+
+SatMarkovFadingEngine::SatMarkovFadingEngine (Ptr<SatMarkovConf> markovConf)
+  : m_markovConf (markovConf),
+    m_faderType (markovConf->GetFaderType ()),
+    m_numOfStates (markovConf->GetStateCount ()),
+    m_numOfSets (markovConf->GetNumOfSets ()),
+    m_cooldownPeriodLength (markovConf->GetCooldownPeriod ().GetSeconds ()),
+    m_minimumPositionChangeInMeters (markovConf->GetMinimumPositionChange ()),
+    m_useDecibels (markovConf->AreDecibelsUsed ()),
+    m_maxTimeOffset (Seconds (1000.0))
+{
+  NS_LOG_FUNCTION (this);
+
+  for (uint32_t i = 0; i < m_numOfSets; i++)
+    {
+      m_probabilities.push_back (m_markovConf->GetElevationProbabilities (i));
+    }
+
+  m_oscillators.resize (m_numOfSets);
+
+  m_uniformVariable = CreateObject<UniformRandomVariable> ();
+  m_normalRandomVariable = CreateObject<NormalRandomVariable> ();
+}
+
+SatMarkovFadingEngine::~SatMarkovFadingEngine ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatMarkovFadingEngine::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_markovConf = NULL;
+  m_uniformVariable = NULL;
+  m_normalRandomVariable = NULL;
+  m_probabilities.clear ();
+  m_oscillators.clear ();
+  m_uts.clear ();
+
+  Object::DoDispose ();
+}
+
+uint32_t
+SatMarkovFadingEngine::AddUt (double elevation)
+{
+  NS_LOG_FUNCTION (this << elevation);
+
+  UtFadingState_t ut;
+  ut.m_set = m_markovConf->GetProbabilitySetID (elevation);
+  ut.m_state = DoTransition (ut.m_set, m_markovConf->GetInitialState ());
+  ut.m_setLocked = false;
+  ut.m_stateLocked = false;
+  ut.m_latestStateChangeTime = Now ().GetSeconds ();
+
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      // negative time: not calculated yet
+      ut.m_latestCalculationTime[i] = -1.0;
+      ut.m_latestFadingValue[i] = 0.0;
+      ut.m_phaseOffset[i] = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+      ut.m_timeOffset[i] = m_uniformVariable->GetValue (0.0, m_maxTimeOffset.GetSeconds ());
+    }
+
+  // amplitudes are drawn when the fading is calculated for the first time
+  ut.m_amplitudeSet = m_numOfSets;
+
+  m_uts.push_back (ut);
+
+  NS_LOG_INFO ("Time " << Now ().GetSeconds ()
+                       << " SatMarkovFadingEngine::AddUt - UT " << m_uts.size () - 1
+                       << " Elevation: " << elevation
+                       << " Set ID: " << ut.m_set
+                       << " State: " << ut.m_state);
+
+  return m_uts.size () - 1;
+}
+
+double
+SatMarkovFadingEngine::GetFading (uint32_t utIndex,
+                                  SatEnums::ChannelType_t channelType,
+                                  const SatBaseFading::ElevationCallback &elevation,
+                                  const SatBaseFading::VelocityCallback &velocity)
+{
+  NS_LOG_FUNCTION (this << utIndex << channelType);
+
+  NS_ASSERT (utIndex < m_uts.size ());
+
+  UtFadingState_t &ut = m_uts[utIndex];
+  uint32_t link = GetLinkIndex (channelType);
+  double now = Now ().GetSeconds ();
+
+  if ((ut.m_latestCalculationTime[link] >= 0.0)
+      && ((now - ut.m_latestCalculationTime[link]) <= m_cooldownPeriodLength))
+    {
+      NS_LOG_INFO ("Time " << now << " SatMarkovFadingEngine::GetFading - Cool down period in effect, using old fading value");
+      return ut.m_latestFadingValue[link];
+    }
+
+  double utVelocity = velocity ();
+
+  if (utVelocity > 0)
+    {
+      EvaluateStateChange (ut, elevation, utVelocity);
+    }
+
+  ut.m_latestFadingValue[link] = CalculateFading (ut, link);
+  ut.m_latestCalculationTime[link] = now;
+
+  NS_LOG_INFO ("Time " << now << " SatMarkovFadingEngine::GetFading - Calculated fading value " << ut.m_latestFadingValue[link]
+                       << " for UT " << utIndex << ", link " << link);
+
+  return ut.m_latestFadingValue[link];
+}
+
+uint32_t
+SatMarkovFadingEngine::GetLinkIndex (SatEnums::ChannelType_t channelType)
+{
+  switch (channelType)
+    {
+    case SatEnums::RETURN_USER_CH:
+    case SatEnums::FORWARD_FEEDER_CH:
+      {
+        return 0;
+      }
+    case SatEnums::FORWARD_USER_CH:
+    case SatEnums::RETURN_FEEDER_CH:
+      {
+        return 1;
+      }
+    default:
+      {
+        NS_FATAL_ERROR ("SatMarkovFadingEngine::GetLinkIndex - Invalid channel type");
+      }
+    }
+  return 0;
+}
+
+void
+SatMarkovFadingEngine::EvaluateStateChange (UtFadingState_t &ut, const SatBaseFading::ElevationCallback &elevation, double velocity)
+{
+  NS_LOG_FUNCTION (this);
+
+  double now = Now ().GetSeconds ();
+
+  if ((now - ut.m_latestStateChangeTime) * velocity > m_minimumPositionChangeInMeters)
+    {
+      if (!ut.m_setLocked)
+        {
+          uint32_t newSetId = m_markovConf->GetProbabilitySetID (elevation ());
+
+          if (ut.m_set != newSetId)
+            {
+              NS_LOG_INFO ("Time " << now
+                                   << " SatMarkovFadingEngine::EvaluateStateChange - set ID [old,new]: [" << ut.m_set << "," << newSetId << "]");
+              ut.m_set = newSetId;
+            }
+        }
+
+      if (!ut.m_stateLocked)
+        {
+          ut.m_latestStateChangeTime = now;
+          ut.m_state = DoTransition (ut.m_set, ut.m_state);
+        }
+    }
+}
+
+uint32_t
+SatMarkovFadingEngine::DoTransition (uint32_t set, uint32_t state) const
+{
+  NS_LOG_FUNCTION (this << set << state);
+
+  const std::vector<double> &probabilities = m_probabilities[set][state];
+
+  double total = 0;
+
+  for (uint32_t i = 0; i < m_numOfStates; ++i)
+    {
+      total += probabilities[i];
+    }
+
+  if ( ( fabs (total - 1.0) > std::numeric_limits<double>::epsilon ()) )
+    {
+      NS_FATAL_ERROR ("SatMarkovFadingEngine::DoTransition - Probability sum does not match");
+    }
+
+  double r = total * (std::rand () / double (RAND_MAX));
+  double acc = 0.0;
+
+  for (uint32_t i = 0; i < m_numOfStates; ++i)
+    {
+      acc += probabilities[i];
+
+      if (r <= acc)
+        {
+          return i;
+        }
+    }
+
+  return m_numOfStates - 1;
+}
+
+double
+SatMarkovFadingEngine::CalculateFading (UtFadingState_t &ut, uint32_t link)
+{
+  NS_LOG_FUNCTION (this << link);
+
+  const FaderOscillators_t &oscillators = GetOscillators (ut.m_set, ut.m_state);
+
+  if (ut.m_amplitudeSet != ut.m_set)
+    {
+      if (m_faderType == SatMarkovConf::RAYLEIGH_FADER)
+        {
+          CreateRayleighAmplitudes (ut);
+        }
+      else
+        {
+          CreateLooAmplitudes (ut);
+        }
+    }
+
+  // Rayleigh fader does not depend on the state
+  const FaderAmplitudes_t &amplitudes = ut.m_amplitudes[(m_faderType == SatMarkovConf::RAYLEIGH_FADER) ? 0 : ut.m_state];
+
+  double timeInSeconds = Now ().GetSeconds () + ut.m_timeOffset[link];
+  std::complex<double> multipathGain (0, 0);
+  double multipathPhase = oscillators.m_multipathPhase + ut.m_phaseOffset[link];
+
+  for (uint32_t i = 0; i < oscillators.m_multipathOmega.size (); i++)
+    {
+      multipathGain += amplitudes.m_multipathAmplitude[i] * std::cos (timeInSeconds * oscillators.m_multipathOmega[i] + multipathPhase);
+    }
+
+  double gain;
+
+  if (m_faderType == SatMarkovConf::RAYLEIGH_FADER)
+    {
+      gain = (std::pow (multipathGain.real (), 2) + std::pow (multipathGain.imag (), 2)) / 2;
+    }
+  else
+    {
+      std::complex<double> directGain (0, 0);
+      double directPhase = oscillators.m_directPhase + ut.m_phaseOffset[link];
+
+      for (uint32_t i = 0; i < oscillators.m_directOmega.size (); i++)
+        {
+          double phase = timeInSeconds * oscillators.m_directOmega[i] + directPhase;
+          directGain += amplitudes.m_directAmplitude[i] * std::exp (std::complex<double> (std::cos (phase), std::sin (phase)));
+        }
+
+      std::complex<double> fadingGain = directGain + multipathGain * oscillators.m_sigma;
+      gain = std::sqrt (std::pow (fadingGain.real (), 2) + std::pow (fadingGain.imag (), 2));
+    }
+
+  return m_useDecibels ? 10.0 * std::log10 (gain) : gain;
+}
+
+const SatMarkovFadingEngine::FaderOscillators_t &
+SatMarkovFadingEngine::GetOscillators (uint32_t set, uint32_t state)
+{
+  NS_LOG_FUNCTION (this << set << state);
+
+  NS_ASSERT (set < m_numOfSets);
+  NS_ASSERT (state < m_numOfStates);
+
+  if (m_oscillators[set].empty ())
+    {
+      if (m_faderType == SatMarkovConf::RAYLEIGH_FADER)
+        {
+          CreateRayleighOscillators (set);
+        }
+      else
+        {
+          CreateLooOscillators (set);
+        }
+    }
+
+  // Rayleigh fader does not depend on the state
+  return m_oscillators[set][(m_faderType == SatMarkovConf::RAYLEIGH_FADER) ? 0 : state];
+}
+
+void
+SatMarkovFadingEngine::CreateLooOscillators (uint32_t set)
+{
+  NS_LOG_FUNCTION (this << set);
+
+  std::vector<std::vector<double> > looParameters = m_markovConf->GetLooConf ()->GetParameters (set);
+
+  for (uint32_t i = 0; i < m_numOfStates; i++)
+    {
+      FaderOscillators_t oscillators;
+
+      /// Direct signal: initial phase and theta are common for all oscillators
+      oscillators.m_directPhase = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+      double theta = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+
+      for (uint32_t j = 0; j < looParameters[i][3]; j++)
+        {
+          uint32_t n = j + 1;
+          double alpha = (2.0 * M_PI * n - M_PI + theta) / (4.0 * looParameters[i][3]);
+          oscillators.m_directOmega.push_back (2.0 * M_PI * looParameters[i][5] * std::cos (alpha));
+        }
+
+      /// Multipath: initial phase and theta are common for all oscillators
+      oscillators.m_multipathPhase = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+      theta = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+
+      for (uint32_t j = 0; j < looParameters[i][4]; j++)
+        {
+          uint32_t n = j + 1;
+          double alpha = (2.0 * M_PI * n - M_PI + theta) / (4.0 * looParameters[i][4]);
+          oscillators.m_multipathOmega.push_back (2.0 * M_PI * looParameters[i][6] * std::cos (alpha));
+        }
+
+      oscillators.m_sigma = sqrt (0.5 * pow (10,(looParameters[i][2] / 10)));
+
+      m_oscillators[set].push_back (oscillators);
+    }
+
+  NS_LOG_INFO ("Time " << Now ().GetSeconds () << " SatMarkovFadingEngine::CreateLooOscillators - Created oscillators for set " << set);
+}
+
+void
+SatMarkovFadingEngine::CreateRayleighOscillators (uint32_t set)
+{
+  NS_LOG_FUNCTION (this << set);
+
+  std::vector<std::vector<double> > rayleighParameters = m_markovConf->GetRayleighConf ()->GetParameters (set);
+
+  FaderOscillators_t oscillators;
+  oscillators.m_directPhase = 0.0;
+  oscillators.m_sigma = 1.0;
+
+  /// Initial phase and theta are common for all oscillators
+  oscillators.m_multipathPhase = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+  double theta = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+
+  for (uint32_t i = 0; i < rayleighParameters[0][1]; i++)
+    {
+      uint32_t n = i + 1;
+      double alpha = (2.0 * M_PI * n - M_PI + theta) / (4.0 * rayleighParameters[0][1]);
+      oscillators.m_multipathOmega.push_back (2.0 * rayleighParameters[0][0] * M_PI * std::cos (alpha));
+    }
+
+  m_oscillators[set].push_back (oscillators);
+
+  NS_LOG_INFO ("Time " << Now ().GetSeconds () << " SatMarkovFadingEngine::CreateRayleighOscillators - Created oscillators for set " << set);
+}
+
+void
+SatMarkovFadingEngine::CreateLooAmplitudes (UtFadingState_t &ut)
+{
+  NS_LOG_FUNCTION (this << ut.m_set);
+
+  std::vector<std::vector<double> > looParameters = m_markovConf->GetLooConf ()->GetParameters (ut.m_set);
+
+  ut.m_amplitudes.clear ();
+
+  for (uint32_t i = 0; i < m_numOfStates; i++)
+    {
+      FaderAmplitudes_t amplitudes;
+
+      for (uint32_t j = 0; j < looParameters[i][3]; j++)
+        {
+          double amplitude = m_normalRandomVariable->GetValue (looParameters[i][0], looParameters[i][1]);
+          amplitudes.m_directAmplitude.push_back (pow (10,amplitude / 10) / looParameters[i][3]);
+        }
+
+      for (uint32_t j = 0; j < looParameters[i][4]; j++)
+        {
+          double psi = m_normalRandomVariable->GetValue ();
+          amplitudes.m_multipathAmplitude.push_back (std::complex<double> (std::cos (psi), std::sin (psi)) * 2.0 / std::sqrt (looParameters[i][4]));
+        }
+
+      ut.m_amplitudes.push_back (amplitudes);
+    }
+
+  ut.m_amplitudeSet = ut.m_set;
+}
+
+void
+SatMarkovFadingEngine::CreateRayleighAmplitudes (UtFadingState_t &ut)
+{
+  NS_LOG_FUNCTION (this << ut.m_set);
+
+  std::vector<std::vector<double> > rayleighParameters = m_markovConf->GetRayleighConf ()->GetParameters (ut.m_set);
+
+  FaderAmplitudes_t amplitudes;
+
+  for (uint32_t i = 0; i < rayleighParameters[0][1]; i++)
+    {
+      double psi = m_uniformVariable->GetValue (-1.0 * M_PI, M_PI);
+      amplitudes.m_multipathAmplitude.push_back (std::complex<double> (std::cos (psi), std::sin (psi)) * 2.0 / std::sqrt (rayleighParameters[0][1]));
+    }
+
+  ut.m_amplitudes.clear ();
+  ut.m_amplitudes.push_back (amplitudes);
+  ut.m_amplitudeSet = ut.m_set;
+}
+
+void
+SatMarkovFadingEngine::LockToSetAndState (uint32_t utIndex, uint32_t newSet, uint32_t newState, bool lockState)
+{
+  NS_LOG_FUNCTION (this << utIndex << newSet << newState << lockState);
+
+  NS_ASSERT (utIndex < m_uts.size ());
+
+  if (newState >= m_numOfStates)
+    {
+      NS_FATAL_ERROR ("SatMarkovFadingEngine::LockToSetAndState - Invalid state");
+    }
+  if (newSet >= m_numOfSets)
+    {
+      NS_FATAL_ERROR ("SatMarkovFadingEngine::LockToSetAndState - Invalid set");
+    }
+
+  m_uts[utIndex].m_set = newSet;
+  m_uts[utIndex].m_state = newState;
+  m_uts[utIndex].m_setLocked = true;
+  m_uts[utIndex].m_stateLocked = lockState;
+}
+
+void
+SatMarkovFadingEngine::UnlockSetAndState (uint32_t utIndex)
+{
+  NS_LOG_FUNCTION (this << utIndex);
+
+  NS_ASSERT (utIndex < m_uts.size ());
+
+  m_uts[utIndex].m_setLocked = false;
+  m_uts[utIndex].m_stateLocked = false;
+}
+
+int64_t
+SatMarkovFadingEngine::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_uniformVariable->SetStream (stream);
+  m_normalRandomVariable->SetStream (stream + 1);
+
+  return 2;
+}
+
+uint32_t
+SatMarkovFadingEngine::GetCurrentSet (uint32_t utIndex) const
+{
+  NS_ASSERT (utIndex < m_uts.size ());
+  return m_uts[utIndex].m_set;
+}
+
+uint32_t
+SatMarkovFadingEngine::GetCurrentState (uint32_t utIndex) const
+{
+  NS_ASSERT (utIndex < m_uts.size ());
+  return m_uts[utIndex].m_state;
+}
+
+} // namespace ns3
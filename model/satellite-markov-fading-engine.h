@@ -0,0 +1,341 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_MARKOV_FADING_ENGINE_H
+#define SATELLITE_MARKOV_FADING_ENGINE_H
+
+#include <complex>
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "satellite-enums.h"
+#include "satellite-base-fading.h"
+#include "satellite-markov-conf.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Markov fading engine shared by the Markov fading containers of all
+ * UTs using the same Markov configuration.
+ *
+ * The frequencies and initial phases of the oscillators of the Loo and
+ * Rayleigh faders are created once per probability set (i.e., elevation
+ * bucket) and state, when the set is used for the first time, and shared by
+ * all UTs in that set. Each UT draws its own oscillator amplitudes, i.e. the
+ * Loo direct signal amplitudes and the multipath phasors, for its current
+ * set like the per UT faders did, and draws them again when the set changes.
+ * In addition, each UT has a phase and time offset per link direction.
+ *
+ * Thus, the fading of each UT follows the statistics of its own fader, but
+ * the faders of the UTs in the same set and state have the same Doppler
+ * frequencies. The fading of such UTs is decorrelated by the amplitudes and
+ * the offsets, but it is not fully independent as with separate faders.
+ * Each UT keeps the amplitudes of its set, the shared frequencies are stored
+ * only once.
+ *
+ * Fading is calculated lazily, i.e., only when a fading value is requested
+ * after the cool-down period, and the Markov state transitions are evaluated
+ * only at that time.
+ */
+class SatMarkovFadingEngine : public Object
+{
+public:
+  /**
+   * \brief NS-3 function for type id
+   * \return type id
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Constructor
+   */
+  SatMarkovFadingEngine ();
+
+  /**
+   * \brief Constructor
+   * \param markovConf Markov configuration object.
+   */
+  SatMarkovFadingEngine (Ptr<SatMarkovConf> markovConf);
+
+  /**
+   * \brief Destructor
+   */
+  ~SatMarkovFadingEngine ();
+
+  /**
+   * \brief Do needed dispose actions.
+   */
+  void DoDispose ();
+
+  /**
+   * \brief Add a new UT to the engine
+   * \param elevation Initial elevation angle of the UT
+   * \return Index of the UT in the engine
+   */
+  uint32_t AddUt (double elevation);
+
+  /**
+   * \brief Get the fading value of a UT. A new value is calculated, if the
+   * cool-down period has passed since the previous calculation.
+   * \param utIndex Index of the UT
+   * \param channelType channel type
+   * \param elevation Elevation angle callback of the UT
+   * \param velocity Velocity callback of the UT
+   * \return fading value
+   */
+  double GetFading (uint32_t utIndex,
+                    SatEnums::ChannelType_t channelType,
+                    const SatBaseFading::ElevationCallback &elevation,
+                    const SatBaseFading::VelocityCallback &velocity);
+
+  /**
+   * \brief Lock the parameter set and state of a UT
+   * \param utIndex Index of the UT
+   * \param newSet new set
+   * \param newState new state
+   * \param lockState should the state be locked too
+   */
+  void LockToSetAndState (uint32_t utIndex, uint32_t newSet, uint32_t newState, bool lockState);
+
+  /**
+   * \brief Unlock the parameter set and state of a UT
+   * \param utIndex Index of the UT
+   */
+  void UnlockSetAndState (uint32_t utIndex);
+
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by the engine
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
+  /**
+   * \brief Get the number of states
+   * \return number of states
+   */
+  inline uint32_t GetStateCount () const
+  {
+    return m_numOfStates;
+  }
+
+  /**
+   * \brief Get the number of parameter sets
+   * \return number of parameter sets
+   */
+  inline uint32_t GetSetCount () const
+  {
+    return m_numOfSets;
+  }
+
+  /**
+   * \brief Get the current parameter set of a UT
+   * \param utIndex Index of the UT
+   * \return parameter set
+   */
+  uint32_t GetCurrentSet (uint32_t utIndex) const;
+
+  /**
+   * \brief Get the current state of a UT
+   * \param utIndex Index of the UT
+   * \return state
+   */
+  uint32_t GetCurrentState (uint32_t utIndex) const;
+
+private:
+  /**
+   * \brief Oscillator amplitudes of one fader state of a UT.
+   * Rayleigh faders use only the multipath amplitudes.
+   */
+  typedef struct
+  {
+    std::vector<double> m_directAmplitude;
+    std::vector<std::complex<double> > m_multipathAmplitude;
+  } FaderAmplitudes_t;
+
+  /**
+   * \brief Compact fading state of one UT. Index 0 of the arrays is used
+   * for the uplink and index 1 for the downlink. The amplitudes are drawn
+   * for the set m_amplitudeSet.
+   */
+  typedef struct
+  {
+    uint32_t m_set;
+    uint32_t m_state;
+    bool m_setLocked;
+    bool m_stateLocked;
+    double m_latestStateChangeTime;
+    double m_latestCalculationTime[2];
+    double m_latestFadingValue[2];
+    double m_phaseOffset[2];
+    double m_timeOffset[2];
+    uint32_t m_amplitudeSet;
+    std::vector<FaderAmplitudes_t> m_amplitudes;
+  } UtFadingState_t;
+
+  /**
+   * \brief Oscillators of one fader set and state shared by the UTs.
+   * Rayleigh faders use only the multipath oscillators.
+   */
+  typedef struct
+  {
+    std::vector<double> m_directOmega;
+    double m_directPhase;
+    std::vector<double> m_multipathOmega;
+    double m_multipathPhase;
+    double m_sigma;
+  } FaderOscillators_t;
+
+  /**
+   * \brief Get the link index of the channel type
+   * \param channelType channel type
+   * \return 0 for uplink and 1 for downlink
+   */
+  static uint32_t GetLinkIndex (SatEnums::ChannelType_t channelType);
+
+  /**
+   * \brief Evaluate the set and state change of a UT
+   * \param ut State of the UT
+   * \param elevation Elevation angle callback of the UT
+   * \param velocity Velocity of the UT
+   */
+  void EvaluateStateChange (UtFadingState_t &ut, const SatBaseFading::ElevationCallback &elevation, double velocity);
+
+  /**
+   * \brief Do a Markov state transition
+   * \param set parameter set
+   * \param state current state
+   * \return new state
+   */
+  uint32_t DoTransition (uint32_t set, uint32_t state) const;
+
+  /**
+   * \brief Calculate the fading value of a UT
+   * \param ut State of the UT
+   * \param link link index
+   * \return fading value
+   */
+  double CalculateFading (UtFadingState_t &ut, uint32_t link);
+
+  /**
+   * \brief Get the oscillators of a set and state, creating the oscillators
+   * of the set if it has not been used before.
+   * \param set parameter set
+   * \param state state
+   * \return oscillators
+   */
+  const FaderOscillators_t & GetOscillators (uint32_t set, uint32_t state);
+
+  /**
+   * \brief Create the Loo fader oscillators of a set
+   * \param set parameter set
+   */
+  void CreateLooOscillators (uint32_t set);
+
+  /**
+   * \brief Create the Rayleigh fader oscillators of a set
+   * \param set parameter set
+   */
+  void CreateRayleighOscillators (uint32_t set);
+
+  /**
+   * \brief Draw the Loo fader amplitudes of a UT for its current set
+   * \param ut State of the UT
+   */
+  void CreateLooAmplitudes (UtFadingState_t &ut);
+
+  /**
+   * \brief Draw the Rayleigh fader amplitudes of a UT for its current set
+   * \param ut State of the UT
+   */
+  void CreateRayleighAmplitudes (UtFadingState_t &ut);
+
+  /**
+   * \brief Markov model configuration
+   */
+  Ptr<SatMarkovConf> m_markovConf;
+
+  /**
+   * \brief Fader type
+   */
+  SatMarkovConf::MarkovFaderType_t m_faderType;
+
+  /**
+   * \brief Number of states available
+   */
+  uint32_t m_numOfStates;
+
+  /**
+   * \brief Number of parameter sets available
+   */
+  uint32_t m_numOfSets;
+
+  /**
+   * \brief Cooldown period length in seconds
+   */
+  double m_cooldownPeriodLength;
+
+  /**
+   * \brief Minimum state change distance in meters
+   */
+  double m_minimumPositionChangeInMeters;
+
+  /**
+   * \brief Defines whether the fading values are in decibels or not
+   */
+  bool m_useDecibels;
+
+  /**
+   * \brief Maximum time offset of the UTs
+   */
+  Time m_maxTimeOffset;
+
+  /**
+   * \brief State transition probabilities by set, from state and to state
+   */
+  std::vector<std::vector<std::vector<double> > > m_probabilities;
+
+  /**
+   * \brief Shared oscillators by set and state, empty for unused sets
+   */
+  std::vector<std::vector<FaderOscillators_t> > m_oscillators;
+
+  /**
+   * \brief States of the UTs
+   */
+  std::vector<UtFadingState_t> m_uts;
+
+  /**
+   * \brief Uniform random variable for phases and offsets
+   */
+  Ptr<UniformRandomVariable> m_uniformVariable;
+
+  /**
+   * \brief Normal random variable for the oscillator amplitudes of the UTs
+   */
+  Ptr<NormalRandomVariable> m_normalRandomVariable;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_MARKOV_FADING_ENGINE_H */
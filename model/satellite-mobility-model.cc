@@ -59,7 +59,11 @@ SatMobilityModel::GetInstanceTypeId (void) const
 }
 
 SatMobilityModel::SatMobilityModel ()
-  : m_GetAsGeoCoordinates (true)
+  : m_cartesianPositionOutdated (true),
+    m_geoPositionOutdated (true),
+    m_settingCartesianPosition (false),
+    m_positionVersion (0),
+    m_GetAsGeoCoordinates (true)
 {
 
 }
@@ -71,19 +75,20 @@ SatMobilityModel::~SatMobilityModel ()
 GeoCoordinate
 SatMobilityModel::GetGeoPosition (void) const
 {
-  return DoGetGeoPosition ();
+  return GetCachedGeoPosition ();
 }
 
 void
 SatMobilityModel::SetGeoPosition (const GeoCoordinate &position)
 {
-  m_cartesianPositionOutdated = true;
+  InvalidatePositionCache ();
   DoSetGeoPosition (position);
 }
 
 void
 SatMobilityModel::NotifyGeoCourseChange (void) const
 {
+  InvalidatePositionCache ();
   m_satCourseChangeTrace (this);
   NotifyCourseChange ();
 }
@@ -93,7 +98,7 @@ SatMobilityModel::DoGetPosition (void) const
 {
   if ( m_cartesianPositionOutdated )
     {
-      Vector position = DoGetGeoPosition ().ToVector ();
+      Vector position = GetCachedGeoPosition ().ToVector ();
       DoSetCartesianPosition (position);
     }
 
@@ -105,14 +110,17 @@ SatMobilityModel::DoSetPosition (const Vector &position)
 {
   if ( m_GetAsGeoCoordinates )
     {
-      m_cartesianPositionOutdated = true;
+      InvalidatePositionCache ();
       DoSetGeoPosition ( GeoCoordinate (position.x, position.y, position.z) );
     }
   else
     {
-      m_cartesianPositionOutdated = false;
-      m_cartesianPosition = position;
+      InvalidatePositionCache ();
+      DoSetCartesianPosition (position);
+
+      m_settingCartesianPosition = true;
       DoSetGeoPosition ( GeoCoordinate (position) );
+      m_settingCartesianPosition = false;
     }
 
 }
@@ -124,4 +132,23 @@ SatMobilityModel::DoSetCartesianPosition (const Vector &position) const
   m_cartesianPosition = position;
 }
 
+void
+SatMobilityModel::InvalidatePositionCache (void) const
+{
+  m_positionVersion++;
+  m_geoPositionOutdated = true;
+
+  if ( !m_settingCartesianPosition )
+    {
+      m_cartesianPositionOutdated = true;
+    }
+}
+
+void
+SatMobilityModel::UpdateGeoPositionCache (void) const
+{
+  m_geoPosition = DoGetGeoPosition ();
+  m_geoPositionOutdated = false;
+}
+
 } // namespace ns3
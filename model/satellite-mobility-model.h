@@ -35,6 +35,13 @@ namespace ns3 {
  * in Cartesian coordinates also provided.
  *
  * This is a base class for all satellite mobility models.
+ *
+ * Both the geodetic and the Cartesian form of the current position are cached,
+ * so that frequent position queries (e.g. antenna gain per received burst) do
+ * not need a virtual call nor a coordinate conversion. The caches are
+ * invalidated whenever the position is set, or a subclass notifies a course
+ * change with NotifyGeoCourseChange. Thus, subclasses must call
+ * NotifyGeoCourseChange every time their position changes.
  */
 class SatMobilityModel : public MobilityModel
 {
@@ -68,6 +75,37 @@ public:
 
   void NotifyGeoCourseChange (void) const;
 
+  /**
+   * \brief Get the current position without a virtual call or a copy.
+   *
+   * The returned reference is valid until the position changes next time.
+   *
+   * \return the cached current position in geodetic format
+   */
+  inline const GeoCoordinate & GetCachedGeoPosition (void) const
+  {
+    if (m_geoPositionOutdated)
+      {
+        UpdateGeoPositionCache ();
+      }
+
+    return m_geoPosition;
+  }
+
+  /**
+   * \brief Get the position version.
+   *
+   * The version is incremented every time the position changes, so it can be
+   * used by users of the position to check whether values calculated from
+   * the position are still valid.
+   *
+   * \return the current position version
+   */
+  inline uint32_t GetPositionVersion (void) const
+  {
+    return m_positionVersion;
+  }
+
   /**
    * Callback signature for `SatCourseChange` trace source.
    *
@@ -102,6 +140,17 @@ private:
    */
   void DoSetCartesianPosition (const Vector &position) const;
 
+  /**
+   * Mark the cached positions outdated and increment the position version.
+   * Cartesian position is kept, if it is being set by method DoSetPosition.
+   */
+  void InvalidatePositionCache (void) const;
+
+  /**
+   * Update the cached geodetic position from the subclass.
+   */
+  void UpdateGeoPositionCache (void) const;
+
   /**
    * \return cartesian format position as vector
    *
@@ -130,6 +179,18 @@ private:
   // flag to indicated if position in Cartesian format is out of date.
   mutable bool m_cartesianPositionOutdated;
 
+  // position info in geodetic format
+  mutable GeoCoordinate m_geoPosition;
+
+  // flag to indicated if position in geodetic format is out of date.
+  mutable bool m_geoPositionOutdated;
+
+  // flag to indicate that Cartesian position is being set, so it is not outdated by the change
+  bool m_settingCartesianPosition;
+
+  // incremented every time the position changes
+  mutable uint32_t m_positionVersion;
+
   // this is the flag for indicating that when calling method DoSetPosition (defined by class Mobility Model)
   // is taking Vector filled by longitude (in x), latitude (in y) and altitude (in z)
   // this enables using ns-3 mobility helper without to convert geo coordinates first to Cartesian
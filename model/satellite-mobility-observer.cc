@@ -18,6 +18,7 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
+#include <algorithm>
 #include "ns3/log.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
@@ -95,7 +96,10 @@ SatMobilityObserver::SatMobilityObserver (Ptr<SatMobilityModel> ownMobility, Ptr
     m_geoSatMobility (geoSatMobility),
     m_ownProgDelayModel (NULL),
     m_anotherProgDelayModel (NULL),
-    m_initialized (false)
+    m_initialized (false),
+    m_elevationAngle (NAN),
+    m_ownPositionVersion (0),
+    m_satellitePositionVersion (0)
 {
   NS_LOG_FUNCTION (this << ownMobility << geoSatMobility);
 
@@ -171,9 +175,18 @@ SatMobilityObserver::GetElevationAngle (void)
   if ( m_updateElevationAngle == true )
     {
       // same reference ellipsoide must be used by mobilities
-      NS_ASSERT (m_geoSatMobility->GetGeoPosition ().GetRefEllipsoid () == m_ownMobility->GetGeoPosition ().GetRefEllipsoid () );
+      NS_ASSERT (m_geoSatMobility->GetCachedGeoPosition ().GetRefEllipsoid () == m_ownMobility->GetCachedGeoPosition ().GetRefEllipsoid () );
+
+      // elevation angle depends only on own and satellite positions,
+      // so changes of the another end position do not need re-calculation
+      if ( ( m_ownPositionVersion != m_ownMobility->GetPositionVersion () )
+           || ( m_satellitePositionVersion != m_geoSatMobility->GetPositionVersion () ) )
+        {
+          UpdateElevationAngle ();
+          m_ownPositionVersion = m_ownMobility->GetPositionVersion ();
+          m_satellitePositionVersion = m_geoSatMobility->GetPositionVersion ();
+        }
 
-      UpdateElevationAngle ();
       m_updateElevationAngle = false;
     }
 
@@ -256,8 +269,7 @@ SatMobilityObserver::UpdateElevationAngle ()
 
   m_elevationAngle = NAN;
 
-  GeoCoordinate ownPosition = m_ownMobility->GetGeoPosition ();
-  GeoCoordinate satellitePosition = m_geoSatMobility->GetGeoPosition ();
+  GeoCoordinate ownPosition = m_ownMobility->GetCachedGeoPosition ();
 
   NS_ASSERT ( ownPosition.GetAltitude () >= m_minAltitude && ownPosition.GetAltitude () <= m_maxAltitude );
 
@@ -265,29 +277,28 @@ SatMobilityObserver::UpdateElevationAngle ()
   ownPosition.SetAltitude (0);
 
   // calculate distance from Earth location to satellite
-  double distanceToSatellite = CalculateDistance (ownPosition.ToVector (), satellitePosition.ToVector () );
+  double distanceToSatellite = CalculateDistance (ownPosition.ToVector (), m_satellitePosition );
 
   // calculate elevation angle only, if satellite can be seen from own position
   if ( distanceToSatellite <= m_maxDistanceToSatellite )
     {
       double earthLatitude = SatUtils::DegreesToRadians (ownPosition.GetLatitude ());
-      double satLatitude = SatUtils::DegreesToRadians (satellitePosition.GetLatitude ());
-
       double earthLongitude = SatUtils::DegreesToRadians (ownPosition.GetLongitude ());
-      double satLongitude = SatUtils::DegreesToRadians (satellitePosition.GetLongitude ());
 
-      double longitudeDelta = satLongitude - earthLongitude;
+      double longitudeDelta = m_satelliteLongitude - earthLongitude;
 
       // Calculate cosini of the central angle
       // TODO: Currently we have assumed that the reference ellipsoide is a sphere.
       // This should be accurate enough for elevation angle calculation with also other
       // reference ellipsoides. But, if more accurate calculation is needed, then the used
       // reference ellipsoide is needed to be take into account.
-      double centralAngleCos = ( std::cos (earthLatitude) * std::cos (satLatitude) * std::cos (longitudeDelta) ) +
-        ( std::sin (earthLatitude) * std::sin (satLatitude ) );
+      double centralAngleCos = ( std::cos (earthLatitude) * m_satelliteLatitudeCos * std::cos (longitudeDelta) ) +
+        ( std::sin (earthLatitude) * m_satelliteLatitudeSin );
 
-      // Calculate cosini of the elavation angle
-      double elCos = std::sin ( std::acos (centralAngleCos)) / std::sqrt ( 1 + std::pow (m_radiusRatio, 2) - 2 * m_radiusRatio * centralAngleCos);
+      // Calculate cosini of the elavation angle, sine of the central angle
+      // (within 0...PI) is got directly from its cosini
+      double centralAngleSin = std::sqrt (std::max (0.0, 1 - centralAngleCos * centralAngleCos));
+      double elCos = centralAngleSin / std::sqrt ( 1 + m_radiusRatio * m_radiusRatio - 2 * m_radiusRatio * centralAngleCos);
 
       m_elevationAngle = SatUtils::RadiansToDegrees (std::acos (elCos) );
     }
@@ -311,11 +322,18 @@ void SatMobilityObserver::SatelliteStatusChanged ()
 {
   NS_LOG_FUNCTION (this);
 
-  double satelliteAltitude = m_geoSatMobility->GetGeoPosition ().GetAltitude ();
+  const GeoCoordinate &satellitePosition = m_geoSatMobility->GetCachedGeoPosition ();
+  double satelliteAltitude = satellitePosition.GetAltitude ();
 
   // satellite is expected to be in the sky
   NS_ASSERT ( satelliteAltitude > 0.0 );
 
+  // store satellite values needed in elevation angle calculation
+  m_satellitePosition = satellitePosition.ToVector ();
+  m_satelliteLatitudeSin = std::sin (SatUtils::DegreesToRadians (satellitePosition.GetLatitude ()));
+  m_satelliteLatitudeCos = std::cos (SatUtils::DegreesToRadians (satellitePosition.GetLatitude ()));
+  m_satelliteLongitude = SatUtils::DegreesToRadians (satellitePosition.GetLongitude ());
+
   // calculate maximum distance where UT or GW can be on the Earth.
   double satelliteRadius = satelliteAltitude + m_earthRadius;
   m_maxDistanceToSatellite = std::sqrt ( (satelliteRadius * satelliteRadius) - (m_earthRadius * m_earthRadius) );
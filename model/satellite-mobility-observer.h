@@ -160,6 +160,12 @@ private:
   double m_earthRadius;
   double m_radiusRatio;
   double m_maxDistanceToSatellite;
+  Vector m_satellitePosition;       // satellite position in Cartesian format
+  double m_satelliteLatitudeSin;    // sine of the satellite latitude
+  double m_satelliteLatitudeCos;    // cosine of the satellite latitude
+  double m_satelliteLongitude;      // satellite longitude in radians
+  uint32_t m_ownPositionVersion;        // own position version used for elevation angle
+  uint32_t m_satellitePositionVersion;  // satellite position version used for elevation angle
   Time m_timingAdvance_s;
   double m_velocity;
 };
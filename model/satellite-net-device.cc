@@ -244,6 +244,26 @@ SatNetDevice::GetLlc (void) const
   return m_llc;
 }
 
+int64_t
+SatNetDevice::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  if (m_mac)
+    {
+      currentStream += m_mac->AssignStreams (currentStream);
+    }
+
+  if (m_phy)
+    {
+      currentStream += m_phy->GetPhyRx ()->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 void
 SatNetDevice::SetPacketClassifier (Ptr<SatPacketClassifier> classifier)
 {
@@ -108,6 +108,14 @@ public:
    */
   Ptr<SatLlc> GetLlc (void) const;
 
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the MAC and the PHY of this device.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * \brief Set the packet classifier class
    * \param classifier
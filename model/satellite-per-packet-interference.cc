@@ -90,14 +90,35 @@ SatPerPacketInterference::DoAdd (Time duration, double power, Address rxAddress)
 
   Ptr<SatInterference::InterferenceChangeEvent> event;
   event = Create<SatInterference::InterferenceChangeEvent> (m_nextEventId++, duration, power, rxAddress);
-  Time now = event->GetStartTime ();
 
-  NS_LOG_INFO ( "Add change: Duration= " << duration << ", Power= " << power << ", Time: " << now );
+  AddChange (event->GetId (), event->GetStartTime (), event->GetEndTime (), power);
+
+  return event;
+}
+
+void
+SatPerPacketInterference::DoAddAggregated (Time duration, double power)
+{
+  NS_LOG_FUNCTION (this << duration << power);
+
+  // the changes of the interference-only transmissions are never looked up
+  // by an own event, so they share one reserved id and no event is created,
+  // and the changes at the same time are merged into one change
+  Time now = Simulator::Now ();
+  AddChange (AGGREGATED_CHANGE_ID, now, now + duration, power);
+}
+
+void
+SatPerPacketInterference::AddChange (uint32_t id, Time startTime, Time endTime, double power)
+{
+  NS_LOG_FUNCTION (this << id << startTime << endTime << power);
+
+  NS_LOG_INFO ( "Add change: StartTime= " << startTime << ", Power= " << power << ", EndTime: " << endTime );
 
   // do update and clean-ups, if we are not receiving
   if (!m_rxing)
     {
-      InterferenceChanges::iterator nowIterator = m_interferenceChanges.upper_bound (now);
+      InterferenceChanges::iterator nowIterator = m_interferenceChanges.upper_bound (startTime);
 
       for (InterferenceChanges::iterator i = m_interferenceChanges.begin (); i != nowIterator; i++)
         {
@@ -123,8 +144,16 @@ SatPerPacketInterference::DoAdd (Time duration, double power, Address rxAddress)
         }
     }
 
-  m_interferenceChanges.insert (std::make_pair (now, InterferenceChange (event->GetId (), power)));
-  m_interferenceChanges.insert (std::make_pair (event->GetEndTime (), InterferenceChange (event->GetId (), -power)));
+  if (id == AGGREGATED_CHANGE_ID)
+    {
+      AddAggregatedChange (startTime, power);
+      AddAggregatedChange (endTime, -power);
+    }
+  else
+    {
+      m_interferenceChanges.insert (std::make_pair (startTime, InterferenceChange (id, power)));
+      m_interferenceChanges.insert (std::make_pair (endTime, InterferenceChange (id, -power)));
+    }
 
   NS_LOG_INFO ( "Change count after addition: " << m_interferenceChanges.size () );
 
@@ -133,8 +162,27 @@ SatPerPacketInterference::DoAdd (Time duration, double power, Address rxAddress)
       // First power should never leak negative
       NS_FATAL_ERROR ("First power negative!!!");
     }
+}
 
-  return event;
+void
+SatPerPacketInterference::AddAggregatedChange (Time time, long double power)
+{
+  NS_LOG_FUNCTION (this << time << power);
+
+  // interference-only transmissions starting or ending at the same time
+  // share one change, as only the sum of their powers is needed
+  std::pair<InterferenceChanges::iterator, InterferenceChanges::iterator> range = m_interferenceChanges.equal_range (time);
+
+  for (InterferenceChanges::iterator it = range.first; it != range.second; it++)
+    {
+      if (it->second.first == AGGREGATED_CHANGE_ID)
+        {
+          it->second.second += power;
+          return;
+        }
+    }
+
+  m_interferenceChanges.insert (range.second, std::make_pair (time, InterferenceChange (AGGREGATED_CHANGE_ID, power)));
 }
 
 double
@@ -193,10 +241,14 @@ SatPerPacketInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEv
 
   if (m_enableTraceOutput)
     {
-      std::vector<double> tempVector;
-      tempVector.push_back (Now ().GetSeconds ());
-      tempVector.push_back (ifPowerW / m_rxBandwidth_Hz);
-      Singleton<SatInterferenceOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (event->GetSatEarthStationAddress (), m_channelType), tempVector);
+      Ptr<SatOutputFileStreamDoubleContainer> writer = m_traceWriters.GetWriter (Singleton<SatInterferenceOutputTraceContainer>::Get (),
+                                                                                 std::make_pair (event->GetSatEarthStationAddress (), m_channelType));
+
+      if (writer != NULL)
+        {
+          double values[SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS] = { Now ().GetSeconds (), ifPowerW / m_rxBandwidth_Hz };
+          writer->AddToContainer (values, SatBaseTraceContainer::INTF_TRACE_DEFAULT_NUMBER_OF_COLUMNS);
+        }
     }
 
   return ifPowerW;
@@ -241,6 +293,7 @@ SatPerPacketInterference::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_traceWriters.Clear ();
   SatInterference::DoDispose ();
 }
 
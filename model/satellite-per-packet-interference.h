@@ -89,6 +89,35 @@ private:
    */
   virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd (Time rxDuration, double rxPower, Address rxAddress);
 
+  /**
+   * Adds power of an interference-only transmission to interference object
+   * without creating an interference event for it.
+   *
+   * \param rxDuration Duration of the receiving.
+   * \param rxPower Receiving power.
+   */
+  virtual void DoAddAggregated (Time rxDuration, double rxPower);
+
+  /**
+   * Adds the start and end changes of a transmission to the change list.
+   *
+   * \param id Id of the interference event, AGGREGATED_CHANGE_ID for interference-only transmissions
+   * \param startTime Start time of the transmission
+   * \param endTime End time of the transmission
+   * \param power Receiving power of the transmission
+   */
+  void AddChange (uint32_t id, Time startTime, Time endTime, double power);
+
+  /**
+   * Adds a change of interference-only transmissions to the change list.
+   * The power is added to the existing aggregated change at the same time,
+   * if there is one.
+   *
+   * \param time Time of the change
+   * \param power Power change
+   */
+  void AddAggregatedChange (Time time, long double power);
+
   /**
    * Calculates interference power for the given reference
    * Sets final power at end time to finalPower.
@@ -118,6 +147,11 @@ private:
    */
   virtual void DoNotifyRxEnd (Ptr<SatInterference::InterferenceChangeEvent> event);
 
+  /**
+   * \brief Id of the changes added without an interference event
+   */
+  static const uint32_t AGGREGATED_CHANGE_ID = 0xFFFFFFFF;
+
   /**
    *
    */
@@ -172,6 +206,11 @@ private:
    */
   bool m_enableTraceOutput;
 
+  /**
+   * \brief Interference output trace writers of the traced earth stations
+   */
+  SatOutputTraceWriterCache m_traceWriters;
+
   /**
    *
    */
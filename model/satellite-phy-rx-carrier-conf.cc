@@ -53,7 +53,8 @@ SatPhyRxCarrierConf::SatPhyRxCarrierConf ()
     m_raCollisionModel (RA_COLLISION_NOT_DEFINED),
     m_raConstantErrorRate (0.0),
     m_enableRandomAccessDynamicLoadControl (true),
-		m_randomAccessModel ()
+		m_randomAccessModel (),
+    m_ifMatrix ()
 {
   NS_FATAL_ERROR ("SatPhyRxCarrierConf::SatPhyRxCarrierConf - Constructor not in use");
 }
@@ -78,7 +79,8 @@ SatPhyRxCarrierConf::SatPhyRxCarrierConf (RxCarrierCreateParams_s createParams)
     m_raCollisionModel (createParams.m_raCollisionModel),
     m_raConstantErrorRate (createParams.m_raConstantErrorRate),
     m_enableRandomAccessDynamicLoadControl (true),
-		m_randomAccessModel (createParams.m_randomAccessModel)
+		m_randomAccessModel (createParams.m_randomAccessModel),
+    m_ifMatrix (createParams.m_ifMatrix)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -116,6 +118,7 @@ SatPhyRxCarrierConf::DoDispose ()
   m_linkResults = NULL;
   m_carrierBandwidthConverter.Nullify ();
   m_sinrCalculate.Nullify ();
+  m_ifMatrix = NULL;
 
   Object::DoDispose ();
 }
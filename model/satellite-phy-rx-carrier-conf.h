@@ -26,6 +26,7 @@
 #include "satellite-channel.h"
 #include "satellite-link-results.h"
 #include "satellite-channel-estimation-error-container.h"
+#include "satellite-beam-interference-matrix.h"
 #include "satellite-typedefs.h"
 
 namespace ns3 {
@@ -71,7 +72,7 @@ public:
    */
   enum InterferenceModel
   {
-    IF_PER_PACKET, IF_TRACE, IF_CONSTANT
+    IF_PER_PACKET, IF_TRACE, IF_CONSTANT, IF_BEAM_MATRIX
   };
 
   /**
@@ -94,6 +95,7 @@ public:
    * \param converter Bandwidth converter
    * \param carrierCount carrier count
    * \param cec Channel estimation error container
+   * \param ifMatrix Beam interference matrix for the beam matrix interference model
    */
   typedef struct RxCarrierCreateParams_s
   {
@@ -112,6 +114,7 @@ public:
     RandomAccessCollisionModel               m_raCollisionModel;
     double                                   m_raConstantErrorRate;
     SatEnums::RandomAccessModel_t            m_randomAccessModel;
+    Ptr<SatBeamInterferenceMatrix>           m_ifMatrix;
 
     RxCarrierCreateParams_s ()
       : m_rxTemperatureK (0.0),
@@ -128,7 +131,8 @@ public:
         m_cec (NULL),
         m_raCollisionModel (SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR),
         m_raConstantErrorRate (0.0),
-				m_randomAccessModel (SatEnums::RA_MODEL_OFF)
+				m_randomAccessModel (SatEnums::RA_MODEL_OFF),
+        m_ifMatrix (NULL)
     {
       // do nothing
     }
@@ -294,6 +298,12 @@ public:
 
   inline SatEnums::RandomAccessModel_t GetRandomAccessModel () const { return m_randomAccessModel; };
 
+  /**
+   * \brief Get the beam interference matrix used by the beam matrix interference model
+   * \return beam interference matrix, NULL if not set
+   */
+  inline Ptr<SatBeamInterferenceMatrix> GetInterferenceMatrix () const { return m_ifMatrix; };
+
 private:
   /*
    * Note, that different carriers may be different bandwidth (symbol rate).
@@ -321,6 +331,7 @@ private:
   double m_raConstantErrorRate;
   bool m_enableRandomAccessDynamicLoadControl;
   SatEnums::RandomAccessModel_t m_randomAccessModel;
+  Ptr<SatBeamInterferenceMatrix> m_ifMatrix;
 };
 
 } // namespace ns3
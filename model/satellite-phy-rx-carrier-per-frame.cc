@@ -166,6 +166,8 @@ SatPhyRxCarrierPerFrame::DoFrameEnd ()
 
       NS_LOG_INFO ("SatPhyRxCarrier::DoFrameEnd - Packets in container, will process the frame");
 
+      CalculateFrameSinrs ();
+
       std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s> results = ProcessFrame ();
 
       if (!m_crdsaPacketContainer.empty ())
@@ -399,6 +401,36 @@ SatPhyRxCarrierPerFrame::AddCrdsaPacket (SatPhyRxCarrierPerFrame::crdsaPacketRxP
     }
 }
 
+void
+SatPhyRxCarrierPerFrame::CalculateFrameSinrs ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::map<uint32_t,std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s> >::iterator iter;
+  for (iter = m_crdsaPacketContainer.begin (); iter != m_crdsaPacketContainer.end (); iter++)
+    {
+      std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>::iterator iterList;
+      for (iterList = iter->second.begin (); iterList != iter->second.end (); iterList++)
+        {
+          Ptr<SatSignalParameters> rxParams = iterList->rxParams;
+
+          iterList->sinr = CalculateSinr ( rxParams->m_rxPower_W,
+                                           rxParams->m_ifPower_W,
+                                           m_rxNoisePowerW,
+                                           m_rxAciIfPowerW,
+                                           m_rxExtNoisePowerW,
+                                           m_sinrCalculate);
+
+          iterList->sinrSatellite = CalculateSinr ( rxParams->m_rxPowerInSatellite_W,
+                                                    rxParams->m_ifPowerInSatellite_W,
+                                                    rxParams->m_rxNoisePowerInSatellite_W,
+                                                    rxParams->m_rxAciIfPowerInSatellite_W,
+                                                    rxParams->m_rxExtNoisePowerInSatellite_W,
+                                                    rxParams->m_sinrCalculate);
+        }
+    }
+}
+
 std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>
 SatPhyRxCarrierPerFrame::ProcessFrame ()
 {
@@ -565,19 +597,9 @@ SatPhyRxCarrierPerFrame::ProcessReceivedCrdsaPacket (SatPhyRxCarrierPerFrame::cr
                " RX gnd: " << packet.rxParams->m_rxPower_W <<
                " IF gnd: " << packet.rxParams->m_ifPower_W);
 
-  double sinrSatellite = CalculateSinr ( packet.rxParams->m_rxPowerInSatellite_W,
-                                         packet.rxParams->m_ifPowerInSatellite_W,
-                                         packet.rxParams->m_rxNoisePowerInSatellite_W,
-                                         packet.rxParams->m_rxAciIfPowerInSatellite_W,
-                                         packet.rxParams->m_rxExtNoisePowerInSatellite_W,
-                                         packet.rxParams->m_sinrCalculate);
-
-  double sinr = CalculateSinr ( packet.rxParams->m_rxPower_W,
-                                packet.rxParams->m_ifPower_W,
-                                m_rxNoisePowerW,
-                                m_rxAciIfPowerW,
-                                m_rxExtNoisePowerW,
-                                m_sinrCalculate);
+  /// the SINRs are calculated at the frame end and updated by the interference elimination
+  double sinrSatellite = packet.sinrSatellite;
+  double sinr = packet.sinr;
 
   /*
    * Update link specific SINR trace for the RETURN_FEEDER link. The RETURN_USER
@@ -726,6 +748,14 @@ SatPhyRxCarrierPerFrame::EliminateInterference (
               NS_FATAL_ERROR ("SatPhyRxCarrierPerFrame::EliminateInterference - Negative interference");
             }
 
+          /// update the satellite SINR with the reduced interference
+          iterList->sinrSatellite = CalculateSinr ( iterList->rxParams->m_rxPowerInSatellite_W,
+                                                    iterList->rxParams->m_ifPowerInSatellite_W,
+                                                    iterList->rxParams->m_rxNoisePowerInSatellite_W,
+                                                    iterList->rxParams->m_rxAciIfPowerInSatellite_W,
+                                                    iterList->rxParams->m_rxExtNoisePowerInSatellite_W,
+                                                    iterList->rxParams->m_sinrCalculate);
+
           NS_LOG_INFO ("SatPhyRxCarrierPerFrame::EliminateInterference- AFTER INTERFERENCE ELIMINATION, RX sat: " <<
           							iterList->rxParams->m_rxPowerInSatellite_W <<
                        " IF sat: " << iterList->rxParams->m_ifPowerInSatellite_W <<
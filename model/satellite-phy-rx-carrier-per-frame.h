@@ -62,6 +62,8 @@ public:
     double cSinr;
     double ifPower;
     bool phyError;
+    double sinr;
+    double sinrSatellite;
   } crdsaPacketRxParams_s;
 
 	/**
@@ -209,6 +211,15 @@ private:
    */
   void UpdateRandomAccessLoad ();
 
+  /**
+   * \brief Calculate the SINRs of all the CRDSA packets of the frame in one
+   * pass. The SINRs of the return feeder link and the return user link (i.e.
+   * in the satellite) are stored to the packets in place. The feeder
+   * link SINR does not change during the frame processing, and the satellite
+   * SINR is updated when interference is eliminated.
+   */
+  void CalculateFrameSinrs ();
+
   /**
    * Process received CRDSA packet.
    */
@@ -25,6 +25,7 @@
 #include <ns3/satellite-constant-interference.h>
 #include <ns3/satellite-per-packet-interference.h>
 #include <ns3/satellite-traced-interference.h>
+#include <ns3/satellite-beam-matrix-interference.h>
 #include <ns3/satellite-mac-tag.h>
 #include <ns3/singleton.h>
 #include <ns3/satellite-composite-sinr-output-trace-container.h>
@@ -55,9 +56,11 @@ SatPhyRxCarrier::SatPhyRxCarrier (uint32_t carrierId, Ptr<SatPhyRxCarrierConf> c
     m_carrierId (carrierId),
     m_receivingDedicatedAccess (false),
     m_satInterference (),
+    m_rxPowerUsed (false),
     m_enableCompositeSinrOutputTrace (false),
     m_numOfOngoingRx (0),
-    m_rxPacketCounter (0)
+    m_rxPacketCounter (0),
+    m_compositeSinrTraceResetCount (0)
 {
   NS_LOG_FUNCTION (this << carrierId);
 
@@ -77,6 +80,10 @@ SatPhyRxCarrier::SatPhyRxCarrier (uint32_t carrierId, Ptr<SatPhyRxCarrierConf> c
     {
       NS_LOG_INFO (this << " link results in use in carrier: " << carrierId);
       m_linkResults = carrierConf->GetLinkResults ();
+
+      // resolve the link results of the carrier once, instead of every error check
+      m_linkResultsDvbS2 = m_linkResults->GetObject <SatLinkResultsDvbS2> ();
+      m_linkResultsDvbRcs2 = m_linkResults->GetObject <SatLinkResultsDvbRcs2> ();
     }
 
   m_rxTemperatureK = carrierConf->GetRxTemperatureK ();
@@ -117,6 +124,7 @@ SatPhyRxCarrier::DoCreateInterferenceModel (Ptr<SatPhyRxCarrierConf> carrierConf
       {
         NS_LOG_INFO (this << " Constant interference model created for carrier: " << carrierId);
         m_satInterference = CreateObject<SatConstantInterference> ();
+        m_rxPowerUsed = false;
         break;
       }
     case SatPhyRxCarrierConf::IF_PER_PACKET:
@@ -130,12 +138,34 @@ SatPhyRxCarrier::DoCreateInterferenceModel (Ptr<SatPhyRxCarrierConf> carrierConf
           {
             m_satInterference = CreateObject<SatPerPacketInterference> ();
           }
+        m_rxPowerUsed = true;
         break;
       }
     case SatPhyRxCarrierConf::IF_TRACE:
       {
         NS_LOG_INFO (this << " Traced interference model created for carrier: " << carrierId);
         m_satInterference = CreateObject<SatTracedInterference> (GetChannelType (), rxBandwidthHz);
+        m_rxPowerUsed = false;
+        break;
+      }
+    case SatPhyRxCarrierConf::IF_BEAM_MATRIX:
+      {
+        NS_LOG_INFO (this << " Beam matrix interference model created for carrier: " << carrierId);
+        if (GetChannelType () != SatEnums::FORWARD_USER_CH)
+          {
+            NS_FATAL_ERROR ("SatPhyRxCarrier::DoCreateInterferenceModel - Beam matrix interference model supported only in forward user link");
+          }
+        if (carrierConf->IsIntfOutputTraceEnabled ())
+          {
+            m_satInterference = CreateObject<SatBeamMatrixInterference> (carrierConf->GetInterferenceMatrix (), carrierId,
+                                                                         GetChannelType (), rxBandwidthHz);
+          }
+        else
+          {
+            m_satInterference = CreateObject<SatBeamMatrixInterference> (carrierConf->GetInterferenceMatrix (), carrierId);
+          }
+        // only the power of the received transmission is used
+        m_rxPowerUsed = false;
         break;
       }
     default:
@@ -199,6 +229,10 @@ SatPhyRxCarrier::DoDispose ()
   m_avgNormalizedOfferedLoadCallback.Nullify ();
   m_satInterference = NULL;
   m_uniformVariable = NULL;
+  m_linkResultsDvbS2 = NULL;
+  m_linkResultsDvbRcs2 = NULL;
+  m_compositeSinrTraceWriter = NULL;
+  m_rxParamsStore.clear ();
 
   Object::DoDispose ();
 }
@@ -244,15 +278,123 @@ SatPhyRxCarrier::ChangeState (State newState)
 }
 
 
+SatPhyRxCarrier::rxParams_s
+SatPhyRxCarrier::GetStoredRxParams (uint32_t key) const
+{
+  NS_ASSERT (!m_rxParamsStore.empty ());
+
+  const rxParamsRecord_s &record = m_rxParamsStore[key & (m_rxParamsStore.size () - 1)];
+
+  NS_ASSERT (record.stored && record.key == key);
+
+  return record.params;
+}
+
+void
+SatPhyRxCarrier::StoreRxParams (uint32_t key, rxParams_s rxParams)
+{
+  NS_LOG_FUNCTION (this << key);
+
+  while (m_rxParamsStore.empty () || m_rxParamsStore[key & (m_rxParamsStore.size () - 1)].stored)
+    {
+      GrowRxParamsStore ();
+    }
+
+  rxParamsRecord_s &record = m_rxParamsStore[key & (m_rxParamsStore.size () - 1)];
+
+  record.key = key;
+  record.stored = true;
+  record.params = rxParams;
+}
+
+void
+SatPhyRxCarrier::RemoveStoredRxParams (uint32_t key)
+{
+  NS_LOG_FUNCTION (this << key);
+  NS_ASSERT (!m_rxParamsStore.empty ());
+
+  rxParamsRecord_s &record = m_rxParamsStore[key & (m_rxParamsStore.size () - 1)];
+
+  NS_ASSERT (record.stored && record.key == key);
+
+  // release the pointers, but keep the record allocated
+  record.stored = false;
+  record.params.rxParams = NULL;
+  record.params.interferenceEvent = NULL;
+}
+
+void
+SatPhyRxCarrier::GrowRxParamsStore ()
+{
+  NS_LOG_FUNCTION (this << m_rxParamsStore.size ());
+
+  uint32_t capacity = m_rxParamsStore.empty () ? 16 : 2 * m_rxParamsStore.size ();
+
+  rxParamsRecord_s emptyRecord;
+  emptyRecord.key = 0;
+  emptyRecord.stored = false;
+
+  std::vector<rxParamsRecord_s> store (capacity, emptyRecord);
+
+  // the stored records do not collide in the new storage, because they
+  // did not collide with the smaller capacity
+  for (std::vector<rxParamsRecord_s>::const_iterator it = m_rxParamsStore.begin (); it != m_rxParamsStore.end (); ++it)
+    {
+      if (it->stored)
+        {
+          store[it->key & (capacity - 1)] = *it;
+        }
+    }
+
+  m_rxParamsStore.swap (store);
+}
+
 std::pair<bool, SatPhyRxCarrier::rxParams_s>
 SatPhyRxCarrier::GetReceiveParams (Ptr<SatSignalParameters> rxParams)
 {
 	SatPhyRxCarrier::rxParams_s params;
 	params.rxParams = rxParams;
+
+  // Use the decision of the receive filtering, if the destinations were resolved already
+  if (rxParams->m_rxDecision.resolved)
+    {
+      params.destAddress = rxParams->m_rxDecision.destAddress;
+      params.sourceAddress = rxParams->m_rxDecision.sourceAddress;
+
+      return std::make_pair (rxParams->m_rxDecision.receive, params);
+    }
+
 	// Receive packet by default in satellite, discard in UT
   bool receivePacket = GetDefaultReceiveMode ();
   bool ownAddressFound = false;
 
+  // Use the address summary of the burst, if available
+  Ptr<const SatSignalParameters::AddressSummary> summary = rxParams->m_addressSummary;
+
+  if (summary != NULL && !rxParams->m_packetsInBurst.empty ())
+    {
+      if (summary->FindUnicastDestination (GetOwnAddress (), params.sourceAddress))
+        {
+          NS_LOG_INFO ("Packet intended for this specific receiver: " << GetOwnAddress ());
+
+          params.destAddress = GetOwnAddress ();
+          receivePacket = true;
+        }
+      else
+        {
+          params.destAddress = summary->m_lastDestAddress;
+          params.sourceAddress = summary->m_lastSourceAddress;
+
+          if (summary->m_hasBroadcastDest || summary->m_hasGroupDest)
+            {
+              NS_LOG_INFO ("Burst contains broadcast or multicast packets");
+              receivePacket = true;
+            }
+        }
+
+      return std::make_pair (receivePacket, params);
+    }
+
   for (SatSignalParameters::PacketsInBurst_t::const_iterator i = rxParams->m_packetsInBurst.begin ();
        ((i != rxParams->m_packetsInBurst.end ()) && (ownAddressFound == false) ); i++)
     {
@@ -334,9 +476,22 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
             // Update link specific received signal power
             m_rxPowerTrace (SatUtils::LinearToDb (rxParams->m_rxPower_W));
 
-            Simulator::Schedule (rxParams->m_duration, &SatPhyRxCarrier::EndRxData, this, key);
-
             IncreaseNumOfRxState (rxParams->m_txInfo.packetType);
+
+            // In the bent pipe mode, the burst is received and forwarded at once
+            if (rxParams->m_bentPipe)
+              {
+                if (m_rxPowerUsed)
+                  {
+                    NS_FATAL_ERROR ("SatPhyRxCarrier::StartRx - Bent pipe mode not supported with an interference model using the Rx powers");
+                  }
+
+                EndRxData (key);
+              }
+            else
+              {
+                Simulator::Schedule (rxParams->m_duration, &SatPhyRxCarrier::EndRxData, this, key);
+              }
           }
         break;
       }
@@ -349,17 +504,109 @@ SatPhyRxCarrier::StartRx (Ptr<SatSignalParameters> rxParams)
 }
 
 
+void
+SatPhyRxCarrier::SetBeamId (uint32_t beamId)
+{
+  NS_LOG_FUNCTION (this << beamId);
+
+  m_beamId = beamId;
+
+  Ptr<SatBeamMatrixInterference> beamMatrixInterference = DynamicCast<SatBeamMatrixInterference> (m_satInterference);
+
+  if (beamMatrixInterference != NULL)
+    {
+      beamMatrixInterference->SetBeamId (beamId);
+    }
+}
+
+
+SatEnums::RxFilterResult_t
+SatPhyRxCarrier::GetRxFilterResult (Ptr<SatSignalParameters> rxParams,
+                                    SatSignalParameters::rxDecision_s &rxDecision)
+{
+  NS_LOG_FUNCTION (this << rxParams);
+
+  if (GetChannelType () != SatEnums::FORWARD_USER_CH)
+    {
+      return SatEnums::RX_FILTER_RECEIVE;
+    }
+
+  if (rxParams->m_beamId == GetBeamId ())
+    {
+      std::pair<bool, rxParams_s> receiveParams = GetReceiveParams (rxParams);
+
+      rxDecision.resolved = true;
+      rxDecision.receive = receiveParams.first;
+      rxDecision.destAddress = receiveParams.second.destAddress;
+      rxDecision.sourceAddress = receiveParams.second.sourceAddress;
+
+      if (rxDecision.receive)
+        {
+          return SatEnums::RX_FILTER_RECEIVE;
+        }
+    }
+
+  if (m_rxPowerUsed)
+    {
+      return SatEnums::RX_FILTER_INTERFERENCE_ONLY;
+    }
+
+  NS_LOG_INFO ("Node: " << m_nodeInfo->GetMacAddress () << " discards transmission in carrier: " << rxParams->m_carrierId);
+
+  return SatEnums::RX_FILTER_DISCARD;
+}
+
+
+int64_t
+SatPhyRxCarrier::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  m_uniformVariable->SetStream (currentStream++);
+
+  if (m_channelEstimationError != NULL)
+    {
+      currentStream += m_channelEstimationError->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
+
+void
+SatPhyRxCarrier::StartRxInterference (Ptr<SatSignalParameters> rxParams)
+{
+  NS_LOG_FUNCTION (this << rxParams);
+  NS_ASSERT (rxParams->m_carrierId == m_carrierId);
+  NS_ASSERT (GetChannelType () == SatEnums::FORWARD_USER_CH);
+
+  GetInterferenceModel ()->AddAggregated (rxParams->m_duration, rxParams->m_rxPower_W);
+}
+
+
 void
 SatPhyRxCarrier::DoCompositeSinrOutputTrace (double cSinr)
 {
   NS_LOG_FUNCTION (this);
   NS_LOG_INFO ("SatPhyRxCarrier::DoCompositeSinrOutputTrace");
 
-  std::vector<double> tempVector;
-  tempVector.push_back (Now ().GetSeconds ());
-  tempVector.push_back (cSinr);
+  Ptr<SatCompositeSinrOutputTraceContainer> traceContainer = Singleton<SatCompositeSinrOutputTraceContainer>::Get ();
 
-  Singleton<SatCompositeSinrOutputTraceContainer>::Get ()->AddToContainer (std::make_pair (GetOwnAddress (), GetChannelType ()), tempVector);
+  // The writer of the carrier is searched until it is found and again after
+  // the trace container has been reset, since the reset releases the writers
+  if ((m_compositeSinrTraceWriter == NULL) || (m_compositeSinrTraceResetCount != traceContainer->GetResetCount ()))
+    {
+      m_compositeSinrTraceWriter = traceContainer->GetWriter (std::make_pair (GetOwnAddress (), GetChannelType ()));
+      m_compositeSinrTraceResetCount = traceContainer->GetResetCount ();
+    }
+
+  if (m_compositeSinrTraceWriter != NULL)
+    {
+      double values[SatBaseTraceContainer::CSINR_TRACE_DEFAULT_NUMBER_OF_COLUMNS] = { Now ().GetSeconds (), cSinr };
+      m_compositeSinrTraceWriter->AddToContainer (values, SatBaseTraceContainer::CSINR_TRACE_DEFAULT_NUMBER_OF_COLUMNS);
+    }
 }
 
 
@@ -427,9 +674,9 @@ SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSign
 			 * fs = symbol rate in baud
 			*/
 
-			double ber = (GetLinkResults ()->GetObject <SatLinkResultsDvbS2> ())->GetBler (rxParams->m_txInfo.modCod,
-																																								 rxParams->m_txInfo.frameType,
-																																								 SatUtils::LinearToDb (cSinr));
+			double ber = m_linkResultsDvbS2->GetBler (rxParams->m_txInfo.modCod,
+			                                          rxParams->m_txInfo.frameType,
+			                                          SatUtils::LinearToDb (cSinr));
 			double r = GetUniformRandomValue (0, 1);
 
 			if ( r < ber )
@@ -466,8 +713,8 @@ SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi (double cSinr, Ptr<SatSign
 			double ebNo = cSinr / (SatUtils::GetCodingRate (rxParams->m_txInfo.modCod) *
 														 SatUtils::GetModulatedBits (rxParams->m_txInfo.modCod));
 
-			double ber = (GetLinkResults ()->GetObject <SatLinkResultsDvbRcs2> ())->GetBler (rxParams->m_txInfo.waveformId,
-																																									 SatUtils::LinearToDb (ebNo));
+			double ber = m_linkResultsDvbRcs2->GetBler (rxParams->m_txInfo.waveformId,
+			                                            SatUtils::LinearToDb (ebNo));
 			double r = GetUniformRandomValue (0, 1);
 
 			if ( r < ber )
@@ -32,6 +32,7 @@
 #include <ns3/satellite-phy.h>
 #include <ns3/satellite-phy-rx.h>
 #include <ns3/satellite-phy-rx-carrier-conf.h>
+#include <ns3/satellite-output-fstream-double-container.h>
 #include <vector>
 #include <map>
 #include <list>
@@ -157,7 +158,7 @@ public:
    * \brief Function for setting the beam id for all the transmissions from this SatPhyTx
    * \param beamId the Beam Identifier
    */
-  inline void SetBeamId (uint32_t beamId) { m_beamId = beamId; };
+  void SetBeamId (uint32_t beamId);
 
   /**
    * \brief Get ID the ID of the beam this carrier is attached to
@@ -178,6 +179,39 @@ public:
    */
   void StartRx (Ptr<SatSignalParameters> rxParams);
 
+  /**
+   * \brief Function for checking, before the Rx power of a transmission is
+   * calculated, whether the carrier needs the transmission at all. Only the
+   * transmissions of the forward user link are filtered, others are always
+   * received. The transmissions not intended for this receiver are needed only
+   * as interference, if the interference model uses the power of the
+   * individual transmissions. The receive decision made for the transmissions
+   * of the own beam is passed to the reception, so that the destinations of
+   * the burst are resolved only once.
+   * \param rxParams The parameters of the transmission
+   * \param rxDecision Receive decision, set if resolved by the filtering
+   * \return Result of the filtering
+   */
+  virtual SatEnums::RxFilterResult_t GetRxFilterResult (Ptr<SatSignalParameters> rxParams,
+                                                        SatSignalParameters::rxDecision_s &rxDecision);
+
+  /**
+   * \brief Function for starting reception of a transmission from the
+   * SatChannel, which is needed only as interference. The power of the
+   * transmission is aggregated to the interference model without creating
+   * an interference event.
+   * \param rxParams The needed parameters for the received signal
+   */
+  void StartRxInterference (Ptr<SatSignalParameters> rxParams);
+
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by this carrier, including the channel estimation errors.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned by this carrier
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * \brief Method for querying the type of the carrier
    */
@@ -246,13 +280,13 @@ protected:
 	std::pair<bool, SatPhyRxCarrier::rxParams_s> GetReceiveParams (Ptr<SatSignalParameters> rxParams);
 
 	/// Get stored rxParams under a key
-  inline rxParams_s GetStoredRxParams (uint32_t key) { return m_rxParamsMap[key]; }
+  rxParams_s GetStoredRxParams (uint32_t key) const;
 
   /// Store rxParams under a key
-  inline void StoreRxParams (uint32_t key, rxParams_s rxParams) { m_rxParamsMap[key] = rxParams; }
+  void StoreRxParams (uint32_t key, rxParams_s rxParams);
 
   /// Remove stored rxParams under a key
-  inline void RemoveStoredRxParams (uint32_t key) { m_rxParamsMap.erase (key); }
+  void RemoveStoredRxParams (uint32_t key);
 
   /**
    * Get the MAC address of the carrier
@@ -517,6 +551,7 @@ private:
   uint32_t m_carrierId; 												//< Carrier ID
   bool m_receivingDedicatedAccess; 							//< Is the carrier receiving a dedicated access packet
   Ptr<SatInterference> m_satInterference; 			//< Interference model
+  bool m_rxPowerUsed;											//< Does the interference model use the Rx powers of the transmissions
   bool m_enableCompositeSinrOutputTrace;				//< Enable composite SINR output tracing
 
   /**
@@ -529,11 +564,37 @@ private:
    */
   uint32_t m_rxPacketCounter;
 
-  std::map<uint32_t, rxParams_s> m_rxParamsMap; //< Storage for Rx parameters by ID
+  /**
+   * \brief Record of the stored Rx parameters
+   */
+  typedef struct
+  {
+    uint32_t key;
+    bool stored;
+    rxParams_s params;
+  } rxParamsRecord_s;
+
+  /**
+   * \brief Storage for Rx parameters by ID. A record is located at the ID
+   * modulo the capacity of the storage, which is a power of two. The storage
+   * is grown, when the location of a new record is still in use.
+   */
+  std::vector<rxParamsRecord_s> m_rxParamsStore;
+
+  /**
+   * \brief Grow the storage of the Rx parameters to double capacity and
+   * relocate the stored records.
+   */
+  void GrowRxParamsStore ();
+
   Mac48Address m_ownAddress; 										//< Carrier address
   Ptr<SatNodeInfo> m_nodeInfo; 									//< NodeInfo of the node where carrier is attached
   SatEnums::ChannelType_t m_channelType;				//< Channel type
   Ptr<SatLinkResults> m_linkResults; 						//< Link results from the carrier configuration
+  Ptr<SatLinkResultsDvbS2> m_linkResultsDvbS2;		//< DVB-S2 link results, if used by the carrier
+  Ptr<SatLinkResultsDvbRcs2> m_linkResultsDvbRcs2;	//< DVB-RCS2 link results, if used by the carrier
+  Ptr<SatOutputFileStreamDoubleContainer> m_compositeSinrTraceWriter;	//< Composite SINR trace writer, resolved at the first sample
+  uint32_t m_compositeSinrTraceResetCount;			//< Reset count of the trace container when the writer was resolved
   Ptr<UniformRandomVariable> m_uniformVariable;	//< Uniform helper random variable
   SatPhyRxCarrierConf::ErrorModel m_errorModel;	//< Error model
   double m_constantErrorRate;										//< Error rate for constant error model
@@ -115,8 +115,11 @@ SatPhyRx::GetAntennaGain (Ptr<MobilityModel> mobility)
   // E.g. UT transmits to the satellite receiver.
   if (m_antennaGainPattern)
     {
-      Ptr<SatMobilityModel> m = DynamicCast<SatMobilityModel> (mobility);
-      gain_W = m_antennaGainPattern->GetAntennaGain_lin (m->GetGeoPosition ());
+      // Called for every received burst, thus avoid the cost of DynamicCast and
+      // copying the position. Satellite mobility is always used with antenna patterns.
+      NS_ASSERT (DynamicCast<SatMobilityModel> (mobility) != NULL);
+      const SatMobilityModel *m = static_cast<const SatMobilityModel *> (PeekPointer (mobility));
+      gain_W = m_antennaGainPattern->GetAntennaGain_lin (m->GetCachedGeoPosition ());
     }
 
   /**
@@ -391,4 +394,50 @@ SatPhyRx::StartRx (Ptr<SatSignalParameters> rxParams)
   m_rxCarriers[cId]->StartRx (rxParams);
 }
 
+SatEnums::RxFilterResult_t
+SatPhyRx::GetRxFilterResult (Ptr<SatSignalParameters> rxParams,
+                             SatSignalParameters::rxDecision_s &rxDecision)
+{
+  NS_LOG_FUNCTION (this << rxParams);
+
+  uint32_t cId = rxParams->m_carrierId;
+
+  if (cId >= m_rxCarriers.size ())
+    {
+      NS_FATAL_ERROR ("SatPhyRx::GetRxFilterResult - unvalid carrier id: " << cId);
+    }
+
+  return m_rxCarriers[cId]->GetRxFilterResult (rxParams, rxDecision);
+}
+
+void
+SatPhyRx::StartRxInterference (Ptr<SatSignalParameters> rxParams)
+{
+  NS_LOG_FUNCTION (this << rxParams);
+
+  uint32_t cId = rxParams->m_carrierId;
+
+  if (cId >= m_rxCarriers.size ())
+    {
+      NS_FATAL_ERROR ("SatPhyRx::StartRxInterference - unvalid carrier id: " << cId);
+    }
+
+  m_rxCarriers[cId]->StartRxInterference (rxParams);
+}
+
+int64_t
+SatPhyRx::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  for (std::vector< Ptr<SatPhyRxCarrier> >::iterator it = m_rxCarriers.begin (); it != m_rxCarriers.end (); ++it)
+    {
+      currentStream += (*it)->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 } // namespace ns3
@@ -155,6 +155,31 @@ public:
    */
   void StartRx (Ptr<SatSignalParameters> rxParams);
 
+  /**
+   * Check whether the receiver needs a transmission of the SatChannel at all,
+   * before its Rx power is calculated.
+   * \param rxParams The parameters of the transmission
+   * \param rxDecision Receive decision of the Rx carrier, set if resolved by the filtering
+   * \return Result of the filtering by the Rx carrier of the transmission
+   */
+  SatEnums::RxFilterResult_t GetRxFilterResult (Ptr<SatSignalParameters> rxParams,
+                                                SatSignalParameters::rxDecision_s &rxDecision);
+
+  /**
+   * Start reception of a transmission from the SatChannel, which is needed
+   * only as interference.
+   * \param rxParams The needed parameters for the received signal
+   */
+  void StartRxInterference (Ptr<SatSignalParameters> rxParams);
+
+  /**
+   * Assign fixed random variable stream numbers to the random variables
+   * used by the Rx carriers.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * \param SatSignalParameters containing e.g. the received packet
    * \param boolean indicating whether there was a PHY error
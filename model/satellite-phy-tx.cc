@@ -117,8 +117,11 @@ SatPhyTx::GetAntennaGain (Ptr<MobilityModel> mobility)
   // E.g. GEO satellite transmits to the UT receiver.
   if (m_antennaGainPattern)
     {
-      Ptr<SatMobilityModel> m = DynamicCast<SatMobilityModel> (mobility);
-      gain_W = m_antennaGainPattern->GetAntennaGain_lin (m->GetGeoPosition ());
+      // Called for every received burst, thus avoid the cost of DynamicCast and
+      // copying the position. Satellite mobility is always used with antenna patterns.
+      NS_ASSERT (DynamicCast<SatMobilityModel> (mobility) != NULL);
+      const SatMobilityModel *m = static_cast<const SatMobilityModel *> (PeekPointer (mobility));
+      gain_W = m_antennaGainPattern->GetAntennaGain_lin (m->GetCachedGeoPosition ());
     }
 
   /**
@@ -322,6 +322,7 @@ SatPhy::SendPdu (PacketContainer_t p, uint32_t carrierId, Time duration, SatSign
   txParams->m_duration = duration;
   txParams->m_phyTx = m_phyTx;
   txParams->m_packetsInBurst = p;
+  txParams->m_addressSummary = Create<SatSignalParameters::AddressSummary> (p);
   txParams->m_beamId = m_beamId;
   txParams->m_carrierId = carrierId;
   txParams->m_sinr = 0;
@@ -263,11 +263,14 @@ SatSpotBeamPositionAllocator::GetNextGeoPosition () const
   uint32_t tries (0);
   GeoCoordinate pos;
 
-  Ptr<SatConstantPositionMobilityModel> utMob = CreateObject<SatConstantPositionMobilityModel> ();
-  Ptr<SatConstantPositionMobilityModel> geoMob = CreateObject<SatConstantPositionMobilityModel> ();
-  utMob->SetGeoPosition (GeoCoordinate (0.00, 0.00, 0.00));
-  geoMob->SetGeoPosition (m_geoPos);
-  Ptr<SatMobilityObserver> utObserver = CreateObject<SatMobilityObserver> (utMob, geoMob);
+  if (m_utObserver == NULL)
+    {
+      m_utMobility = CreateObject<SatConstantPositionMobilityModel> ();
+      m_geoMobility = CreateObject<SatConstantPositionMobilityModel> ();
+      m_utMobility->SetGeoPosition (GeoCoordinate (0.00, 0.00, 0.00));
+      m_geoMobility->SetGeoPosition (m_geoPos);
+      m_utObserver = CreateObject<SatMobilityObserver> (m_utMobility, m_geoMobility);
+    }
 
   double elevation (std::numeric_limits<double>::max ());
 
@@ -282,10 +285,10 @@ SatSpotBeamPositionAllocator::GetNextGeoPosition () const
       bestBeamId = m_antennaGainPatterns->GetBestBeamId (pos);
 
       // Set the new position to the UT mobility
-      utMob->SetGeoPosition (pos);
+      m_utMobility->SetGeoPosition (pos);
 
       // Calculate the elevation angle
-      elevation = utObserver->GetElevationAngle ();
+      elevation = m_utObserver->GetElevationAngle ();
 
       ++tries;
     }
@@ -29,6 +29,9 @@
 
 namespace ns3 {
 
+class SatConstantPositionMobilityModel;
+class SatMobilityObserver;
+
 /**
  * \ingroup satellite
  * \brief Allocate a set of satellite positions. The allocation strategy is implemented in
@@ -245,6 +248,15 @@ private:
    * A random variable stream for altitude.
    */
   Ptr<RandomVariableStream> m_altitude;
+
+  /**
+   * Mobility models and observer used to calculate the elevation angle of
+   * the tried positions. Created once at the first position request and
+   * reused for all UTs, so that the satellite position is converted only once.
+   */
+  mutable Ptr<SatConstantPositionMobilityModel> m_utMobility;
+  mutable Ptr<SatConstantPositionMobilityModel> m_geoMobility;
+  mutable Ptr<SatMobilityObserver> m_utObserver;
 };
 
 
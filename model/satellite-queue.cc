@@ -64,7 +64,11 @@ TypeId SatQueue::GetTypeId (void)
 
 SatQueue::SatQueue ()
   : Object (),
-    m_packets (),
+    m_queueEventCallback (),
+    m_ring (),
+    m_head (0),
+    m_tail (0),
+    m_largestPackets (),
     m_maxPackets (0),
     m_flowId (0),
     m_nBytes (0),
@@ -83,7 +87,11 @@ SatQueue::SatQueue ()
 
 SatQueue::SatQueue (uint8_t flowId)
   : Object (),
-    m_packets (),
+    m_queueEventCallback (),
+    m_ring (),
+    m_head (0),
+    m_tail (0),
+    m_largestPackets (),
     m_maxPackets (0),
     m_flowId (flowId),
     m_nBytes (0),
@@ -108,6 +116,8 @@ void SatQueue::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_queueEventCallback.Nullify ();
+
   for (EventCallbackContainer_t::iterator it = m_queueEventCallbacks.begin ();
        it != m_queueEventCallbacks.end ();
        ++it)
@@ -116,6 +126,9 @@ void SatQueue::DoDispose ()
     }
 
   DequeueAll ();
+  m_ring.clear ();
+  m_largestPackets.clear ();
+
   Object::DoDispose ();
 }
 
@@ -130,7 +143,7 @@ bool
 SatQueue::IsEmpty () const
 {
   NS_LOG_FUNCTION (this);
-  return m_packets.empty ();
+  return (m_head == m_tail);
 }
 
 bool
@@ -140,7 +153,7 @@ SatQueue::Enqueue (Ptr<Packet> p)
 
   NS_LOG_INFO ("Enque " << p->GetSize () << " bytes");
 
-  if (m_packets.size () >= m_maxPackets)
+  if (m_tail - m_head >= m_maxPackets)
     {
       NS_LOG_INFO ("Queue full (at max packets) -- dropping pkt");
 
@@ -154,7 +167,7 @@ SatQueue::Enqueue (Ptr<Packet> p)
       return false;
     }
 
-  bool emptyBeforeEnque = m_packets.empty ();
+  bool emptyBeforeEnque = IsEmpty ();
 
   m_nBytes += p->GetSize ();
   ++m_nPackets;
@@ -164,9 +177,31 @@ SatQueue::Enqueue (Ptr<Packet> p)
 
   m_nEnqueBytesSinceReset += p->GetSize ();
 
-  m_packets.push_back (p);
+  if (m_tail - m_head == m_ring.size ())
+    {
+      GrowRing ();
+    }
+
+  uint32_t seqNo = m_tail++;
+
+  PacketEntry_t &entry = GetEntry (seqNo);
+  entry.m_packet = p;
+  entry.m_size = p->GetSize ();
+  entry.m_hasLargerPacket = false;
+
+  // The new packet is the next larger packet of the packets smaller than it
+  while (!m_largestPackets.empty () && GetEntry (m_largestPackets.back ()).m_size < entry.m_size)
+    {
+      PacketEntry_t &smallerEntry = GetEntry (m_largestPackets.back ());
+      smallerEntry.m_hasLargerPacket = true;
+      smallerEntry.m_largerPacket = seqNo;
+
+      m_largestPackets.pop_back ();
+    }
+
+  m_largestPackets.push_back (seqNo);
 
-  NS_LOG_INFO ("Number packets " << m_packets.size ());
+  NS_LOG_INFO ("Number packets " << m_tail - m_head);
   NS_LOG_INFO ("Number bytes " << m_nBytes);
   m_traceEnqueue (p);
 
@@ -193,8 +228,16 @@ SatQueue::Dequeue ()
       return 0;
     }
 
-  Ptr<Packet> p = m_packets.front ();
-  m_packets.pop_front ();
+  PacketEntry_t &entry = GetEntry (m_head);
+  Ptr<Packet> p = entry.m_packet;
+  entry.m_packet = NULL;
+
+  if (!m_largestPackets.empty () && m_largestPackets.front () == m_head)
+    {
+      m_largestPackets.pop_front ();
+    }
+
+  ++m_head;
 
   m_nBytes -= p->GetSize ();
   --m_nPackets;
@@ -202,7 +245,7 @@ SatQueue::Dequeue ()
   m_nDequeBytesSinceReset += p->GetSize ();
 
   NS_LOG_INFO ("Popped " << p);
-  NS_LOG_INFO ("Number packets " << m_packets.size ());
+  NS_LOG_INFO ("Number packets " << m_tail - m_head);
   NS_LOG_INFO ("Number bytes " << m_nBytes);
   m_traceDequeue (p);
 
@@ -220,9 +263,9 @@ SatQueue::Peek (void) const
       return 0;
     }
 
-  Ptr<Packet> p = m_packets.front ();
+  Ptr<Packet> p = GetEntry (m_head).m_packet;
 
-  NS_LOG_INFO ("Number packets " << m_packets.size ());
+  NS_LOG_INFO ("Number packets " << m_tail - m_head);
   NS_LOG_INFO ("Number bytes " << m_nBytes);
 
   return p;
@@ -233,7 +276,48 @@ SatQueue::PushFront (Ptr<Packet> p)
 {
   NS_LOG_FUNCTION (this << p->GetSize ());
 
-  m_packets.push_front (p);
+  if (m_tail - m_head == m_ring.size ())
+    {
+      GrowRing ();
+    }
+
+  uint32_t seqNo = --m_head;
+
+  PacketEntry_t &entry = GetEntry (seqNo);
+  entry.m_packet = p;
+  entry.m_size = p->GetSize ();
+  entry.m_hasLargerPacket = false;
+
+  // The next larger packet is the first packet larger than the new packet
+  // in the chain of larger packets starting from the old front packet
+  if (m_tail - seqNo > 1)
+    {
+      uint32_t largerSeqNo = seqNo + 1;
+
+      while (true)
+        {
+          const PacketEntry_t &candidate = GetEntry (largerSeqNo);
+
+          if (candidate.m_size > entry.m_size)
+            {
+              entry.m_hasLargerPacket = true;
+              entry.m_largerPacket = largerSeqNo;
+              break;
+            }
+
+          if (!candidate.m_hasLargerPacket)
+            {
+              break;
+            }
+
+          largerSeqNo = candidate.m_largerPacket;
+        }
+    }
+
+  if (!entry.m_hasLargerPacket)
+    {
+      m_largestPackets.push_front (seqNo);
+    }
 
   ++m_nPackets;
   m_nBytes += p->GetSize ();
@@ -267,7 +351,15 @@ void
 SatQueue::AddQueueEventCallback (SatQueue::QueueEventCallback cb)
 {
   NS_LOG_FUNCTION (this << &cb);
-  m_queueEventCallbacks.push_back (cb);
+
+  if (m_queueEventCallback.IsNull () && m_queueEventCallbacks.empty ())
+    {
+      m_queueEventCallback = cb;
+    }
+  else
+    {
+      m_queueEventCallbacks.push_back (cb);
+    }
 }
 
 void
@@ -275,6 +367,11 @@ SatQueue::SendEvent (SatQueue::QueueEvent_t event)
 {
   NS_LOG_FUNCTION (this);
 
+  if (!m_queueEventCallback.IsNull ())
+    {
+      m_queueEventCallback (event, m_flowId);
+    }
+
   for (EventCallbackContainer_t::const_iterator it = m_queueEventCallbacks.begin ();
        it != m_queueEventCallbacks.end ();
        ++it)
@@ -386,21 +483,53 @@ SatQueue::GetNumSmallerPackets (uint32_t maxPacketSizeBytes) const
 {
   NS_LOG_FUNCTION (this << maxPacketSizeBytes);
 
-  uint32_t packets (0);
-  for (PacketContainer_t::const_iterator it = m_packets.begin ();
-       it != m_packets.end ();
-       ++it)
+  if (IsEmpty ())
+    {
+      return 0;
+    }
+
+  // Only the packets larger than all the packets before them may end the
+  // run of small packets, so only the chain of larger packets is followed
+  uint32_t seqNo = m_head;
+
+  while (true)
     {
-      if ((*it)->GetSize () <= maxPacketSizeBytes)
+      const PacketEntry_t &entry = GetEntry (seqNo);
+
+      if (entry.m_size > maxPacketSizeBytes)
         {
-          ++packets;
+          return seqNo - m_head;
         }
-      else
+
+      if (!entry.m_hasLargerPacket)
         {
-          break;
+          return m_tail - m_head;
         }
+
+      seqNo = entry.m_largerPacket;
+    }
+}
+
+void
+SatQueue::GrowRing ()
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t size = INITIAL_RING_SIZE;
+
+  if (!m_ring.empty ())
+    {
+      size = 2 * m_ring.size ();
+    }
+
+  std::vector<PacketEntry_t> ring (size);
+
+  for (uint32_t seqNo = m_head; seqNo != m_tail; ++seqNo)
+    {
+      ring[seqNo & (size - 1)] = GetEntry (seqNo);
     }
-  return packets;
+
+  m_ring.swap (ring);
 }
 
 } // namespace ns3
@@ -22,7 +22,8 @@
 #ifndef SATELLITE_QUEUE_H_
 #define SATELLITE_QUEUE_H_
 
-#include <queue>
+#include <vector>
+#include <deque>
 #include "ns3/nstime.h"
 #include "ns3/packet.h"
 #include "ns3/object.h"
@@ -40,6 +41,12 @@ namespace ns3 {
  * SatQueue is capable of collecting statistics from the incoming and outgoing
  * bits and packets.
  *
+ * The packets are stored in a ring buffer indexed by sequence numbers, which
+ * grows to double size when it is full. Each stored packet knows the next
+ * packet in the queue larger than itself, so that the number of packets at the
+ * front of the queue not larger than a threshold is found by following the
+ * chain of larger packets from the front instead of going through the queue.
+ *
 */
 
 class SatQueue : public Object
@@ -215,7 +222,7 @@ public:
   /**
    * \brief Method checks how many packets are smaller or equal in size than the
    * maximum packets size threshold specified as an argument. Note, that each
-   * queue is gone through from the front up until there is first packet larger
+   * queue is counted from the front up until there is first packet larger
    * than threshold.
    * \param maxPacketSizeBytes Maximum packet size threshold in Bytes
    * \return Number of packets
@@ -230,12 +237,53 @@ protected:
   void Drop (Ptr<Packet> packet);
 
 private:
+  /**
+   * \brief Entry of the packet ring buffer
+   */
+  typedef struct
+  {
+    Ptr<Packet> m_packet;
+    uint32_t m_size;
+    bool m_hasLargerPacket;
+    uint32_t m_largerPacket;
+  } PacketEntry_t;
+
+  /**
+   * \brief Initial size of the packet ring buffer, shall be a power of two
+   */
+  static const uint32_t INITIAL_RING_SIZE = 16;
+
   /**
    * \brief Send queue event to all registered callbacks
    * \param event Queue event
    */
   void SendEvent (SatQueue::QueueEvent_t event);
 
+  /**
+   * \brief Get the ring buffer entry of a packet
+   * \param seqNo Sequence number of the packet
+   * \return Ring buffer entry
+   */
+  inline PacketEntry_t & GetEntry (uint32_t seqNo)
+  {
+    return m_ring[seqNo & (m_ring.size () - 1)];
+  }
+
+  /**
+   * \brief Get the ring buffer entry of a packet
+   * \param seqNo Sequence number of the packet
+   * \return Ring buffer entry
+   */
+  inline const PacketEntry_t & GetEntry (uint32_t seqNo) const
+  {
+    return m_ring[seqNo & (m_ring.size () - 1)];
+  }
+
+  /**
+   * \brief Grow the ring buffer to double size and relocate the stored packets.
+   */
+  void GrowRing ();
+
   /**
    * \brief Reset the short term statistics. Short term reflects here e.g. to
    * superframe duration.
@@ -243,17 +291,37 @@ private:
   void ResetShortTermStatistics ();
 
   typedef std::vector<QueueEventCallback> EventCallbackContainer_t;
-  typedef std::deque<Ptr<Packet> > PacketContainer_t;
 
   /**
-   * Container of callbacks for queue related events
+   * The first callback for queue related events, called directly
+   */
+  QueueEventCallback m_queueEventCallback;
+
+  /**
+   * Container of the further callbacks for queue related events
    */
   EventCallbackContainer_t m_queueEventCallbacks;
 
   /**
-   * Packet container
+   * Packet ring buffer, its size is a power of two
+   */
+  std::vector<PacketEntry_t> m_ring;
+
+  /**
+   * Sequence number of the packet at the front of the queue
+   */
+  uint32_t m_head;
+
+  /**
+   * Sequence number following the packet at the back of the queue
+   */
+  uint32_t m_tail;
+
+  /**
+   * Sequence numbers of the packets without a larger packet behind them in
+   * the queue. The packets are in queue order and their sizes do not increase.
    */
-  PacketContainer_t m_packets;
+  std::deque<uint32_t> m_largestPackets;
 
   /**
    * Maximum allowed packets within the packet container
@@ -39,13 +39,10 @@ SatRandomAccessAllocationChannel::SatRandomAccessAllocationChannel ()
     m_crdsaMaxRandomizationValue (),
     m_crdsaNumOfInstances (),
     m_crdsaMinIdleBlocks (),
-    m_crdsaIdleBlocksLeft (0),
     m_crdsaBackoffTimeInMilliSeconds (),
     m_crdsaBackoffProbability (),
     m_crdsaMaxUniquePayloadPerBlock (),
-    m_crdsaMaxConsecutiveBlocksAccessed (),
-    m_crdsaNumOfConsecutiveBlocksUsed (0),
-    m_crdsaBackoffReleaseTime (0)
+    m_crdsaMaxConsecutiveBlocksAccessed ()
 {
   NS_LOG_FUNCTION (this);
 }
@@ -31,8 +31,10 @@ namespace ns3 {
  * \ingroup satellite
  *
  * \brief Class for random access allocation channel configuration.
- * This class holds the allocation channel specific variables and
- * the configuration parameters used by the random access module
+ * This class holds the allocation channel specific configuration parameters
+ * used by the random access module. The configuration may be shared by the
+ * random access modules of several UTs, so the state of an UT is kept in the
+ * random access module (see SatRandomAccess).
  */
 class SatRandomAccessAllocationChannel : public Object
 {
@@ -71,24 +73,6 @@ public:
     m_crdsaBackoffTimeInMilliSeconds = crdsaBackoffTimeInMilliSeconds;
   }
 
-  /**
-   * \brief Function for getting the CRDSA backoff release time
-   * \return CRDSA backoff release time
-   */
-  Time GetCrdsaBackoffReleaseTime ()
-  {
-    return m_crdsaBackoffReleaseTime;
-  }
-
-  /**
-   * \brief Function for setting the CRDSA backoff release time
-   * \param crdsaBackoffReleaseTime CRDSA  backoff time
-   */
-  void SetCrdsaBackoffReleaseTime (Time crdsaBackoffReleaseTime)
-  {
-    m_crdsaBackoffReleaseTime = crdsaBackoffReleaseTime;
-  }
-
   /**
    * \brief Function for getting the CRDSA backoff probability
    * \return CRDSA backoff probability
@@ -179,24 +163,6 @@ public:
     m_crdsaMinIdleBlocks = minIdleBlocks;
   }
 
-  /**
-   * \brief Function for getting the CRDSA number of idle blocks left
-   * \return CRDSA number of idle blocks left
-   */
-  uint32_t GetCrdsaIdleBlocksLeft ()
-  {
-    return m_crdsaIdleBlocksLeft;
-  }
-
-  /**
-   * \brief Function for setting the CRDSA number of idle blocks left
-   * \param idleBlocksLeft CRDSA number of idle blocks left
-   */
-  void SetCrdsaIdleBlocksLeft (uint32_t idleBlocksLeft)
-  {
-    m_crdsaIdleBlocksLeft = idleBlocksLeft;
-  }
-
   /**
    * \brief Function for getting the CRDSA maximum number of unique payloads per block
    * \return CRDSA maximum number of unique payloads per block
@@ -233,24 +199,6 @@ public:
     m_crdsaMaxConsecutiveBlocksAccessed = maxConsecutiveBlocksAccessed;
   }
 
-  /**
-   * \brief Function for getting the CRDSA number of consecutive blocks used
-   * \return CRDSA number of consecutive blocks used
-   */
-  uint32_t GetCrdsaNumOfConsecutiveBlocksUsed ()
-  {
-    return m_crdsaNumOfConsecutiveBlocksUsed;
-  }
-
-  /**
-   * \brief Function for setting the CRDSA number of consecutive blocks used
-   * \param numOfConsecutiveBlocksUsed CRDSA number of consecutive blocks used
-   */
-  void SetCrdsaNumOfConsecutiveBlocksUsed (uint32_t numOfConsecutiveBlocksUsed)
-  {
-    m_crdsaNumOfConsecutiveBlocksUsed = numOfConsecutiveBlocksUsed;
-  }
-
   /**
    * \brief Function for checking the CRDSA parameter sanity
    */
@@ -277,11 +225,6 @@ private:
    */
   uint32_t m_crdsaMinIdleBlocks;
 
-  /**
-   * \brief CRDSA number of idle blocks left
-   */
-  uint32_t m_crdsaIdleBlocksLeft;
-
   /**
    * \brief CRDSA backoff time
    */
@@ -301,16 +244,6 @@ private:
    * \brief CRDSA maximum number of consecutive blocks accessed
    */
   uint32_t m_crdsaMaxConsecutiveBlocksAccessed;
-
-  /**
-   * \brief CRDSA number of consecutive blocks used
-   */
-  uint32_t m_crdsaNumOfConsecutiveBlocksUsed;
-
-  /**
-   * \brief CRDSA backoff release time
-   */
-  Time m_crdsaBackoffReleaseTime;
 };
 
 } // namespace ns3
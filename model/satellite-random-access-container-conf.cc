@@ -90,6 +90,22 @@ SatRandomAccessConf::SatRandomAccessConf (Ptr<SatLowerLayerServiceConf> llsConf,
     }
 }
 
+SatRandomAccessConf::SatRandomAccessConf (const SatRandomAccessConf &conf)
+  : Object (conf),
+    m_slottedAlohaControlRandomizationIntervalInMilliSeconds (conf.m_slottedAlohaControlRandomizationIntervalInMilliSeconds),
+    m_allocationChannelCount (conf.m_allocationChannelCount),
+    m_crdsaSignalingOverheadInBytes (conf.m_crdsaSignalingOverheadInBytes),
+    m_slottedAlohaSignalingOverheadInBytes (conf.m_slottedAlohaSignalingOverheadInBytes)
+{
+  NS_LOG_FUNCTION (this);
+
+  for (std::map<uint32_t,Ptr<SatRandomAccessAllocationChannel> >::const_iterator it = conf.m_allocationChannelConf.begin ();
+       it != conf.m_allocationChannelConf.end (); ++it)
+    {
+      m_allocationChannelConf.insert (std::make_pair (it->first, CopyObject<SatRandomAccessAllocationChannel> (it->second)));
+    }
+}
+
 SatRandomAccessConf::~SatRandomAccessConf ()
 {
   NS_LOG_FUNCTION (this);
@@ -52,6 +52,13 @@ public:
    */
   SatRandomAccessConf (Ptr<SatLowerLayerServiceConf> llsConf, Ptr<SatSuperframeSeq> m_superframeSeq);
 
+  /**
+   * \brief Copy constructor. The allocation channel configurations are copied,
+   * so that the copy can be modified without affecting the original.
+   * \param conf Configuration to copy
+   */
+  SatRandomAccessConf (const SatRandomAccessConf &conf);
+
   /**
    * \brief Destructor
    */
@@ -38,6 +38,8 @@ SatRandomAccess::SatRandomAccess ()
   : m_uniformRandomVariable (),
     m_randomAccessModel (SatEnums::RA_MODEL_OFF),
     m_randomAccessConf (),
+    m_isConfOwned (false),
+    m_crdsaStates (),
     m_numOfAllocationChannels (),
 
     /// CRDSA variables
@@ -52,6 +54,8 @@ SatRandomAccess::SatRandomAccess (Ptr<SatRandomAccessConf> randomAccessConf, Sat
   : m_uniformRandomVariable (),
     m_randomAccessModel (randomAccessModel),
     m_randomAccessConf (randomAccessConf),
+    m_isConfOwned (false),
+    m_crdsaStates (),
     m_numOfAllocationChannels (randomAccessConf->GetNumOfAllocationChannels ()),
 
     /// CRDSA variables
@@ -66,6 +70,13 @@ SatRandomAccess::SatRandomAccess (Ptr<SatRandomAccessConf> randomAccessConf, Sat
       NS_FATAL_ERROR ("SatRandomAccess::SatRandomAccess - Configuration object is NULL");
     }
 
+  CrdsaState_t state;
+  state.m_backoffReleaseTime = Seconds (0);
+  state.m_idleBlocksLeft = 0;
+  state.m_numOfConsecutiveBlocksUsed = 0;
+
+  m_crdsaStates.assign (m_numOfAllocationChannels, state);
+
   SetRandomAccessModel (randomAccessModel);
 }
 
@@ -88,6 +99,7 @@ SatRandomAccess::~SatRandomAccess ()
 
   m_crdsaAllocationChannels.clear ();
   m_slottedAlohaAllocationChannels.clear ();
+  m_crdsaStates.clear ();
 }
 
 void
@@ -110,12 +122,51 @@ SatRandomAccess::DoDispose ()
 
   m_crdsaAllocationChannels.clear ();
   m_slottedAlohaAllocationChannels.clear ();
+  m_crdsaStates.clear ();
 }
 
 ///---------------------------------------
 /// General random access related methods
 ///---------------------------------------
 
+SatRandomAccess::CrdsaState_t &
+SatRandomAccess::GetCrdsaState (uint32_t allocationChannel)
+{
+  if (allocationChannel >= m_crdsaStates.size ())
+    {
+      NS_FATAL_ERROR ("SatRandomAccess::GetCrdsaState - Invalid allocation channel");
+    }
+
+  return m_crdsaStates[allocationChannel];
+}
+
+const SatRandomAccess::CrdsaState_t &
+SatRandomAccess::GetCrdsaState (uint32_t allocationChannel) const
+{
+  if (allocationChannel >= m_crdsaStates.size ())
+    {
+      NS_FATAL_ERROR ("SatRandomAccess::GetCrdsaState - Invalid allocation channel");
+    }
+
+  return m_crdsaStates[allocationChannel];
+}
+
+Ptr<SatRandomAccessConf>
+SatRandomAccess::GetModifiableConf ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_isConfOwned)
+    {
+      NS_LOG_INFO ("SatRandomAccess::GetModifiableConf - Copying the shared configuration");
+
+      m_randomAccessConf = CopyObject<SatRandomAccessConf> (m_randomAccessConf);
+      m_isConfOwned = true;
+    }
+
+  return m_randomAccessConf;
+}
+
 void
 SatRandomAccess::SetRandomAccessModel (SatEnums::RandomAccessModel_t randomAccessModel)
 {
@@ -359,7 +410,7 @@ SatRandomAccess::PrintVariables ()
   for (uint32_t index = 0; index < m_numOfAllocationChannels; index++)
     {
       NS_LOG_INFO ("ALLOCATION CHANNEL: " << index);
-      NS_LOG_INFO ("Backoff release at: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaBackoffReleaseTime ().GetSeconds () << " seconds");
+      NS_LOG_INFO ("Backoff release at: " << GetCrdsaState (index).m_backoffReleaseTime.GetSeconds () << " seconds");
       NS_LOG_INFO ("Backoff time: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaBackoffTimeInMilliSeconds () << " milliseconds");
       NS_LOG_INFO ("Backoff probability: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaBackoffProbability () * 100 << " %");
       NS_LOG_INFO ("Slot randomization: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaNumOfInstances () * m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMaxUniquePayloadPerBlock () <<
@@ -367,8 +418,8 @@ SatRandomAccess::PrintVariables ()
                    " to " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMaxRandomizationValue ());
       NS_LOG_INFO ("Number of unique payloads per block: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMaxUniquePayloadPerBlock ());
       NS_LOG_INFO ("Number of instances: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaNumOfInstances ());
-      NS_LOG_INFO ("Number of consecutive blocks accessed: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaNumOfConsecutiveBlocksUsed () << "/" << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMaxConsecutiveBlocksAccessed ());
-      NS_LOG_INFO ("Number of idle blocks left: " << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaIdleBlocksLeft () << "/" << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMinIdleBlocks ());
+      NS_LOG_INFO ("Number of consecutive blocks accessed: " << GetCrdsaState (index).m_numOfConsecutiveBlocksUsed << "/" << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMaxConsecutiveBlocksAccessed ());
+      NS_LOG_INFO ("Number of idle blocks left: " << GetCrdsaState (index).m_idleBlocksLeft << "/" << m_randomAccessConf->GetAllocationChannelConfiguration (index)->GetCrdsaMinIdleBlocks ());
     }
 }
 
@@ -389,9 +440,9 @@ SatRandomAccess::SetSlottedAlohaControlRandomizationIntervalInMilliSeconds (uint
 
   if (m_randomAccessModel == SatEnums::RA_MODEL_SLOTTED_ALOHA || m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
     {
-      m_randomAccessConf->SetSlottedAlohaControlRandomizationIntervalInMilliSeconds (controlRandomizationIntervalInMilliSeconds);
+      GetModifiableConf ()->SetSlottedAlohaControlRandomizationIntervalInMilliSeconds (controlRandomizationIntervalInMilliSeconds);
 
-      m_randomAccessConf->DoSlottedAlohaVariableSanityCheck ();
+      GetModifiableConf ()->DoSlottedAlohaVariableSanityCheck ();
     }
   else
     {
@@ -460,9 +511,9 @@ SatRandomAccess::SetCrdsaBackoffTimeInMilliSeconds (uint32_t allocationChannel,
 
   if (m_randomAccessModel == SatEnums::RA_MODEL_CRDSA || m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
     {
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaBackoffTimeInMilliSeconds (backoffTimeInMilliSeconds);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaBackoffTimeInMilliSeconds (backoffTimeInMilliSeconds);
 
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
     }
   else
     {
@@ -478,9 +529,9 @@ SatRandomAccess::SetCrdsaBackoffProbability (uint32_t allocationChannel,
 
   if (m_randomAccessModel == SatEnums::RA_MODEL_CRDSA || m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
     {
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaBackoffProbability (backoffProbability);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaBackoffProbability (backoffProbability);
 
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
     }
   else
     {
@@ -498,11 +549,11 @@ SatRandomAccess::SetCrdsaRandomizationParameters (uint32_t allocationChannel,
 
   if (m_randomAccessModel == SatEnums::RA_MODEL_CRDSA || m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
     {
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMinRandomizationValue (minRandomizationValue);
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxRandomizationValue (maxRandomizationValue);
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaNumOfInstances (numOfInstances);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMinRandomizationValue (minRandomizationValue);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxRandomizationValue (maxRandomizationValue);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaNumOfInstances (numOfInstances);
 
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
     }
   else
     {
@@ -520,11 +571,11 @@ SatRandomAccess::SetCrdsaMaximumDataRateLimitationParameters (uint32_t allocatio
 
   if (m_randomAccessModel == SatEnums::RA_MODEL_CRDSA || m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
     {
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxUniquePayloadPerBlock (maxUniquePayloadPerBlock);
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxConsecutiveBlocksAccessed (maxConsecutiveBlocksAccessed);
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMinIdleBlocks (minIdleBlocks);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxUniquePayloadPerBlock (maxUniquePayloadPerBlock);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMaxConsecutiveBlocksAccessed (maxConsecutiveBlocksAccessed);
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaMinIdleBlocks (minIdleBlocks);
 
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
+      GetModifiableConf ()->GetAllocationChannelConfiguration (allocationChannel)->DoCrdsaVariableSanityCheck ();
     }
   else
     {
@@ -547,7 +598,7 @@ SatRandomAccess::CrdsaHasBackoffTimePassed (uint32_t allocationChannel) const
 
   bool hasCrdsaBackoffTimePassed = false;
 
-  if ((Now () >= m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaBackoffReleaseTime ()))
+  if ((Now () >= GetCrdsaState (allocationChannel).m_backoffReleaseTime))
     {
       hasCrdsaBackoffTimePassed = true;
     }
@@ -557,17 +608,68 @@ SatRandomAccess::CrdsaHasBackoffTimePassed (uint32_t allocationChannel) const
   return hasCrdsaBackoffTimePassed;
 }
 
+bool
+SatRandomAccess::IsCrdsaInUse (uint32_t allocationChannel) const
+{
+  NS_LOG_FUNCTION (this << allocationChannel);
+
+  bool isCrdsaInUse = false;
+
+  if (m_randomAccessModel == SatEnums::RA_MODEL_CRDSA)
+    {
+      isCrdsaInUse = true;
+    }
+  else if (m_randomAccessModel == SatEnums::RA_MODEL_RCS2_SPECIFICATION)
+    {
+      isCrdsaInUse = (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaNumOfInstances () >= 2);
+    }
+
+  return isCrdsaInUse;
+}
+
+void
+SatRandomAccess::CrdsaSkipIdleFrames (uint32_t frameCount)
+{
+  NS_LOG_FUNCTION (this << frameCount);
+
+  if (frameCount == 0)
+    {
+      return;
+    }
+
+  NS_LOG_INFO ("SatRandomAccess::CrdsaSkipIdleFrames - Reducing idle blocks by " << frameCount << " & resetting consecutive blocks");
+
+  /// each of the frames reduces the idle blocks by one and resets the consecutive blocks
+  for (uint32_t i = 0; i < m_numOfAllocationChannels; i++)
+    {
+      CrdsaState_t &state = GetCrdsaState (i);
+
+      state.m_idleBlocksLeft = (state.m_idleBlocksLeft > frameCount) ? (state.m_idleBlocksLeft - frameCount) : 0;
+    }
+
+  CrdsaResetConsecutiveBlocksUsedForAllAllocationChannels ();
+}
+
+int64_t
+SatRandomAccess::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_uniformRandomVariable->SetStream (stream);
+  return 1;
+}
+
 void
 SatRandomAccess::CrdsaReduceIdleBlocks (uint32_t allocationChannel)
 {
   NS_LOG_FUNCTION (this);
 
-  uint32_t idleBlocksLeft = m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaIdleBlocksLeft ();
+  CrdsaState_t &state = GetCrdsaState (allocationChannel);
 
-  if (idleBlocksLeft > 0)
+  if (state.m_idleBlocksLeft > 0)
     {
       NS_LOG_INFO ("SatRandomAccess::CrdsaReduceIdleBlocks - Reducing allocation channel: " << allocationChannel << " idle blocks by one");
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaIdleBlocksLeft (idleBlocksLeft - 1);
+      --state.m_idleBlocksLeft;
     }
 }
 
@@ -591,7 +693,7 @@ SatRandomAccess::CrdsaResetConsecutiveBlocksUsed (uint32_t allocationChannel)
 
   NS_LOG_INFO ("SatRandomAccess::CrdsaResetConsecutiveBlocksUsed for AC: " << allocationChannel);
 
-  m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaNumOfConsecutiveBlocksUsed (0);
+  GetCrdsaState (allocationChannel).m_numOfConsecutiveBlocksUsed = 0;
 }
 
 void
@@ -612,7 +714,7 @@ SatRandomAccess::CrdsaIsAllocationChannelFree (uint32_t allocationChannel)
 {
   NS_LOG_FUNCTION (this);
 
-  if (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaIdleBlocksLeft () > 0)
+  if (GetCrdsaState (allocationChannel).m_idleBlocksLeft > 0)
     {
       NS_LOG_INFO ("SatRandomAccess::CrdsaIsAllocationChannelFree - Allocation channel: " << allocationChannel << " idle in effect");
       return false;
@@ -643,8 +745,8 @@ SatRandomAccess::CrdsaSetBackoffTimer (uint32_t allocationChannel)
 {
   NS_LOG_FUNCTION (this);
 
-  m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaBackoffReleaseTime (Now ()
-                                                                                                         + MilliSeconds (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaBackoffTimeInMilliSeconds ()));
+  GetCrdsaState (allocationChannel).m_backoffReleaseTime = Now ()
+    + MilliSeconds (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaBackoffTimeInMilliSeconds ());
 
   NS_LOG_INFO ("SatRandomAccess::CrdsaSetBackoffTimer - Setting backoff timer for allocation channel: " << allocationChannel);
 }
@@ -708,15 +810,17 @@ SatRandomAccess::CrdsaIncreaseConsecutiveBlocksUsed (uint32_t allocationChannel)
 {
   NS_LOG_FUNCTION (this);
 
-  m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaNumOfConsecutiveBlocksUsed (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaNumOfConsecutiveBlocksUsed () + 1);
+  CrdsaState_t &state = GetCrdsaState (allocationChannel);
+
+  ++state.m_numOfConsecutiveBlocksUsed;
 
   NS_LOG_INFO ("SatRandomAccess::CrdsaIncreaseConsecutiveBlocksUsed - Increasing the number of used consecutive blocks for allocation channel: " << allocationChannel);
 
-  if (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaNumOfConsecutiveBlocksUsed () >= m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaMaxConsecutiveBlocksAccessed ())
+  if (state.m_numOfConsecutiveBlocksUsed >= m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaMaxConsecutiveBlocksAccessed ())
     {
       NS_LOG_INFO ("SatRandomAccess::CrdsaIncreaseConsecutiveBlocksUsed - Maximum number of consecutive blocks reached, forcing idle blocks for allocation channel: " << allocationChannel);
 
-      m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->SetCrdsaIdleBlocksLeft (m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaMinIdleBlocks ());
+      state.m_idleBlocksLeft = m_randomAccessConf->GetAllocationChannelConfiguration (allocationChannel)->GetCrdsaMinIdleBlocks ();
 
       CrdsaResetConsecutiveBlocksUsedForAllAllocationChannels ();
     }
@@ -27,6 +27,7 @@
 #include "satellite-random-access-container-conf.h"
 #include "ns3/random-variable-stream.h"
 #include <set>
+#include <vector>
 #include "satellite-enums.h"
 
 namespace ns3 {
@@ -192,6 +193,30 @@ public:
    */
   bool CrdsaHasBackoffTimePassed (uint32_t allocationChannel) const;
 
+  /**
+   * \brief Function for checking whether the CRDSA trigger evaluates CRDSA
+   * for this allocation channel, i.e. whether the frame starts have any effect
+   * \param allocationChannel allocation channel
+   * \return Is CRDSA in use
+   */
+  bool IsCrdsaInUse (uint32_t allocationChannel) const;
+
+  /**
+   * \brief Function for updating the CRDSA state with frames, which were not
+   * evaluated since there was no data to send. The update is the same as
+   * evaluating the CRDSA trigger in each of the frames with empty buffers.
+   * \param frameCount number of the frames
+   */
+  void CrdsaSkipIdleFrames (uint32_t frameCount);
+
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by the random access algorithms.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  int64_t AssignStreams (int64_t stream);
+
 protected:
   /**
    * \brief Function for disposing the module and its variables
@@ -199,11 +224,42 @@ protected:
   void DoDispose ();
 
 private:
+  /**
+   * \brief CRDSA state of the UT for an allocation channel
+   */
+  typedef struct
+  {
+    Time m_backoffReleaseTime;
+    uint32_t m_idleBlocksLeft;
+    uint32_t m_numOfConsecutiveBlocksUsed;
+  } CrdsaState_t;
+
   /**
    * \brief Function for printing out various module variables to console
    */
   void PrintVariables ();
 
+  /**
+   * \brief Function for getting the CRDSA state of an allocation channel
+   * \param allocationChannel allocation channel
+   * \return CRDSA state
+   */
+  CrdsaState_t & GetCrdsaState (uint32_t allocationChannel);
+
+  /**
+   * \brief Function for getting the CRDSA state of an allocation channel
+   * \param allocationChannel allocation channel
+   * \return CRDSA state
+   */
+  const CrdsaState_t & GetCrdsaState (uint32_t allocationChannel) const;
+
+  /**
+   * \brief Function for getting the configuration for modification. The
+   * configuration shared with the other UTs is copied at the first modification.
+   * \return configuration owned by this module
+   */
+  Ptr<SatRandomAccessConf> GetModifiableConf ();
+
   /**
    * \brief Main function for Slotted ALOHA
    * \return Slotted ALOHA algorithm results (Tx opportunity)
@@ -326,10 +382,21 @@ private:
   SatEnums::RandomAccessModel_t m_randomAccessModel;
 
   /**
-   * \brief A pointer to random access configuration
+   * \brief A pointer to random access configuration, which may be shared
+   * with the random access modules of other UTs
    */
   Ptr<SatRandomAccessConf> m_randomAccessConf;
 
+  /**
+   * \brief A flag defining whether the configuration is owned by this module
+   */
+  bool m_isConfOwned;
+
+  /**
+   * \brief CRDSA states by allocation channel
+   */
+  std::vector<CrdsaState_t> m_crdsaStates;
+
   /**
    * \brief Number of allocation channels available
    */
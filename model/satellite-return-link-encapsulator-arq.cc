@@ -599,6 +599,14 @@ SatReturnLinkEncapsulatorArq::GetTxBufferSizeInBytes () const
   return m_txQueue->GetNBytes () + m_retxBufferSize;
 }
 
+bool
+SatReturnLinkEncapsulatorArq::HasUnacknowledgedData () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return !m_txedBuffer.empty ();
+}
+
 void
 SatReturnLinkEncapsulatorArq::SendAck (uint8_t seqNo) const
 {
@@ -110,6 +110,12 @@ public:
    */
   virtual uint32_t GetTxBufferSizeInBytes () const;
 
+  /**
+   * \brief Check whether there are transmitted packets waiting for an ACK
+   * \return bool true if there is unacknowledged data
+   */
+  virtual bool HasUnacknowledgedData () const;
+
 private:
   /**
    * \brief ARQ Tx timer has expired. The PDU will be flushed, if the maximum
@@ -34,7 +34,7 @@ TypeId
 SatRxPowerOutputTraceContainer::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::SatRxPowerOutputTraceContainer")
-    .SetParent<SatBaseTraceContainer> ()
+    .SetParent<SatBaseOutputTraceContainer> ()
     .AddConstructor<SatRxPowerOutputTraceContainer> ();
   return tid;
 }
@@ -48,7 +48,7 @@ SatRxPowerOutputTraceContainer::GetInstanceTypeId (void) const
 }
 
 SatRxPowerOutputTraceContainer::SatRxPowerOutputTraceContainer ()
-  : m_enableFigureOutput (true)
+  : SatBaseOutputTraceContainer (SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -67,21 +67,7 @@ SatRxPowerOutputTraceContainer::DoDispose ()
 
   Reset ();
 
-  SatBaseTraceContainer::DoDispose ();
-}
-
-void
-SatRxPowerOutputTraceContainer::Reset ()
-{
-  NS_LOG_FUNCTION (this);
-
-  if (!m_container.empty ())
-    {
-      WriteToFile ();
-
-      m_container.clear ();
-    }
-  m_enableFigureOutput = true;
+  SatBaseOutputTraceContainer::DoDispose ();
 }
 
 Ptr<SatOutputFileStreamDoubleContainer>
@@ -125,21 +111,6 @@ SatRxPowerOutputTraceContainer::AddNode (key_t key)
     }
 }
 
-Ptr<SatOutputFileStreamDoubleContainer>
-SatRxPowerOutputTraceContainer::FindNode (key_t key)
-{
-  NS_LOG_FUNCTION (this);
-
-  container_t::iterator iter = m_container.find (key);
-
-  if (iter == m_container.end ())
-    {
-      return AddNode (key);
-    }
-
-  return iter->second;
-}
-
 void
 SatRxPowerOutputTraceContainer::WriteToFile ()
 {
@@ -162,22 +133,4 @@ SatRxPowerOutputTraceContainer::WriteToFile ()
     }
 }
 
-void
-SatRxPowerOutputTraceContainer::AddToContainer (key_t key, std::vector<double> newItem)
-{
-  NS_LOG_FUNCTION (this);
-
-  if (newItem.size () != SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_NUMBER_OF_COLUMNS)
-    {
-      NS_FATAL_ERROR ("SatRxPowerOutputTraceContainer::AddToContainer - Incorrect vector size");
-    }
-
-  Ptr<SatOutputFileStreamDoubleContainer> node = FindNode (key);
-
-  if (node != NULL)
-    {
-      node->AddToContainer (newItem);
-    }
-}
-
 } // namespace ns3
@@ -22,6 +22,7 @@
 #include "ns3/ptr.h"
 
 #include "satellite-signal-parameters.h"
+#include "satellite-mac-tag.h"
 #include "satellite-phy-tx.h"
 
 NS_LOG_COMPONENT_DEFINE ("SatSignalParameters");
@@ -44,7 +45,9 @@ SatSignalParameters::SatSignalParameters ()
     m_rxNoisePowerInSatellite_W (),
     m_rxAciIfPowerInSatellite_W (),
     m_rxExtNoisePowerInSatellite_W (),
-    m_sinrCalculate ()
+    m_sinrCalculate (),
+    m_bentPipe (false),
+    m_rxDecision ()
 {
   NS_LOG_FUNCTION (this);
 }
@@ -56,6 +59,7 @@ SatSignalParameters::SatSignalParameters ( const SatSignalParameters& p )
       m_packetsInBurst.push_back ((*i)->Copy ());
     }
 
+  m_addressSummary = p.m_addressSummary;
   m_beamId = p.m_beamId;
   m_carrierId = p.m_carrierId;
   m_duration = p.m_duration;
@@ -78,6 +82,9 @@ SatSignalParameters::SatSignalParameters ( const SatSignalParameters& p )
   m_rxAciIfPowerInSatellite_W = p.m_rxAciIfPowerInSatellite_W;
   m_rxExtNoisePowerInSatellite_W = p.m_rxExtNoisePowerInSatellite_W;
   m_sinrCalculate = p.m_sinrCalculate;
+  m_bentPipe = p.m_bentPipe;
+  m_rxDecision.resolved = false;
+  m_rxDecision.receive = false;
 }
 
 Ptr<SatSignalParameters>
@@ -98,5 +105,86 @@ SatSignalParameters::GetTypeId (void)
   return tid;
 }
 
+SatSignalParameters::AddressSummary::AddressSummary (const PacketsInBurst_t &packets)
+  : m_hasBroadcastDest (false),
+    m_hasGroupDest (false),
+    m_hasUntaggedPacket (false)
+{
+  NS_LOG_FUNCTION (this);
+
+  for (PacketsInBurst_t::const_iterator it = packets.begin (); it != packets.end (); ++it)
+    {
+      SatMacTag tag;
+
+      if (!(*it)->PeekPacketTag (tag))
+        {
+          m_hasUntaggedPacket = true;
+        }
+
+      Mac48Address dest = tag.GetDestAddress ();
+      Mac48Address source = tag.GetSourceAddress ();
+
+      if (it == packets.begin ())
+        {
+          m_firstSourceAddress = source;
+        }
+
+      m_lastSourceAddress = source;
+      m_lastDestAddress = dest;
+
+      if (dest.IsBroadcast ())
+        {
+          m_hasBroadcastDest = true;
+        }
+      else if (dest.IsGroup ())
+        {
+          m_hasGroupDest = true;
+        }
+      else
+        {
+          // the source of the first packet destined to the address is kept
+          m_unicastAddresses.insert (std::make_pair (dest, source));
+        }
+    }
+}
+
+bool
+SatSignalParameters::AddressSummary::IsDestination (Mac48Address address) const
+{
+  Mac48Address sourceAddress;
+
+  return (m_hasBroadcastDest || m_hasGroupDest || FindUnicastDestination (address, sourceAddress));
+}
+
+bool
+SatSignalParameters::AddressSummary::FindUnicastDestination (Mac48Address address, Mac48Address &sourceAddress) const
+{
+  UnicastAddressMap_t::const_iterator it = m_unicastAddresses.find (address);
+
+  if (it != m_unicastAddresses.end ())
+    {
+      sourceAddress = it->second;
+      return true;
+    }
+
+  return false;
+}
+
+std::size_t
+SatSignalParameters::AddressSummary::AddressHash::operator() (const Mac48Address &address) const
+{
+  uint8_t buffer[6];
+  address.CopyTo (buffer);
+
+  uint64_t value = 0;
+
+  for (uint32_t i = 0; i < 6; i++)
+    {
+      value = (value << 8) | buffer[i];
+    }
+
+  return std::hash<uint64_t> () (value);
+}
+
 
 } // namespace ns3
@@ -21,10 +21,15 @@
 #ifndef SATELLITE_SIGNAL_PARAMETERS_H
 #define SATELLITE_SIGNAL_PARAMETERS_H
 
+#include <vector>
+#include <utility>
+#include <unordered_map>
 #include "ns3/ptr.h"
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/mac48-address.h"
 #include "satellite-enums.h"
 
 namespace ns3 {
@@ -54,12 +59,107 @@ public:
     uint32_t crdsaUniquePacketId;
   } txInfo_s;
 
+  /**
+   * \brief Struct for storing the receive decision of a receiver, i.e.
+   * whether the burst is received and the addresses it is received with
+   */
+  typedef struct
+  {
+    bool resolved;
+    bool receive;
+    Mac48Address destAddress;
+    Mac48Address sourceAddress;
+  } rxDecision_s;
+
   /**
    * Buffer for transmissions. Buffer just holds data as pointer to packets.
    * Real length of buffer is simulated by duration of the PDU transmission.
    */
   typedef std::vector< Ptr<Packet> > PacketsInBurst_t;
 
+  /**
+   * \brief Summary of the MAC addresses of the packets in a burst. The summary
+   * is extracted from the MAC tags of the packets once, when the burst is
+   * built, and it is shared by the copies of the signal parameters, so that
+   * the receivers need not to peek the MAC tags of the packets.
+   */
+  class AddressSummary : public SimpleRefCount<AddressSummary>
+  {
+  public:
+    /**
+     * \brief Hash function of the MAC addresses
+     */
+    struct AddressHash
+    {
+      std::size_t operator() (const Mac48Address &address) const;
+    };
+
+    /**
+     * Container of the unicast destination addresses, each with the source
+     * address of the first packet destined to it
+     */
+    typedef std::unordered_map<Mac48Address, Mac48Address, AddressHash> UnicastAddressMap_t;
+
+    /**
+     * \brief Constructor
+     * \param packets The packets of the burst
+     */
+    AddressSummary (const PacketsInBurst_t &packets);
+
+    /**
+     * \brief Check whether a receiver is a destination of the burst, i.e. the
+     * burst has a packet destined to the receiver or a broadcast or group
+     * packet.
+     * \param address MAC address of the receiver
+     * \return true, if the receiver is a destination of the burst
+     */
+    bool IsDestination (Mac48Address address) const;
+
+    /**
+     * \brief Find the first packet destined to an unicast address
+     * \param address Unicast destination address
+     * \param sourceAddress Source address of the found packet
+     * \return true, if a packet destined to the address was found
+     */
+    bool FindUnicastDestination (Mac48Address address, Mac48Address &sourceAddress) const;
+
+    /**
+     * Unicast destination addresses of the packets, each with the source
+     * address of the first packet destined to it
+     */
+    UnicastAddressMap_t m_unicastAddresses;
+
+    /**
+     * Source address of the first packet
+     */
+    Mac48Address m_firstSourceAddress;
+
+    /**
+     * Source address of the last packet
+     */
+    Mac48Address m_lastSourceAddress;
+
+    /**
+     * Destination address of the last packet
+     */
+    Mac48Address m_lastDestAddress;
+
+    /**
+     * Does the burst have a broadcast packet
+     */
+    bool m_hasBroadcastDest;
+
+    /**
+     * Does the burst have a group (multicast) packet
+     */
+    bool m_hasGroupDest;
+
+    /**
+     * Does the burst have a packet without MAC tag
+     */
+    bool m_hasUntaggedPacket;
+  };
+
   /**
    * default constructor
    */
@@ -85,6 +185,12 @@ public:
 
   PacketsInBurst_t m_packetsInBurst;
 
+  /**
+   * Summary of the MAC addresses of the packets, if extracted when the burst
+   * was built. The summary is shared by the copies of the parameters.
+   */
+  Ptr<const AddressSummary> m_addressSummary;
+
   /**
    * The beam for the packet transmission
    */
@@ -173,6 +279,21 @@ public:
    * Callback for SINR calculation
    */
   Callback<double, double> m_sinrCalculate;
+
+  /**
+   * True, when the burst is passed through the satellite in the bent pipe
+   * mode of the channel (see SatChannel), i.e. the satellite forwards the
+   * burst already at the start of its reception.
+   */
+  bool m_bentPipe;
+
+  /**
+   * Receive decision made by the receive filtering of the channel for the
+   * receiver of this copy of the parameters (see SatChannel). The reception
+   * uses it instead of resolving the destinations of the burst again. The
+   * decision is not copied with the parameters.
+   */
+  rxDecision_s m_rxDecision;
 };
 
 
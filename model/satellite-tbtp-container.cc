@@ -136,15 +136,14 @@ SatTbtpContainer::HasScheduledTimeSlots ()
     {
       RemovePastTbtps ();
 
-      SatTbtpMessage::DaTimeSlotInfoItem_t info;
       for (TbtpMap_t::const_reverse_iterator it = m_tbtps.rbegin ();
            it != m_tbtps.rend ();
            ++it)
         {
-          info = it->second->GetDaTimeslots (m_address);
+          const SatTbtpMessage::DaTimeSlotInfoItem_t &info = it->second->GetDaTimeslots (m_address);
 
           // This TBTP has time slots for this UT
-          if (!info.second.empty ())
+          if (info.m_slotCount > 0)
             {
               Time superframeStartTime = it->first;
 
@@ -162,21 +161,29 @@ SatTbtpContainer::HasScheduledTimeSlots ()
                 {
                   /**
                    * The time slots are not necessarily in increasing order in the TBTP.
-                   * Sort the time slots into increasing order based on time.
+                   * Find the time slot with the latest start time.
                    */
-                  std::sort (info.second.begin (), info.second.end (), SortTimeSlots ());
+                  uint32_t lastSlot = 0;
+
+                  for (uint32_t i = 1; i < info.m_slotCount; ++i)
+                    {
+                      if (it->second->GetDaTimeslot (info, i).GetStartTime () > it->second->GetDaTimeslot (info, lastSlot).GetStartTime ())
+                        {
+                          lastSlot = i;
+                        }
+                    }
 
                   // Start time offset for the last time slot for this UT
-                  Time startTimeOffsetForLastSlot = (*(info.second.rbegin ()))->GetStartTime ();
+                  Time startTimeOffsetForLastSlot = it->second->GetDaTimeslot (info, lastSlot).GetStartTime ();
 
                   /**
                    * Calculate the duration of the last slot. To be able to do that we need the
                    * superframe conf, frame conf, time slot conf and symbol rate.
                    */
                   Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
-                  uint8_t frameId = info.first;
+                  uint8_t frameId = info.m_frameId;
                   Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
-                  uint32_t wfId = (*(info.second.rbegin ()))->GetWaveFormId ();
+                  uint32_t wfId = it->second->GetDaTimeslot (info, lastSlot).GetWaveFormId ();
                   Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (wfId);
                   Time lastSlotDuration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
 
@@ -31,30 +31,6 @@
 namespace ns3 {
 
 
-/**
- * \ingroup satellite
- * This class sorts time slots within TBTP into increasing order based
- * on start time.
- */
-class SortTimeSlots
-{
-public:
-  SortTimeSlots ()
-  {
-  }
-
-  /**
-   * Operator overload for sorting function
-   * \param p1 Time slot configuration
-   * \param p2 Time slot configuration
-   * \return Start time of p1 < Start time of p2
-   */
-  bool operator() (Ptr<SatTimeSlotConf> p1, Ptr<SatTimeSlotConf> p2)
-  {
-    return p1->GetStartTime () < p2->GetStartTime ();
-  }
-};
-
 /**
  * \ingroup satellite
  * \brief A container of received TBTPs. All the received TBTPs with
@@ -49,7 +49,11 @@ SatTracedInterference::SatTracedInterference (SatEnums::ChannelType_t channeltyp
   : m_rxing (false),
     m_power (0),
     m_channelType (channeltype),
-    m_rxBandwidth_Hz (rxBandwidth)
+    m_rxBandwidth_Hz (rxBandwidth),
+    m_traceAddress (),
+    m_traceIndex (0),
+    m_traceIndexValid (false),
+    m_traceResetCount (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -63,7 +67,11 @@ SatTracedInterference::SatTracedInterference ()
   : m_rxing (false),
     m_power (),
     m_channelType (),
-    m_rxBandwidth_Hz ()
+    m_rxBandwidth_Hz (),
+    m_traceAddress (),
+    m_traceIndex (0),
+    m_traceIndexValid (false),
+    m_traceResetCount (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -93,7 +101,21 @@ SatTracedInterference::DoCalculate (Ptr<SatInterference::InterferenceChangeEvent
 {
   NS_LOG_FUNCTION (this);
 
-  m_power = m_rxBandwidth_Hz * Singleton<SatInterferenceInputTraceContainer>::Get ()->GetInterferenceDensity (std::make_pair (event->GetSatEarthStationAddress (),m_channelType));
+  SatInterferenceInputTraceContainer *traceContainer = Singleton<SatInterferenceInputTraceContainer>::Get ();
+
+  // the trace index is looked up only when the earth station changes,
+  // i.e. normally once per receiver, or when the traces have been reset
+  if (!m_traceIndexValid
+      || m_traceResetCount != traceContainer->GetResetCount ()
+      || m_traceAddress != event->GetSatEarthStationAddress ())
+    {
+      m_traceAddress = event->GetSatEarthStationAddress ();
+      m_traceIndex = traceContainer->GetTraceIndex (std::make_pair (m_traceAddress, m_channelType));
+      m_traceResetCount = traceContainer->GetResetCount ();
+      m_traceIndexValid = true;
+    }
+
+  m_power = m_rxBandwidth_Hz * traceContainer->GetInterferenceDensity (m_traceIndex);
 
   return m_power;
 }
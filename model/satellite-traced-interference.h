@@ -150,6 +150,28 @@ private:
    * \brief RX Bandwidth in Hz
    */
   double m_rxBandwidth_Hz;
+
+  /**
+   * \brief Address of the earth station whose trace index is cached
+   */
+  Address m_traceAddress;
+
+  /**
+   * \brief Cached index of the interference trace of m_traceAddress
+   * in SatInterferenceInputTraceContainer, valid if m_traceIndexValid is set
+   */
+  uint32_t m_traceIndex;
+
+  /**
+   * \brief Flag telling whether m_traceIndex is valid
+   */
+  bool m_traceIndexValid;
+
+  /**
+   * \brief Reset count of SatInterferenceInputTraceContainer when
+   * m_traceIndex was looked up
+   */
+  uint32_t m_traceResetCount;
 };
 
 } // namespace ns3
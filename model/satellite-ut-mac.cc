@@ -18,6 +18,7 @@
  * Author: Sami Rantanen <sami.rantanen@magister.fi>
  */
 
+#include <algorithm>
 #include <ns3/log.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/simulator.h>
@@ -87,8 +88,11 @@ SatUtMac::SatUtMac ()
   : SatMac (),
     m_superframeSeq (),
     m_timingAdvanceCb (0),
+    m_lastFrameStartCount (0),
+    m_frameStartScheduled (false),
     m_randomAccess (NULL),
     m_guardTime (MicroSeconds (1)),
+    m_daTxHead (0),
     m_raChannel (0),
     m_crdsaUniquePacketId (1),
     m_crdsaOnlyForControl (false)
@@ -103,7 +107,10 @@ SatUtMac::SatUtMac (Ptr<SatSuperframeSeq> seq, uint32_t beamId, bool crdsaOnlyFo
   : SatMac (beamId),
     m_superframeSeq (seq),
     m_timingAdvanceCb (0),
+    m_lastFrameStartCount (0),
+    m_frameStartScheduled (false),
     m_guardTime (MicroSeconds (1)),
+    m_daTxHead (0),
     m_raChannel (0),
     m_crdsaUniquePacketId (1),
     m_crdsaOnlyForControl (crdsaOnlyForControl)
@@ -128,6 +135,9 @@ SatUtMac::DoDispose (void)
   NS_LOG_FUNCTION (this);
 
   m_timingAdvanceCb.Nullify ();
+  m_buffersIdleCb.Nullify ();
+  Simulator::Cancel (m_daTxEvent);
+  m_daTxOpportunities.clear ();
   m_tbtpContainer->DoDispose ();
   m_utScheduler->DoDispose ();
   m_utScheduler = NULL;
@@ -170,6 +180,23 @@ SatUtMac::SetRandomAccess (Ptr<SatRandomAccess> randomAccess)
   m_randomAccess->SetIsDamaAvailableCallback (MakeCallback (&SatTbtpContainer::HasScheduledTimeSlots, m_tbtpContainer));
 }
 
+int64_t
+SatUtMac::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t currentStream = stream;
+
+  m_uniformRandomVariable->SetStream (currentStream++);
+
+  if (m_randomAccess != NULL)
+    {
+      currentStream += m_randomAccess->AssignStreams (currentStream);
+    }
+
+  return (currentStream - stream);
+}
+
 bool
 SatUtMac::ControlMsgTransmissionPossible () const
 {
@@ -187,18 +214,18 @@ SatUtMac::SetTimingAdvanceCallback (SatUtMac::TimingAdvanceCallback cb)
   NS_LOG_FUNCTION (this << &cb);
 
   m_timingAdvanceCb = cb;
+  m_lastFrameStartCount = Singleton<SatRtnLinkTime>::Get ()->GetCurrentSuperFrameCount (SatConstVariables::SUPERFRAME_SEQUENCE, m_timingAdvanceCb ());
 
   /// schedule the next frame start
-  Time nextSuperFrameTxTime = GetNextSuperFrameTxTime (SatConstVariables::SUPERFRAME_SEQUENCE);
-
-  if (Now () >= nextSuperFrameTxTime)
-    {
-      NS_FATAL_ERROR ("Scheduling next superframe start time to the past!");
-    }
+  ScheduleFrameStart ();
+}
 
-  Time schedulingDelay = nextSuperFrameTxTime - Now ();
+void
+SatUtMac::SetBuffersIdleCallback (SatUtMac::BuffersIdleCallback cb)
+{
+  NS_LOG_FUNCTION (this << &cb);
 
-  Simulator::Schedule (schedulingDelay, &SatUtMac::DoFrameStart, this);
+  m_buffersIdleCb = cb;
 }
 
 void
@@ -260,42 +287,49 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
   NS_LOG_INFO ("Time to start sending the superframe for this UT: " << txTime.GetSeconds ());
   NS_LOG_INFO ("Waiting delay before the superframe start: " << startDelay.GetSeconds ());
 
-  SatTbtpMessage::DaTimeSlotInfoItem_t info = tbtp->GetDaTimeslots (m_nodeInfo->GetMacAddress ());
+  const SatTbtpMessage::DaTimeSlotInfoItem_t &info = tbtp->GetDaTimeslots (m_nodeInfo->GetMacAddress ());
 
   // Counters for allocated TBTP resources
   uint32_t payloadSumInSuperFrame = 0;
   uint32_t payloadSumPerRcIndex [SatEnums::NUM_FIDS] = { };
 
-  if (!info.second.empty ())
+  if (info.m_slotCount > 0)
     {
-      NS_LOG_INFO ("TBTP contains " << info.second.size () << " timeslots for UT: " << m_nodeInfo->GetMacAddress ());
+      NS_LOG_INFO ("TBTP contains " << info.m_slotCount << " timeslots for UT: " << m_nodeInfo->GetMacAddress ());
+
+      uint8_t frameId = info.m_frameId;
 
-      uint8_t frameId = info.first;
+      // the configurations are common to all the time slots of the TBTP
+      Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
+      Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
+      Ptr<SatWaveformConf> waveformConf = m_superframeSeq->GetWaveformConf ();
+      double symbolRateInBauds = frameConf->GetBtuConf ()->GetSymbolRateInBauds ();
+      uint32_t firstOpportunity = m_daTxOpportunities.size ();
 
       // schedule time slots
-      for ( SatTbtpMessage::DaTimeSlotConfContainer_t::iterator it = info.second.begin (); it != info.second.end (); it++ )
+      for (uint32_t i = 0; i < info.m_slotCount; ++i)
         {
-          Ptr<SatSuperframeConf> superframeConf = m_superframeSeq->GetSuperframeConf (SatConstVariables::SUPERFRAME_SEQUENCE);
-          Ptr<SatFrameConf> frameConf = superframeConf->GetFrameConf (frameId);
-          Ptr<SatTimeSlotConf> timeSlotConf = *it;
+          const SatTimeSlotConf &timeSlotConf = tbtp->GetDaTimeslot (info, i);
 
           // Start time
-          Time slotDelay = startDelay + timeSlotConf->GetStartTime ();
+          Time slotDelay = startDelay + timeSlotConf.GetStartTime ();
           NS_LOG_INFO ("Slot start delay: " << slotDelay.GetSeconds ());
 
           // Duration
-          Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf->GetWaveFormId ());
-          Time duration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
+          Ptr<SatWaveform> wf = waveformConf->GetWaveform (timeSlotConf.GetWaveFormId ());
+          Time duration = wf->GetBurstDuration (symbolRateInBauds);
 
           // Carrier
-          uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf->GetCarrierId () );
+          uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf.GetCarrierId () );
 
           // Schedule individual time slot
           ScheduleDaTxOpportunity (slotDelay, duration, wf, timeSlotConf, carrierId);
 
           payloadSumInSuperFrame += wf->GetPayloadInBytes ();
-          payloadSumPerRcIndex [timeSlotConf->GetRcIndex ()] += wf->GetPayloadInBytes ();
+          payloadSumPerRcIndex [timeSlotConf.GetRcIndex ()] += wf->GetPayloadInBytes ();
         }
+
+      ScheduleSlotSchedule (firstOpportunity);
     }
 
   // Assigned TBTP resources
@@ -309,20 +343,110 @@ SatUtMac::ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp)
 }
 
 void
-SatUtMac::ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId)
+SatUtMac::ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, const SatTimeSlotConf &tsConf, uint32_t carrierId)
 {
-  NS_LOG_FUNCTION (this << transmitDelay.GetSeconds () << duration.GetSeconds () << wf->GetPayloadInBytes () << (uint32_t)(tsConf->GetRcIndex ()) << carrierId);
-  NS_LOG_INFO ("SatUtMac::ScheduleDaTxOpportunity - after delay: " << transmitDelay.GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", rcIndex: " << (uint32_t)(tsConf->GetRcIndex ()) << ", carrier: " << carrierId);
+  NS_LOG_FUNCTION (this << transmitDelay.GetSeconds () << duration.GetSeconds () << wf->GetPayloadInBytes () << (uint32_t)(tsConf.GetRcIndex ()) << carrierId);
+  NS_LOG_INFO ("SatUtMac::ScheduleDaTxOpportunity - after delay: " << transmitDelay.GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", rcIndex: " << (uint32_t)(tsConf.GetRcIndex ()) << ", carrier: " << carrierId);
+
+  DaTxOpportunity_t opportunity;
+  opportunity.m_txTime = Simulator::Now () + transmitDelay;
+  opportunity.m_duration = duration;
+  opportunity.m_carrierId = carrierId;
+  opportunity.m_waveform = wf;
+  opportunity.m_slotType = tsConf.GetSlotType ();
+  opportunity.m_rcIndex = tsConf.GetRcIndex ();
+
+  m_daTxOpportunities.push_back (opportunity);
+}
 
-  Simulator::Schedule (transmitDelay, &SatUtMac::DoTransmit, this, duration, carrierId, wf, tsConf, SatUtScheduler::LOOSE);
+bool
+SatUtMac::CompareDaTxOpportunities (const DaTxOpportunity_t &a, const DaTxOpportunity_t &b)
+{
+  return a.m_txTime < b.m_txTime;
+}
+
+void
+SatUtMac::ScheduleSlotSchedule (uint32_t first)
+{
+  NS_LOG_FUNCTION (this << first);
+
+  // drop the already transmitted opportunities from the front of the schedule
+  if (m_daTxHead > 0)
+    {
+      m_daTxOpportunities.erase (m_daTxOpportunities.begin (), m_daTxOpportunities.begin () + m_daTxHead);
+      first -= m_daTxHead;
+      m_daTxHead = 0;
+    }
+
+  std::vector<DaTxOpportunity_t>::iterator tbtpBegin = m_daTxOpportunities.begin () + first;
+
+  // opportunities with the same transmission time are kept in the TBTP order,
+  // and after the opportunities of the earlier TBTPs
+  std::stable_sort (tbtpBegin, m_daTxOpportunities.end (), CompareDaTxOpportunities);
+
+  if (tbtpBegin != m_daTxOpportunities.begin () && CompareDaTxOpportunities (*tbtpBegin, *(tbtpBegin - 1)))
+    {
+      std::inplace_merge (m_daTxOpportunities.begin (), tbtpBegin, m_daTxOpportunities.end (), CompareDaTxOpportunities);
+    }
+
+  if (m_daTxOpportunities.empty ())
+    {
+      return;
+    }
+
+  // Only the first opportunity of the schedule has an event, the event
+  // schedules itself again for the next one. It is moved, if the TBTP
+  // starts before the pending event.
+  Time firstTxTime = m_daTxOpportunities.front ().m_txTime;
+
+  if (m_daTxEvent.IsRunning () && Simulator::GetDelayLeft (m_daTxEvent) > firstTxTime - Simulator::Now ())
+    {
+      Simulator::Cancel (m_daTxEvent);
+    }
+
+  if (!m_daTxEvent.IsRunning ())
+    {
+      m_daTxEvent = Simulator::Schedule (firstTxTime - Simulator::Now (), &SatUtMac::DoDaTxOpportunities, this);
+    }
+}
+
+void
+SatUtMac::DoDaTxOpportunities ()
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_ASSERT (m_daTxHead < m_daTxOpportunities.size ());
+  NS_ASSERT (m_daTxOpportunities[m_daTxHead].m_txTime == Simulator::Now ());
+
+  Time txTime = m_daTxOpportunities[m_daTxHead].m_txTime;
+
+  // transmit the opportunities due at this time in the schedule order, the
+  // opportunity is removed from the schedule before the transmission
+  while (m_daTxHead < m_daTxOpportunities.size ()
+         && m_daTxOpportunities[m_daTxHead].m_txTime == txTime)
+    {
+      const DaTxOpportunity_t &opportunity = m_daTxOpportunities[m_daTxHead++];
+
+      DoTransmit (opportunity.m_duration, opportunity.m_carrierId, opportunity.m_waveform, opportunity.m_slotType, opportunity.m_rcIndex, SatUtScheduler::LOOSE);
+    }
+
+  if (m_daTxHead == m_daTxOpportunities.size ())
+    {
+      m_daTxOpportunities.clear ();
+      m_daTxHead = 0;
+    }
+  else
+    {
+      m_daTxEvent = Simulator::Schedule (m_daTxOpportunities[m_daTxHead].m_txTime - Simulator::Now (), &SatUtMac::DoDaTxOpportunities, this);
+    }
 }
 
 
 void
-SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, SatUtScheduler::SatCompliancePolicy_t policy)
+SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, SatTimeSlotConf::SatTimeSlotType_t slotType, uint8_t rcIndex, SatUtScheduler::SatCompliancePolicy_t policy)
 {
-  NS_LOG_FUNCTION (this << duration.GetSeconds () << wf->GetPayloadInBytes () << carrierId << (uint32_t)(tsConf->GetRcIndex ()));
-  NS_LOG_INFO ("DA Tx opportunity for UT: " << m_nodeInfo->GetMacAddress () << " at time: " << Simulator::Now ().GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", carrier: " << carrierId << ", RC index: " << (uint32_t)(tsConf->GetRcIndex ()));
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << wf->GetPayloadInBytes () << carrierId << (uint32_t)(rcIndex));
+  NS_LOG_INFO ("DA Tx opportunity for UT: " << m_nodeInfo->GetMacAddress () << " at time: " << Simulator::Now ().GetSeconds () << " duration: " << duration.GetSeconds () << ", payload: " << wf->GetPayloadInBytes () << ", carrier: " << carrierId << ", RC index: " << (uint32_t)(rcIndex));
 
   SatSignalParameters::txInfo_s txInfo;
   txInfo.packetType = SatEnums::PACKET_TYPE_DEDICATED_ACCESS;
@@ -331,7 +455,7 @@ SatUtMac::DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Pt
   txInfo.frameType = SatEnums::UNDEFINED_FRAME;
   txInfo.waveformId = wf->GetWaveformId ();
 
-  TransmitPackets (FetchPackets (wf->GetPayloadInBytes (), tsConf->GetSlotType (), tsConf->GetRcIndex (), policy), duration, carrierId, txInfo);
+  TransmitPackets (FetchPackets (wf->GetPayloadInBytes (), slotType, rcIndex, policy), duration, carrierId, txInfo);
 }
 
 void
@@ -455,6 +579,13 @@ SatUtMac::ReceiveQueueEvent (SatQueue::QueueEvent_t event, uint8_t rcIndex)
 
   NS_LOG_INFO ("SatUtMac::ReceiveQueueEvent - UT: " << m_nodeInfo->GetMacAddress () << " time: " << Now ().GetSeconds () << " Queue: " << (uint32_t)rcIndex);
 
+  // Resume the frame starts, if they were stopped because of idle buffers
+  if ((event == SatQueue::FIRST_BUFFERED_PKT || event == SatQueue::BUFFERED_PKT)
+      && !m_frameStartScheduled && m_randomAccess != NULL && m_randomAccess->IsCrdsaInUse (m_raChannel))
+    {
+      ResumeFrameStarts ();
+    }
+
   // Check only the queue events from the control queue
   if (rcIndex == SatEnums::CONTROL_FID)
     {
@@ -731,10 +862,10 @@ SatUtMac::ScheduleSlottedAlohaTransmission (uint32_t allocationChannel)
         }
 
       /// time slot configuration
-      Ptr<SatTimeSlotConf> timeSlotConf = frameConf->GetTimeSlotConf ( result.second );
+      const SatTimeSlotConf &timeSlotConf = frameConf->GetTimeSlotConf ( result.second );
 
       /// start time
-      Time slotStartTime = superframeStartTime + timeSlotConf->GetStartTime ();
+      Time slotStartTime = superframeStartTime + timeSlotConf.GetStartTime ();
       Time offset = slotStartTime - Now ();
 
       if (offset.IsStrictlyNegative ())
@@ -743,11 +874,11 @@ SatUtMac::ScheduleSlottedAlohaTransmission (uint32_t allocationChannel)
         }
 
       /// duration
-      Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf->GetWaveFormId ());
+      Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf.GetWaveFormId ());
       Time duration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
 
       /// carrier
-      uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf->GetCarrierId () );
+      uint32_t carrierId = m_superframeSeq->GetCarrierId (0, frameId, timeSlotConf.GetCarrierId () );
 
       NS_LOG_INFO ("SatUtMac::ScheduleSlottedAlohaTransmission - Starting to schedule @ " << Now ().GetSeconds () <<
                     ", SF ID: " << superFrameId <<
@@ -800,21 +931,20 @@ SatUtMac::FindNextAvailableRandomAccessSlot (Time opportunityOffset,
 
   NS_LOG_INFO ("SatUtMac::FindNextAvailableRandomAccessSlot - UT: " << m_nodeInfo->GetMacAddress () << " time: " << Now ().GetSeconds ());
 
-  Ptr<SatTimeSlotConf> slotConf;
   uint32_t slotId;
   bool availableSlotFound = false;
 
   /// iterate through slots in this frame
   for (slotId = 0; slotId < timeSlotCount; slotId++)
     {
-      slotConf = frameConf->GetTimeSlotConf (slotId);
+      const SatTimeSlotConf &slotConf = frameConf->GetTimeSlotConf (slotId);
 
       //NS_LOG_INFO ("SatUtMac::FindNextAvailableRandomAccessSlot - Slot: " << slotId <<
-      //             " slot offset: " << slotConf->GetStartTime.GetSeconds () <<
+      //             " slot offset: " << slotConf.GetStartTime.GetSeconds () <<
       //             " opportunity offset: " << opportunityOffset.GetSeconds ());
 
       /// if slot offset is equal or larger than Tx opportunity offset, i.e., the slot is in the future
-      if (slotConf->GetStartTime () >= opportunityOffset)
+      if (slotConf.GetStartTime () >= opportunityOffset)
         {
           /// if slot is available, set the slot as used and continue with the transmission
           if (UpdateUsedRandomAccessSlots (superFrameId, allocationChannel, slotId))
@@ -980,10 +1110,10 @@ SatUtMac::CreateCrdsaPacketInstances (uint32_t allocationChannel, std::set<uint3
             }
 
           /// time slot configuration
-          Ptr<SatTimeSlotConf> timeSlotConf = frameConf->GetTimeSlotConf ( replicas[i].first );
+          const SatTimeSlotConf &timeSlotConf = frameConf->GetTimeSlotConf ( replicas[i].first );
 
           /// start time
-          Time slotDelay = superframeStartTime + timeSlotConf->GetStartTime ();
+          Time slotDelay = superframeStartTime + timeSlotConf.GetStartTime ();
           Time offset = slotDelay - Now ();
 
           if (offset.IsStrictlyNegative ())
@@ -992,11 +1122,11 @@ SatUtMac::CreateCrdsaPacketInstances (uint32_t allocationChannel, std::set<uint3
             }
 
           /// duration
-          Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf->GetWaveFormId ());
+          Ptr<SatWaveform> wf = m_superframeSeq->GetWaveformConf ()->GetWaveform (timeSlotConf.GetWaveFormId ());
           Time duration = wf->GetBurstDuration (frameConf->GetBtuConf ()->GetSymbolRateInBauds ());
 
           /// carrier
-          uint32_t carrierId = m_superframeSeq->GetCarrierId (SatConstVariables::SUPERFRAME_SEQUENCE, frameId, timeSlotConf->GetCarrierId () );
+          uint32_t carrierId = m_superframeSeq->GetCarrierId (SatConstVariables::SUPERFRAME_SEQUENCE, frameId, timeSlotConf.GetCarrierId () );
 
           /// create CRDSA Tx params
           SatSignalParameters::txInfo_s txInfo;
@@ -1117,6 +1247,9 @@ SatUtMac::DoFrameStart ()
 
   NS_LOG_INFO ("SatUtMac::DoFrameStart - UT: " << m_nodeInfo->GetMacAddress () << " time: " << Now ().GetSeconds ());
 
+  m_frameStartScheduled = false;
+  m_lastFrameStartCount = Singleton<SatRtnLinkTime>::Get ()->GetCurrentSuperFrameCount (SatConstVariables::SUPERFRAME_SEQUENCE, m_timingAdvanceCb ());
+
   if (m_randomAccess != NULL)
     {
       /// reset packet ID counter for this frame
@@ -1126,6 +1259,29 @@ SatUtMac::DoFrameStart ()
       DoRandomAccess (SatEnums::RA_TRIGGER_TYPE_CRDSA);
     }
 
+  /// With idle buffers the CRDSA trigger only updates the idle and consecutive
+  /// blocks, which is done at once when the frame starts are resumed. The frame
+  /// starts are not needed at all, if CRDSA is not in use.
+  if (m_randomAccess == NULL || !m_randomAccess->IsCrdsaInUse (m_raChannel))
+    {
+      NS_LOG_INFO ("SatUtMac::DoFrameStart - CRDSA not in use, stopping frame starts");
+    }
+  else if (!m_buffersIdleCb.IsNull () && m_buffersIdleCb ())
+    {
+      NS_LOG_INFO ("SatUtMac::DoFrameStart - Buffers idle, stopping frame starts");
+    }
+  // the random access may have resumed the frame starts already
+  else if (!m_frameStartScheduled)
+    {
+      ScheduleFrameStart ();
+    }
+}
+
+void
+SatUtMac::ScheduleFrameStart ()
+{
+  NS_LOG_FUNCTION (this);
+
   Time nextSuperFrameTxTime = GetNextSuperFrameTxTime (SatConstVariables::SUPERFRAME_SEQUENCE);
 
   if (Now () >= nextSuperFrameTxTime)
@@ -1136,6 +1292,25 @@ SatUtMac::DoFrameStart ()
   Time schedulingDelay = nextSuperFrameTxTime - Now ();
 
   Simulator::Schedule (schedulingDelay, &SatUtMac::DoFrameStart, this);
+  m_frameStartScheduled = true;
+}
+
+void
+SatUtMac::ResumeFrameStarts ()
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t superFrameCount = Singleton<SatRtnLinkTime>::Get ()->GetCurrentSuperFrameCount (SatConstVariables::SUPERFRAME_SEQUENCE, m_timingAdvanceCb ());
+
+  NS_ASSERT (superFrameCount >= m_lastFrameStartCount);
+
+  NS_LOG_INFO ("SatUtMac::ResumeFrameStarts - UT: " << m_nodeInfo->GetMacAddress () << " time: " << Now ().GetSeconds () << " idle frames: " << superFrameCount - m_lastFrameStartCount);
+
+  /// the frames passed while the frame starts were stopped had idle buffers
+  m_randomAccess->CrdsaSkipIdleFrames (superFrameCount - m_lastFrameStartCount);
+  m_lastFrameStartCount = superFrameCount;
+
+  ScheduleFrameStart ();
 }
 
 
@@ -26,6 +26,7 @@
 #include <ns3/traced-callback.h>
 #include <ns3/traced-value.h>
 #include <ns3/nstime.h>
+#include <ns3/event-id.h>
 #include <ns3/satellite-mac.h>
 #include <ns3/satellite-phy.h>
 #include <ns3/satellite-queue.h>
@@ -34,6 +35,7 @@
 #include <ns3/satellite-random-access-container.h>
 #include <ns3/satellite-enums.h>
 #include <utility>
+#include <vector>
 
 namespace ns3 {
 
@@ -114,6 +116,20 @@ public:
    */
   void SetTimingAdvanceCallback (SatUtMac::TimingAdvanceCallback cb);
 
+  /**
+   * \return Are the buffers idle, i.e. empty and without data which could
+   *         be moved back to the buffers without a queue event.
+   */
+  typedef Callback<bool> BuffersIdleCallback;
+
+  /**
+   * \brief Set the buffers idle callback. With the callback set, the frame
+   * starts are scheduled only when there is data to send.
+   * \param cb callback to invoke at the frame start to check whether the
+   *        next frame start is needed.
+   */
+  void SetBuffersIdleCallback (SatUtMac::BuffersIdleCallback cb);
+
   /**
    * Callback for informing the amount of dedicated access
    * bytes received from TBTP
@@ -177,6 +193,14 @@ public:
    */
   void SetRandomAccess (Ptr<SatRandomAccess> randomAccess);
 
+  /**
+   * \brief Assign fixed random variable stream numbers to the random
+   * variables used by this MAC and its random access module.
+   * \param stream First stream index to use
+   * \return The number of stream indices assigned
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
   /**
    * \brief Method to check whether a transmission of a control msg
    * is somewhat possible. Transmission cannot be guaranteed, but at least
@@ -305,14 +329,31 @@ private:
   void ScheduleTimeSlots (Ptr<SatTbtpMessage> tbtp);
 
   /**
-   * Schdules one Tx opportunity, i.e. time slot.
+   * Schdules one Tx opportunity, i.e. time slot. The opportunity is added
+   * to the end of the slot schedule of the UT and sorted into it by
+   * ScheduleSlotSchedule.
    * \param transmitDelay time when transmit possibility starts
    * \param duration duration of the burst
    * \param wf waveform
    * \param tsConf Time slot conf
    * \param carrierId Carrier id used for the transmission
    */
-  void ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, uint32_t carrierId);
+  void ScheduleDaTxOpportunity (Time transmitDelay, Time duration, Ptr<SatWaveform> wf, const SatTimeSlotConf &tsConf, uint32_t carrierId);
+
+  /**
+   * Sort the Tx opportunities of a TBTP added to the end of the slot schedule
+   * into the schedule, and schedule the slot schedule event for the first
+   * opportunity of the schedule, unless it is already scheduled earlier.
+   * \param first Position of the first Tx opportunity of the TBTP in the slot schedule
+   */
+  void ScheduleSlotSchedule (uint32_t first);
+
+  /**
+   * Transmit the Tx opportunities at the head of the slot schedule, which
+   * are due at the current time, and schedule the event again for the next
+   * opportunity of the schedule.
+   */
+  void DoDaTxOpportunities ();
 
   /**
    * Notify the upper layer about the Tx opportunity. If upper layer
@@ -321,10 +362,11 @@ private:
    * \param duration duration of the burst
    * \param carrierId Carrier id used for the transmission
    * \param wf waveform
-   * \param tsConf Time slot conf
+   * \param slotType Type of the time slot
+   * \param rcIndex RC index of the time slot
    * \param policy UT scheduler policy
    */
-  void DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, Ptr<SatTimeSlotConf> tsConf, SatUtScheduler::SatCompliancePolicy_t policy = SatUtScheduler::LOOSE);
+  void DoTransmit (Time duration, uint32_t carrierId, Ptr<SatWaveform> wf, SatTimeSlotConf::SatTimeSlotType_t slotType, uint8_t rcIndex, SatUtScheduler::SatCompliancePolicy_t policy = SatUtScheduler::LOOSE);
 
   /**
    * Notify the upper layer about the Slotted ALOHA Tx opportunity. If upper layer
@@ -368,6 +410,17 @@ private:
    */
   void DoFrameStart ();
 
+  /**
+   * \brief Schedule the next frame start to the Tx time of the next superframe.
+   */
+  void ScheduleFrameStart ();
+
+  /**
+   * \brief Resume the frame starts stopped because of idle buffers. The CRDSA
+   * state is updated with the frames passed without data to send.
+   */
+  void ResumeFrameStarts ();
+
   SatUtMac& operator = (const SatUtMac &);
   SatUtMac (const SatUtMac &);
 
@@ -381,6 +434,21 @@ private:
    */
   TimingAdvanceCallback m_timingAdvanceCb;
 
+  /**
+   * Callback for checking whether the buffers are idle
+   */
+  BuffersIdleCallback m_buffersIdleCb;
+
+  /**
+   * Count of the superframe, which frame start was executed or passed last
+   */
+  uint32_t m_lastFrameStartCount;
+
+  /**
+   * Is the next frame start scheduled
+   */
+  bool m_frameStartScheduled;
+
   /**
    * Callback for informing the assigned TBTP resources
    */
@@ -402,6 +470,44 @@ private:
    */
   Ptr<SatTbtpContainer> m_tbtpContainer;
 
+  /**
+   * \brief Scheduled DA Tx opportunity, i.e. time slot
+   */
+  typedef struct
+  {
+    Time m_txTime;
+    Time m_duration;
+    uint32_t m_carrierId;
+    Ptr<SatWaveform> m_waveform;
+    SatTimeSlotConf::SatTimeSlotType_t m_slotType;
+    uint8_t m_rcIndex;
+  } DaTxOpportunity_t;
+
+  /**
+   * Comparison of the Tx opportunities by their transmission times.
+   * \param a First Tx opportunity
+   * \param b Second Tx opportunity
+   * \return true if the first Tx opportunity is transmitted before the second one
+   */
+  static bool CompareDaTxOpportunities (const DaTxOpportunity_t &a, const DaTxOpportunity_t &b);
+
+  /**
+   * Slot schedule of the UT, i.e. the scheduled DA Tx opportunities sorted
+   * by their transmission times, starting from m_daTxHead.
+   */
+  std::vector<DaTxOpportunity_t> m_daTxOpportunities;
+
+  /**
+   * Position of the next DA Tx opportunity in the slot schedule.
+   */
+  uint32_t m_daTxHead;
+
+  /**
+   * Event of the slot schedule, pending for the first opportunity of the
+   * schedule only.
+   */
+  EventId m_daTxEvent;
+
   /**
    * \brief Uniform random variable distribution generator
    */
@@ -32,6 +32,8 @@
 #include <ns3/satellite-const-variables.h>
 #include <ns3/satellite-utils.h>
 #include <ns3/satellite-link-results.h>
+#include <ns3/singleton.h>
+#include <ns3/satellite-input-data-cache.h>
 #include "satellite-wave-form-conf.h"
 
 
@@ -221,77 +223,101 @@ SatWaveformConf::ReadFromFile (std::string filePathName)
 
   std::vector<uint32_t> wfIds;
 
-  // READ FROM THE SPECIFIED INPUT FILE
-  std::ifstream *ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
+  // Use the binary input data cache, if available. The coding rate fraction
+  // is stored as two columns (numerator and denominator).
+  uint32_t rows = 0;
+  uint32_t columns = 0;
+  const double *table = Singleton<SatInputDataCache>::Get ()->GetTable (filePathName, rows, columns);
 
-  if (!ifs->is_open ())
+  if ((table != 0) && (columns == 6))
     {
-      // script might be launched by test.py, try a different base path
-      delete ifs;
-      filePathName = "../../" + filePathName;
-      ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
-
-      if (!ifs->is_open ())
+      for (uint32_t i = 0; i < rows; i++)
         {
-          NS_FATAL_ERROR ("The file " << filePathName << " is not found.");
+          const double *row = table + i * columns;
+          wfIds.push_back (row[0]);
+          AddWaveform (row[0], row[1], row[2], row[3], row[4], row[5]);
         }
     }
+  else
+    {
+      // READ FROM THE SPECIFIED INPUT FILE
+      std::ifstream *ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
 
-  // Row vector containing the waveform information for a certain waveform index
-  std::vector<double> rowVector;
-
-  // Start conditions
-  int32_t wfIndex, modulatedBits, payloadBytes, durationInSymbols;
-  std::string sCodingRate;
+      if (!ifs->is_open ())
+        {
+          // script might be launched by test.py, try a different base path
+          delete ifs;
+          filePathName = "../../" + filePathName;
+          ifs = new std::ifstream (filePathName.c_str (), std::ifstream::in);
 
-  // Read a row
-  *ifs >> wfIndex >> modulatedBits >> sCodingRate >> payloadBytes >> durationInSymbols;
+          if (!ifs->is_open ())
+            {
+              NS_FATAL_ERROR ("The file " << filePathName << " is not found.");
+            }
+        }
 
-  while (ifs->good ())
-    {
-      // Store temporarily all wfIds
-      wfIds.push_back (wfIndex);
+      // Start conditions
+      int32_t wfIndex, modulatedBits, payloadBytes, durationInSymbols;
+      std::string sCodingRate;
 
-      // Convert the coding rate fraction into double
-      std::istringstream ss (sCodingRate);
-      std::string token;
-      std::vector<uint32_t> output;
+      // Read a row
+      *ifs >> wfIndex >> modulatedBits >> sCodingRate >> payloadBytes >> durationInSymbols;
 
-      while (std::getline (ss, token, '/'))
+      while (ifs->good ())
         {
-          uint32_t i;
-          std::stringstream s;
-          s.str (token);
-          s >> i;
-          output.push_back (i);
-        }
+          // Store temporarily all wfIds
+          wfIds.push_back (wfIndex);
 
-      if (output.size () != 2)
-        {
-          NS_FATAL_ERROR ("SatWaveformConf::ReadFromFile - Temp fraction vector has unexpected amount of elements!");
-        }
+          // Convert the coding rate fraction into numerator and denominator
+          std::istringstream ss (sCodingRate);
+          std::string token;
+          std::vector<uint32_t> output;
 
-      double dCodingRate = double(output[0]) / output[1];
+          while (std::getline (ss, token, '/'))
+            {
+              uint32_t i;
+              std::stringstream s;
+              s.str (token);
+              s >> i;
+              output.push_back (i);
+            }
 
-      // Convert modulated bits and coding rate to MODCOD enum
-      SatEnums::SatModcod_t modcod = ConvertToModCod (modulatedBits, output[0], output[1]);
+          if (output.size () != 2)
+            {
+              NS_FATAL_ERROR ("SatWaveformConf::ReadFromFile - Temp fraction vector has unexpected amount of elements!");
+            }
 
-      // Create new waveform and insert it to the waveform map
-      Ptr<SatWaveform> wf = Create<SatWaveform> (wfIndex, modulatedBits, dCodingRate, modcod, payloadBytes, durationInSymbols);
-      m_waveforms.insert (std::make_pair (wfIndex, wf));
+          AddWaveform (wfIndex, modulatedBits, output[0], output[1], payloadBytes, durationInSymbols);
 
-      // get next row
-      *ifs >> wfIndex >> modulatedBits >> sCodingRate >> payloadBytes >> durationInSymbols;
-    }
+          // get next row
+          *ifs >> wfIndex >> modulatedBits >> sCodingRate >> payloadBytes >> durationInSymbols;
+        }
 
-  ifs->close ();
-  delete ifs;
+      ifs->close ();
+      delete ifs;
+    }
 
   // Note, currently we assume that the waveform ids are consecutive!
   m_minWfId = *std::min_element (wfIds.begin (), wfIds.end ());
   m_maxWfId = *std::max_element (wfIds.begin (), wfIds.end ());
 }
 
+void
+SatWaveformConf::AddWaveform (uint32_t wfIndex, uint32_t modulatedBits, uint32_t codingRateNumerator, uint32_t codingRateDenominator,
+                              uint32_t payloadBytes, uint32_t durationInSymbols)
+{
+  NS_LOG_FUNCTION (this << wfIndex);
+
+  double dCodingRate = double (codingRateNumerator) / codingRateDenominator;
+
+  // Convert modulated bits and coding rate to MODCOD enum
+  SatEnums::SatModcod_t modcod = ConvertToModCod (modulatedBits, codingRateNumerator, codingRateDenominator);
+
+  // Create new waveform and insert it to the waveform map
+  Ptr<SatWaveform> wf = Create<SatWaveform> (wfIndex, modulatedBits, dCodingRate, modcod, payloadBytes, durationInSymbols);
+  m_waveforms.insert (std::make_pair (wfIndex, wf));
+}
+
 
 void SatWaveformConf::InitializeEbNoRequirements ( Ptr<SatLinkResultsDvbRcs2> linkResults )
 {
@@ -322,6 +322,18 @@ private:
    */
   void ReadFromFile (std::string filePathName);
 
+  /**
+   * \brief Create a waveform and add it to the waveform container
+   * \param wfIndex Waveform id
+   * \param modulatedBits Modulated bits of the waveform
+   * \param codingRateNumerator Coding rate numerator of the waveform
+   * \param codingRateDenominator Coding rate denominator of the waveform
+   * \param payloadBytes Payload in bytes
+   * \param durationInSymbols Burst duration in symbols
+   */
+  void AddWaveform (uint32_t wfIndex, uint32_t modulatedBits, uint32_t codingRateNumerator, uint32_t codingRateDenominator,
+                    uint32_t payloadBytes, uint32_t durationInSymbols);
+
   /**
    * \brief Convert modulated bits and coding rate to a MODCOD enum
    * \param modulatedBits Modulated bits of the MODCOD
@@ -0,0 +1,342 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/log.h>
+#include <ns3/double.h>
+#include <ns3/uinteger.h>
+#include <ns3/string.h>
+#include <ns3/simulator.h>
+#include <ns3/satellite-output-fstream-wrapper.h>
+#include <algorithm>
+#include <sstream>
+#include "satellite-quantile-collector.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatQuantileCollector");
+
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (SatQuantileCollector);
+
+
+SatQuantileCollector::SatQuantileCollector ()
+  : m_sketch (),
+    m_relativeAccuracy (m_sketch.GetRelativeAccuracy ()),
+    m_maxBins (2048),
+    m_percentiles (),
+    m_sketchFileName (""),
+    m_aggregate (0),
+    m_hasEmitted (false)
+{
+  NS_LOG_FUNCTION (this);
+
+  // the output is produced once all samples have been received
+  m_emitEvent = Simulator::ScheduleDestroy (&SatQuantileCollector::EmitOutput,
+                                            this);
+}
+
+
+TypeId // static
+SatQuantileCollector::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::SatQuantileCollector")
+    .SetParent<DataCollectionObject> ()
+    .AddConstructor<SatQuantileCollector> ()
+    .AddAttribute ("RelativeAccuracy",
+                   "Relative accuracy of the estimated percentiles, e.g., 0.01 "
+                   "for estimates within 1% of the actual sample value.",
+                   DoubleValue (0.01),
+                   MakeDoubleAccessor (&SatQuantileCollector::SetRelativeAccuracy,
+                                       &SatQuantileCollector::GetRelativeAccuracy),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("MaxBins",
+                   "Maximum number of sketch buckets kept for positive and "
+                   "negative samples each, which bounds the memory use.",
+                   UintegerValue (2048),
+                   MakeUintegerAccessor (&SatQuantileCollector::SetMaxBins,
+                                         &SatQuantileCollector::GetMaxBins),
+                   MakeUintegerChecker<uint32_t> (2))
+    .AddAttribute ("Percentiles",
+                   "Space or comma separated list of percentiles to be "
+                   "reported at the end of the simulation.",
+                   StringValue ("50 95 99 99.9"),
+                   MakeStringAccessor (&SatQuantileCollector::SetPercentiles,
+                                       &SatQuantileCollector::GetPercentiles),
+                   MakeStringChecker ())
+    .AddAttribute ("SketchFileName",
+                   "If not empty, the full sketch is written into this file at "
+                   "the end of the simulation, so that it can be merged later "
+                   "with the sketches of other runs.",
+                   StringValue (""),
+                   MakeStringAccessor (&SatQuantileCollector::SetSketchFileName,
+                                       &SatQuantileCollector::GetSketchFileName),
+                   MakeStringChecker ())
+    .AddTraceSource ("Output",
+                     "Fired once for each configured percentile at the end of "
+                     "the simulation, with the percentile and the estimated "
+                     "sample value.",
+                     MakeTraceSourceAccessor (&SatQuantileCollector::m_output),
+                     "ns3::SatQuantileCollector::OutputCallback")
+    .AddTraceSource ("OutputString",
+                     "Summary of the received samples, fired at the end of "
+                     "the simulation before the percentiles.",
+                     MakeTraceSourceAccessor (&SatQuantileCollector::m_outputString),
+                     "ns3::SatQuantileCollector::OutputStringCallback")
+  ;
+  return tid;
+}
+
+
+void
+SatQuantileCollector::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  EmitOutput ();
+  m_emitEvent.Cancel ();
+  m_aggregate = 0;
+  DataCollectionObject::DoDispose ();
+}
+
+
+void
+SatQuantileCollector::SetRelativeAccuracy (double relativeAccuracy)
+{
+  NS_LOG_FUNCTION (this << relativeAccuracy);
+
+  if (m_sketch.GetCount () > 0)
+    {
+      NS_LOG_WARN (this << " discarding " << m_sketch.GetCount ()
+                        << " samples due to change of relative accuracy");
+    }
+
+  m_relativeAccuracy = relativeAccuracy;
+  m_sketch = SatQuantileSketch (m_relativeAccuracy, m_maxBins);
+}
+
+
+double
+SatQuantileCollector::GetRelativeAccuracy () const
+{
+  return m_relativeAccuracy;
+}
+
+
+void
+SatQuantileCollector::SetMaxBins (uint32_t maxBins)
+{
+  NS_LOG_FUNCTION (this << maxBins);
+
+  if (m_sketch.GetCount () > 0)
+    {
+      NS_LOG_WARN (this << " discarding " << m_sketch.GetCount ()
+                        << " samples due to change of maximum number of bins");
+    }
+
+  m_maxBins = maxBins;
+  m_sketch = SatQuantileSketch (m_relativeAccuracy, m_maxBins);
+}
+
+
+uint32_t
+SatQuantileCollector::GetMaxBins () const
+{
+  return m_maxBins;
+}
+
+
+void
+SatQuantileCollector::SetPercentiles (std::string percentiles)
+{
+  NS_LOG_FUNCTION (this << percentiles);
+
+  std::replace (percentiles.begin (), percentiles.end (), ',', ' ');
+  std::istringstream iss (percentiles);
+  std::vector<double> parsed;
+  double p;
+
+  while (iss >> p)
+    {
+      if ((p < 0.0) || (p > 100.0))
+        {
+          NS_FATAL_ERROR ("Invalid percentile " << p);
+        }
+      parsed.push_back (p);
+    }
+
+  if (!iss.eof ())
+    {
+      NS_FATAL_ERROR ("Unable to parse percentiles \"" << percentiles << "\"");
+    }
+
+  std::sort (parsed.begin (), parsed.end ());
+  m_percentiles = parsed;
+}
+
+
+std::string
+SatQuantileCollector::GetPercentiles () const
+{
+  std::ostringstream oss;
+
+  for (std::vector<double>::const_iterator it = m_percentiles.begin ();
+       it != m_percentiles.end (); ++it)
+    {
+      if (it != m_percentiles.begin ())
+        {
+          oss << " ";
+        }
+      oss << *it;
+    }
+
+  return oss.str ();
+}
+
+
+void
+SatQuantileCollector::SetSketchFileName (std::string fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  m_sketchFileName = fileName;
+}
+
+
+std::string
+SatQuantileCollector::GetSketchFileName () const
+{
+  return m_sketchFileName;
+}
+
+
+void
+SatQuantileCollector::SetAggregateCollector (Ptr<SatQuantileCollector> aggregate)
+{
+  NS_LOG_FUNCTION (this << aggregate);
+  NS_ASSERT (aggregate != this);
+  m_aggregate = aggregate;
+}
+
+
+const SatQuantileSketch &
+SatQuantileCollector::GetSketch () const
+{
+  return m_sketch;
+}
+
+
+void
+SatQuantileCollector::EmitOutput ()
+{
+  NS_LOG_FUNCTION (this << GetName () << m_sketch.GetCount ());
+
+  if (m_hasEmitted)
+    {
+      return;
+    }
+
+  m_hasEmitted = true;
+
+  std::ostringstream oss;
+  oss << "% count " << m_sketch.GetCount ()
+      << " min " << m_sketch.GetMin ()
+      << " max " << m_sketch.GetMax ()
+      << " mean " << m_sketch.GetMean ()
+      << " relative_accuracy " << m_relativeAccuracy;
+  m_outputString (oss.str ());
+
+  if (m_sketch.GetCount () > 0)
+    {
+      for (std::vector<double>::const_iterator it = m_percentiles.begin ();
+           it != m_percentiles.end (); ++it)
+        {
+          m_output (*it, m_sketch.GetQuantile (*it / 100.0));
+        }
+    }
+
+  if (!m_sketchFileName.empty ())
+    {
+      SatOutputFileStreamWrapper wrapper (m_sketchFileName, std::ios::out);
+      std::ofstream *stream = wrapper.GetStream ();
+
+      if (stream->is_open ())
+        {
+          *stream << m_sketch.Serialize () << std::endl;
+          stream->close ();
+        }
+      else
+        {
+          NS_LOG_WARN (this << " unable to write sketch into " << m_sketchFileName);
+        }
+    }
+}
+
+
+void
+SatQuantileCollector::AddSample (double value)
+{
+  if (IsEnabled ())
+    {
+      m_sketch.Add (value);
+
+      if (m_aggregate != 0)
+        {
+          m_aggregate->AddSample (value);
+        }
+    }
+}
+
+
+// TRACE SINKS ////////////////////////////////////////////////////////////////
+
+void
+SatQuantileCollector::TraceSinkDouble (double oldData, double newData)
+{
+  AddSample (newData);
+}
+
+
+void
+SatQuantileCollector::TraceSinkDouble1 (double data)
+{
+  AddSample (data);
+}
+
+
+void
+SatQuantileCollector::TraceSinkUinteger8 (uint8_t oldData, uint8_t newData)
+{
+  AddSample (static_cast<double> (newData));
+}
+
+
+void
+SatQuantileCollector::TraceSinkUinteger16 (uint16_t oldData, uint16_t newData)
+{
+  AddSample (static_cast<double> (newData));
+}
+
+
+void
+SatQuantileCollector::TraceSinkUinteger32 (uint32_t oldData, uint32_t newData)
+{
+  AddSample (static_cast<double> (newData));
+}
+
+
+} // end of namespace ns3
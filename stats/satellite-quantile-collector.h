@@ -0,0 +1,227 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_QUANTILE_COLLECTOR_H
+#define SATELLITE_QUANTILE_COLLECTOR_H
+
+#include <ns3/data-collection-object.h>
+#include <ns3/traced-callback.h>
+#include <ns3/event-id.h>
+#include <ns3/ptr.h>
+#include <ns3/satellite-quantile-sketch.h>
+#include <string>
+#include <vector>
+
+
+namespace ns3 {
+
+
+/**
+ * \ingroup satstats
+ * \brief Collector which summarizes the received samples into a set of
+ *        percentiles using a bounded-memory streaming sketch.
+ *
+ * In contrast to DistributionCollector, the range of the samples does not
+ * need to be known in advance and the memory use does not depend on the
+ * number of samples nor on the bin resolution. See SatQuantileSketch.
+ *
+ * ### Input ###
+ * This class provides 4 trace sinks for receiving inputs. Each trace sink
+ * is a function with a signature similar to the following:
+ * \code
+ *   void TraceSinkP (P oldData, P newData);
+ * \endcode
+ * where `P` is one of the 4 supported data types. This type of signature
+ * follows the trace source signature types commonly exported by probes.
+ * Although different data types are accepted, they are all internally
+ * processed using `double` data type. In addition, TraceSinkDouble1() accepts
+ * a single `double` value, e.g., from the `Output` trace source of another
+ * collector.
+ *
+ * ### Output ###
+ * At the end of the simulation, the collector fires the `Output` trace source
+ * once for each percentile given in the `Percentiles` attribute, in ascending
+ * order, with the percentile and the estimated sample value as arguments. The
+ * `OutputString` trace source is fired before that with a summary (number of
+ * samples, minimum, maximum, and mean) intended as a context heading.
+ *
+ * If the `SketchFileName` attribute is set, the full sketch is also written
+ * into that file as a single line, which can be restored and merged with the
+ * sketches of other runs or other collectors, see
+ * SatQuantileSketch::Deserialize() and SatQuantileSketch::Merge().
+ *
+ * ### Aggregate collector ###
+ * Another SatQuantileCollector can be set as the aggregate of this one with
+ * SetAggregateCollector(). Every sample received by this collector is then
+ * also added into the aggregate collector, which allows producing
+ * per-identifier and global percentiles from the same probes.
+ */
+class SatQuantileCollector : public DataCollectionObject
+{
+public:
+  /// Creates a new collector instance.
+  SatQuantileCollector ();
+
+  // inherited from ObjectBase base class
+  static TypeId GetTypeId ();
+
+  /**
+   * \brief Callback signature for `Output` trace source.
+   * \param percentile the reported percentile, e.g., 99.9.
+   * \param value the estimated sample value at the percentile.
+   */
+  typedef void (*OutputCallback)(double percentile, double value);
+
+  /**
+   * \brief Callback signature for `OutputString` trace source.
+   * \param summary summary of the received samples.
+   */
+  typedef void (*OutputStringCallback)(std::string summary);
+
+  /**
+   * \param relativeAccuracy relative accuracy of the estimated percentiles.
+   * \warning Discards all samples received so far.
+   */
+  void SetRelativeAccuracy (double relativeAccuracy);
+
+  /**
+   * \return relative accuracy of the estimated percentiles.
+   */
+  double GetRelativeAccuracy () const;
+
+  /**
+   * \param maxBins maximum number of sketch buckets per sign.
+   * \warning Discards all samples received so far.
+   */
+  void SetMaxBins (uint32_t maxBins);
+
+  /**
+   * \return maximum number of sketch buckets per sign.
+   */
+  uint32_t GetMaxBins () const;
+
+  /**
+   * \param percentiles space or comma separated list of percentiles to be
+   *                    reported, e.g., "50 95 99 99.9".
+   */
+  void SetPercentiles (std::string percentiles);
+
+  /**
+   * \return space separated list of percentiles to be reported.
+   */
+  std::string GetPercentiles () const;
+
+  /**
+   * \param fileName path of the file where the sketch is written at the end
+   *                 of the simulation, or an empty string to disable it.
+   */
+  void SetSketchFileName (std::string fileName);
+
+  /**
+   * \return path of the file where the sketch is written.
+   */
+  std::string GetSketchFileName () const;
+
+  /**
+   * \param aggregate another collector which will receive a copy of every
+   *                  sample received by this collector.
+   */
+  void SetAggregateCollector (Ptr<SatQuantileCollector> aggregate);
+
+  /**
+   * \return the sketch holding the samples received so far.
+   */
+  const SatQuantileSketch & GetSketch () const;
+
+  /**
+   * \brief Emit the output trace sources based on the samples received so
+   *        far. Invoked automatically at the end of the simulation, and does
+   *        nothing if it has been invoked before.
+   */
+  void EmitOutput ();
+
+  /**
+   * \brief Add a sample into the sketch.
+   * \param value the sample
+   */
+  void AddSample (double value);
+
+  // TRACE SINKS //////////////////////////////////////////////////////////////
+
+  /**
+   * \brief Trace sink for receiving data from `double` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkDouble (double oldData, double newData);
+
+  /**
+   * \brief Trace sink for receiving data from `double` valued trace sources.
+   * \param data the value.
+   */
+  void TraceSinkDouble1 (double data);
+
+  /**
+   * \brief Trace sink for receiving data from `uint8_t` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkUinteger8 (uint8_t oldData, uint8_t newData);
+
+  /**
+   * \brief Trace sink for receiving data from `uint16_t` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkUinteger16 (uint16_t oldData, uint16_t newData);
+
+  /**
+   * \brief Trace sink for receiving data from `uint32_t` valued trace sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   */
+  void TraceSinkUinteger32 (uint32_t oldData, uint32_t newData);
+
+protected:
+  // inherited from Object base class
+  virtual void DoDispose ();
+
+private:
+  SatQuantileSketch         m_sketch;            ///< Samples received so far.
+  double                    m_relativeAccuracy;  ///< `RelativeAccuracy` attribute.
+  uint32_t                  m_maxBins;           ///< `MaxBins` attribute.
+  std::vector<double>       m_percentiles;       ///< `Percentiles` attribute.
+  std::string               m_sketchFileName;    ///< `SketchFileName` attribute.
+  Ptr<SatQuantileCollector> m_aggregate;         ///< Receives a copy of every sample.
+  bool                      m_hasEmitted;        ///< True after EmitOutput().
+  EventId                   m_emitEvent;         ///< Scheduled at simulation destroy.
+
+  /// `Output` trace source.
+  TracedCallback<double, double> m_output;
+
+  /// `OutputString` trace source.
+  TracedCallback<std::string> m_outputString;
+
+}; // end of class SatQuantileCollector
+
+
+} // end of namespace ns3
+
+
+#endif /* SATELLITE_QUANTILE_COLLECTOR_H */
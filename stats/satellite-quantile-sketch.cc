@@ -0,0 +1,427 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/log.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include "satellite-quantile-sketch.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatQuantileSketch");
+
+
+namespace ns3 {
+
+/// Tag written in front of every serialized sketch.
+static const std::string SAT_QUANTILE_SKETCH_TAG = "ddsketch";
+
+/// Version of the serialization format.
+static const uint32_t SAT_QUANTILE_SKETCH_VERSION = 1;
+
+
+SatQuantileSketch::SatQuantileSketch (double relativeAccuracy, uint32_t maxBins)
+  : m_relativeAccuracy (relativeAccuracy),
+    m_maxBins (maxBins),
+    m_gamma (0.0),
+    m_logGamma (0.0),
+    m_minIndexable (0.0),
+    m_zeroCount (0),
+    m_count (0),
+    m_sum (0.0),
+    m_min (std::numeric_limits<double>::infinity ()),
+    m_max (-std::numeric_limits<double>::infinity ())
+{
+  NS_LOG_FUNCTION (this << relativeAccuracy << maxBins);
+
+  if ((relativeAccuracy <= 0.0) || (relativeAccuracy >= 1.0))
+    {
+      NS_FATAL_ERROR ("Invalid relative accuracy " << relativeAccuracy
+                                                   << ", must be within (0, 1)");
+    }
+
+  if (maxBins < 2)
+    {
+      NS_FATAL_ERROR ("Invalid maximum number of bins " << maxBins);
+    }
+
+  m_gamma = (1.0 + relativeAccuracy) / (1.0 - relativeAccuracy);
+  m_logGamma = std::log (m_gamma);
+  m_minIndexable = std::numeric_limits<double>::min () * m_gamma;
+}
+
+
+void
+SatQuantileSketch::Add (double value)
+{
+  if (std::isnan (value))
+    {
+      NS_LOG_WARN (this << " ignoring NaN sample");
+      return;
+    }
+
+  if (value > m_minIndexable)
+    {
+      m_positive[GetIndex (value)]++;
+
+      if (m_positive.size () > m_maxBins)
+        {
+          Collapse (m_positive, false);
+        }
+    }
+  else if (value < -m_minIndexable)
+    {
+      m_negative[GetIndex (-value)]++;
+
+      if (m_negative.size () > m_maxBins)
+        {
+          Collapse (m_negative, true);
+        }
+    }
+  else
+    {
+      m_zeroCount++;
+    }
+
+  m_count++;
+  m_sum += value;
+
+  if (value < m_min)
+    {
+      m_min = value;
+    }
+
+  if (value > m_max)
+    {
+      m_max = value;
+    }
+}
+
+
+bool
+SatQuantileSketch::Merge (const SatQuantileSketch &other)
+{
+  NS_LOG_FUNCTION (this << other.m_count);
+
+  if (std::abs (other.m_relativeAccuracy - m_relativeAccuracy) > 1e-12)
+    {
+      NS_LOG_WARN (this << " cannot merge sketches with relative accuracy "
+                        << m_relativeAccuracy << " and "
+                        << other.m_relativeAccuracy);
+      return false;
+    }
+
+  if (other.m_maxBins != m_maxBins)
+    {
+      NS_LOG_WARN (this << " cannot merge sketches with maximum number of bins "
+                        << m_maxBins << " and " << other.m_maxBins);
+      return false;
+    }
+
+  for (BinStore_t::const_iterator it = other.m_positive.begin ();
+       it != other.m_positive.end (); ++it)
+    {
+      m_positive[it->first] += it->second;
+    }
+
+  for (BinStore_t::const_iterator it = other.m_negative.begin ();
+       it != other.m_negative.end (); ++it)
+    {
+      m_negative[it->first] += it->second;
+    }
+
+  Collapse (m_positive, false);
+  Collapse (m_negative, true);
+
+  m_zeroCount += other.m_zeroCount;
+  m_count += other.m_count;
+  m_sum += other.m_sum;
+
+  if (other.m_min < m_min)
+    {
+      m_min = other.m_min;
+    }
+
+  if (other.m_max > m_max)
+    {
+      m_max = other.m_max;
+    }
+
+  return true;
+}
+
+
+double
+SatQuantileSketch::GetQuantile (double q) const
+{
+  if ((m_count == 0) || (q < 0.0) || (q > 1.0))
+    {
+      return NAN;
+    }
+
+  // zero-based rank of the requested sample
+  const double rank = q * static_cast<double> (m_count - 1);
+  double ret = m_max;
+  uint64_t cumulative = 0;
+  bool found = false;
+
+  // negative samples, from the most negative upwards
+  for (BinStore_t::const_reverse_iterator it = m_negative.rbegin ();
+       (it != m_negative.rend ()) && !found; ++it)
+    {
+      cumulative += it->second;
+      if (static_cast<double> (cumulative) > rank)
+        {
+          ret = -GetValue (it->first);
+          found = true;
+        }
+    }
+
+  if (!found)
+    {
+      cumulative += m_zeroCount;
+      if (static_cast<double> (cumulative) > rank)
+        {
+          ret = 0.0;
+          found = true;
+        }
+    }
+
+  for (BinStore_t::const_iterator it = m_positive.begin ();
+       (it != m_positive.end ()) && !found; ++it)
+    {
+      cumulative += it->second;
+      if (static_cast<double> (cumulative) > rank)
+        {
+          ret = GetValue (it->first);
+          found = true;
+        }
+    }
+
+  // the exact extremes are known, so never report beyond them
+  return std::max (m_min, std::min (m_max, ret));
+}
+
+
+uint64_t
+SatQuantileSketch::GetCount () const
+{
+  return m_count;
+}
+
+
+double
+SatQuantileSketch::GetMin () const
+{
+  return (m_count == 0) ? NAN : m_min;
+}
+
+
+double
+SatQuantileSketch::GetMax () const
+{
+  return (m_count == 0) ? NAN : m_max;
+}
+
+
+double
+SatQuantileSketch::GetMean () const
+{
+  return (m_count == 0) ? NAN : m_sum / static_cast<double> (m_count);
+}
+
+
+double
+SatQuantileSketch::GetRelativeAccuracy () const
+{
+  return m_relativeAccuracy;
+}
+
+
+uint32_t
+SatQuantileSketch::GetNumBins () const
+{
+  return m_positive.size () + m_negative.size ();
+}
+
+
+void
+SatQuantileSketch::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_positive.clear ();
+  m_negative.clear ();
+  m_zeroCount = 0;
+  m_count = 0;
+  m_sum = 0.0;
+  m_min = std::numeric_limits<double>::infinity ();
+  m_max = -std::numeric_limits<double>::infinity ();
+}
+
+
+std::string
+SatQuantileSketch::Serialize () const
+{
+  std::ostringstream oss;
+  oss.precision (17);
+  oss << SAT_QUANTILE_SKETCH_TAG << " " << SAT_QUANTILE_SKETCH_VERSION
+      << " " << m_relativeAccuracy << " " << m_maxBins
+      << " " << m_count << " " << m_zeroCount << " " << m_sum;
+
+  if (m_count > 0)
+    {
+      oss << " " << m_min << " " << m_max;
+    }
+  else
+    {
+      oss << " 0 0";
+    }
+
+  oss << " " << m_negative.size ();
+  for (BinStore_t::const_iterator it = m_negative.begin ();
+       it != m_negative.end (); ++it)
+    {
+      oss << " " << it->first << " " << it->second;
+    }
+
+  oss << " " << m_positive.size ();
+  for (BinStore_t::const_iterator it = m_positive.begin ();
+       it != m_positive.end (); ++it)
+    {
+      oss << " " << it->first << " " << it->second;
+    }
+
+  return oss.str ();
+}
+
+
+bool
+SatQuantileSketch::Deserialize (const std::string &line)
+{
+  NS_LOG_FUNCTION (this << line);
+
+  std::istringstream iss (line);
+  std::string tag;
+  uint32_t version = 0;
+  double relativeAccuracy = 0.0;
+  uint32_t maxBins = 0;
+  uint64_t count = 0;
+  uint64_t zeroCount = 0;
+  double sum = 0.0;
+  double minValue = 0.0;
+  double maxValue = 0.0;
+
+  iss >> tag >> version >> relativeAccuracy >> maxBins
+      >> count >> zeroCount >> sum >> minValue >> maxValue;
+
+  if (iss.fail () || (tag != SAT_QUANTILE_SKETCH_TAG)
+      || (version != SAT_QUANTILE_SKETCH_VERSION)
+      || (relativeAccuracy <= 0.0) || (relativeAccuracy >= 1.0)
+      || (maxBins < 2))
+    {
+      NS_LOG_WARN (this << " unable to parse sketch: " << line);
+      Reset ();
+      return false;
+    }
+
+  SatQuantileSketch sketch (relativeAccuracy, maxBins);
+  BinStore_t * stores[2] = { &sketch.m_negative, &sketch.m_positive };
+  uint64_t binned = zeroCount;
+
+  for (uint32_t s = 0; s < 2; s++)
+    {
+      uint32_t n = 0;
+      iss >> n;
+
+      for (uint32_t i = 0; (i < n) && !iss.fail (); i++)
+        {
+          int32_t index = 0;
+          uint64_t c = 0;
+          iss >> index >> c;
+          (*stores[s])[index] += c;
+          binned += c;
+        }
+    }
+
+  if (iss.fail () || (binned != count))
+    {
+      NS_LOG_WARN (this << " corrupted sketch: " << line);
+      Reset ();
+      return false;
+    }
+
+  sketch.m_zeroCount = zeroCount;
+  sketch.m_count = count;
+  sketch.m_sum = sum;
+
+  if (count > 0)
+    {
+      sketch.m_min = minValue;
+      sketch.m_max = maxValue;
+    }
+
+  *this = sketch;
+  return true;
+}
+
+
+int32_t
+SatQuantileSketch::GetIndex (double absValue) const
+{
+  return static_cast<int32_t> (std::ceil (std::log (absValue) / m_logGamma));
+}
+
+
+double
+SatQuantileSketch::GetValue (int32_t index) const
+{
+  return 2.0 * std::exp (index * m_logGamma) / (m_gamma + 1.0);
+}
+
+
+void
+SatQuantileSketch::Collapse (BinStore_t &store, bool collapseHighest)
+{
+  while (store.size () > m_maxBins)
+    {
+      if (collapseHighest)
+        {
+          // fold the bucket farthest from zero into its neighbour
+          BinStore_t::iterator highest = store.end ();
+          --highest;
+          BinStore_t::iterator previous = highest;
+          --previous;
+          previous->second += highest->second;
+          store.erase (highest);
+        }
+      else
+        {
+          // fold the bucket closest to zero into its neighbour
+          BinStore_t::iterator lowest = store.begin ();
+          BinStore_t::iterator next = lowest;
+          ++next;
+          next->second += lowest->second;
+          store.erase (lowest);
+        }
+    }
+}
+
+
+} // end of namespace ns3
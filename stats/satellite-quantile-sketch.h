@@ -0,0 +1,180 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_QUANTILE_SKETCH_H
+#define SATELLITE_QUANTILE_SKETCH_H
+
+#include <stdint.h>
+#include <map>
+#include <string>
+
+
+namespace ns3 {
+
+/**
+ * \ingroup satstats
+ * \brief Streaming quantile sketch with relative accuracy guarantee.
+ *
+ * The sketch follows the DDSketch approach: every sample is mapped into a
+ * logarithmically sized bucket, so that any quantile returned by the sketch
+ * is within the configured relative accuracy of the true sample value.
+ * Positive and negative samples are kept in separate bucket stores and zero
+ * (or near-zero) samples in a dedicated counter, so the sketch can be used for
+ * both delay (positive) and SINR in dB (signed) samples.
+ *
+ * Memory is bounded by the maximum number of buckets per store. When the
+ * limit is exceeded, the buckets holding the lowest samples are collapsed
+ * together, i.e., the positive buckets closest to zero and the negative
+ * buckets farthest from zero. This degrades the accuracy of the lowest
+ * quantiles only, while the upper tail (p95, p99, p99.9) remains accurate.
+ *
+ * Two sketches created with the same relative accuracy and maximum number of
+ * buckets can be merged, e.g.,
+ * to combine per-UT sketches into a per-beam or global one, or to combine
+ * the sketches of several simulation runs. For the latter, the sketch can be
+ * converted into and restored from a single line of text.
+ */
+class SatQuantileSketch
+{
+public:
+  /**
+   * \brief Construct an empty sketch.
+   * \param relativeAccuracy the relative accuracy of the returned quantiles,
+   *                         must be within (0, 1)
+   * \param maxBins maximum number of buckets kept for each sign
+   */
+  SatQuantileSketch (double relativeAccuracy = 0.01, uint32_t maxBins = 2048);
+
+  /**
+   * \brief Add one sample into the sketch.
+   * \param value the sample
+   */
+  void Add (double value);
+
+  /**
+   * \brief Add the contents of another sketch into this sketch.
+   * \param other a sketch created with the same relative accuracy and
+   *              maximum number of buckets
+   * \return false if the sketches are not compatible, in which case this
+   *         sketch is left untouched
+   */
+  bool Merge (const SatQuantileSketch &other);
+
+  /**
+   * \brief Estimate a quantile of the samples added so far.
+   * \param q the quantile, within [0, 1], e.g., 0.99 for the 99th percentile
+   * \return the estimated quantile, or NaN if the sketch is empty
+   */
+  double GetQuantile (double q) const;
+
+  /**
+   * \return number of samples added so far
+   */
+  uint64_t GetCount () const;
+
+  /**
+   * \return the smallest sample added so far, or NaN if the sketch is empty
+   */
+  double GetMin () const;
+
+  /**
+   * \return the largest sample added so far, or NaN if the sketch is empty
+   */
+  double GetMax () const;
+
+  /**
+   * \return the mean of the samples added so far, or NaN if the sketch is empty
+   */
+  double GetMean () const;
+
+  /**
+   * \return the relative accuracy of this sketch
+   */
+  double GetRelativeAccuracy () const;
+
+  /**
+   * \return number of buckets currently in use
+   */
+  uint32_t GetNumBins () const;
+
+  /**
+   * \brief Remove all samples from the sketch.
+   */
+  void Reset ();
+
+  /**
+   * \brief Convert the complete state of the sketch into a single line of
+   *        text.
+   * \return the serialized sketch
+   */
+  std::string Serialize () const;
+
+  /**
+   * \brief Restore a sketch from a line created by Serialize().
+   * \param line the serialized sketch
+   * \return false if the line could not be parsed, in which case the sketch
+   *         is left empty
+   */
+  bool Deserialize (const std::string &line);
+
+private:
+  /// Bucket index to sample count.
+  typedef std::map<int32_t, uint64_t> BinStore_t;
+
+  /**
+   * \param absValue absolute value of a sample, above #m_minIndexable
+   * \return the index of the bucket holding the value
+   */
+  int32_t GetIndex (double absValue) const;
+
+  /**
+   * \param index bucket index
+   * \return representative absolute value of the bucket
+   */
+  double GetValue (int32_t index) const;
+
+  /**
+   * \brief Collapse the buckets of the lowest samples of a store until it
+   *        fits in #m_maxBins buckets.
+   * \param store the bucket store
+   * \param collapseHighest true to collapse the buckets with the highest
+   *        indices, i.e., for the store of negative samples
+   */
+  void Collapse (BinStore_t &store, bool collapseHighest);
+
+  double      m_relativeAccuracy;  ///< Relative accuracy of the sketch.
+  uint32_t    m_maxBins;           ///< Maximum number of buckets per store.
+  double      m_gamma;             ///< Bucket growth factor.
+  double      m_logGamma;          ///< Natural logarithm of #m_gamma.
+  double      m_minIndexable;      ///< Smallest absolute value with its own bucket.
+  BinStore_t  m_positive;          ///< Buckets of positive samples.
+  BinStore_t  m_negative;          ///< Buckets of negative samples (by magnitude).
+  uint64_t    m_zeroCount;         ///< Number of zero (or near-zero) samples.
+  uint64_t    m_count;             ///< Total number of samples.
+  double      m_sum;               ///< Sum of all samples.
+  double      m_min;               ///< Smallest sample.
+  double      m_max;               ///< Largest sample.
+
+}; // end of class SatQuantileSketch
+
+
+} // end of namespace ns3
+
+
+#endif /* SATELLITE_QUANTILE_SKETCH_H */
@@ -44,6 +44,7 @@
 #include <ns3/unit-conversion-collector.h>
 #include <ns3/distribution-collector.h>
 #include <ns3/scalar-collector.h>
+#include <ns3/satellite-quantile-collector.h>
 #include <ns3/multi-file-aggregator.h>
 #include <ns3/magister-gnuplot-aggregator.h>
 
@@ -166,6 +167,20 @@ SatStatsCompositeSinrHelper::DoInstall ()
         break;
       }
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      {
+        // Setup aggregator.
+        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
+                                         "OutputFileName", StringValue (GetOutputFileName ()),
+                                         "GeneralHeading", StringValue (GetQuantileHeading ("sinr_db")));
+
+        // Setup collectors.
+        m_terminalCollectors.SetType ("ns3::SatQuantileCollector");
+        CreateCollectorPerIdentifier (m_terminalCollectors);
+        SetupQuantileCollectors (m_terminalCollectors, m_aggregator);
+        break;
+      }
+
     case SatStatsHelper::OUTPUT_SCALAR_PLOT:
       /// \todo Add support for boxes in Gnuplot.
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
@@ -360,6 +375,13 @@ SatStatsFwdCompositeSinrHelper::DoInstallProbes ()
                                                                &DistributionCollector::TraceSinkDouble);
                   break;
 
+                case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+                  ret = m_terminalCollectors.ConnectWithProbe (probe->GetObject<Probe> (),
+                                                               "OutputSinr",
+                                                               identifier,
+                                                               &SatQuantileCollector::TraceSinkDouble);
+                  break;
+
                 default:
                   NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
                   break;
@@ -550,6 +572,14 @@ SatStatsRtnCompositeSinrHelper::SinrCallback (double sinrDb, const Address &from
                 break;
               }
 
+            case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+              {
+                Ptr<SatQuantileCollector> c = collector->GetObject<SatQuantileCollector> ();
+                NS_ASSERT (c != 0);
+                c->TraceSinkDouble (0.0, sinrDb);
+                break;
+              }
+
             default:
               NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
               break;
@@ -47,6 +47,7 @@
 #include <ns3/unit-conversion-collector.h>
 #include <ns3/distribution-collector.h>
 #include <ns3/scalar-collector.h>
+#include <ns3/satellite-quantile-collector.h>
 #include <ns3/multi-file-aggregator.h>
 #include <ns3/magister-gnuplot-aggregator.h>
 #include <ns3/traffic-time-tag.h>
@@ -248,6 +249,20 @@ SatStatsDelayHelper::DoInstall ()
         break;
       }
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      {
+        // Setup aggregator.
+        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
+                                         "OutputFileName", StringValue (GetOutputFileName ()),
+                                         "GeneralHeading", StringValue (GetQuantileHeading ("delay_sec")));
+
+        // Setup collectors.
+        m_terminalCollectors.SetType ("ns3::SatQuantileCollector");
+        CreateCollectorPerIdentifier (m_terminalCollectors);
+        SetupQuantileCollectors (m_terminalCollectors, m_aggregator);
+        break;
+      }
+
     case SatStatsHelper::OUTPUT_SCALAR_PLOT:
       /// \todo Add support for boxes in Gnuplot.
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
@@ -502,6 +517,13 @@ SatStatsDelayHelper::ConnectProbeToCollector (Ptr<Probe> probe,
         }
       break;
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      ret = m_terminalCollectors.ConnectWithProbe (probe,
+                                                   "OutputSeconds",
+                                                   identifier,
+                                                   &SatQuantileCollector::TraceSinkDouble);
+      break;
+
     default:
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
       break;
@@ -571,6 +593,14 @@ SatStatsDelayHelper::PassSampleToCollector (const Time &delay, uint32_t identifi
         }
       break;
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      {
+        Ptr<SatQuantileCollector> c = collector->GetObject<SatQuantileCollector> ();
+        NS_ASSERT (c != 0);
+        c->TraceSinkDouble (0.0, delay.GetSeconds ());
+        break;
+      }
+
     default:
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
       break;
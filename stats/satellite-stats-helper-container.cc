@@ -108,6 +108,19 @@ SatStatsHelperContainer::DoDispose ()
                    SatStatsHelper::OUTPUT_PDF_PLOT,       "PDF_PLOT",         \
                    SatStatsHelper::OUTPUT_CDF_PLOT,       "CDF_PLOT"))
 
+#define ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER                                 \
+  MakeEnumChecker (SatStatsHelper::OUTPUT_NONE,           "NONE",             \
+                   SatStatsHelper::OUTPUT_SCALAR_FILE,    "SCALAR_FILE",      \
+                   SatStatsHelper::OUTPUT_SCATTER_FILE,   "SCATTER_FILE",     \
+                   SatStatsHelper::OUTPUT_HISTOGRAM_FILE, "HISTOGRAM_FILE",   \
+                   SatStatsHelper::OUTPUT_PDF_FILE,       "PDF_FILE",         \
+                   SatStatsHelper::OUTPUT_CDF_FILE,       "CDF_FILE",         \
+                   SatStatsHelper::OUTPUT_SCATTER_PLOT,   "SCATTER_PLOT",     \
+                   SatStatsHelper::OUTPUT_HISTOGRAM_PLOT, "HISTOGRAM_PLOT",   \
+                   SatStatsHelper::OUTPUT_PDF_PLOT,       "PDF_PLOT",         \
+                   SatStatsHelper::OUTPUT_CDF_PLOT,       "CDF_PLOT",         \
+                   SatStatsHelper::OUTPUT_QUANTILE_FILE,  "QUANTILE_FILE"))
+
 #define ADD_SAT_STATS_AVERAGED_DISTRIBUTION_OUTPUT_CHECKER                    \
   MakeEnumChecker (SatStatsHelper::OUTPUT_NONE,           "NONE",             \
                    SatStatsHelper::OUTPUT_HISTOGRAM_FILE, "HISTOGRAM_FILE",   \
@@ -151,6 +164,20 @@ SatStatsHelperContainer::DoDispose ()
                                 std::string ("per UT ") + desc)               \
   ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
 
+#define ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET(id, desc)                       \
+  ADD_SAT_STATS_ATTRIBUTE_HEAD (Global ## id,                                 \
+                                std::string ("global ") + desc)               \
+  ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER                                       \
+  ADD_SAT_STATS_ATTRIBUTE_HEAD (PerGw ## id,                                  \
+                                std::string ("per GW ") + desc)               \
+  ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER                                       \
+  ADD_SAT_STATS_ATTRIBUTE_HEAD (PerBeam ## id,                                \
+                                std::string ("per beam ") + desc)             \
+  ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER                                       \
+  ADD_SAT_STATS_ATTRIBUTE_HEAD (PerUt ## id,                                  \
+                                std::string ("per UT ") + desc)               \
+  ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
+
 #define ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET(id, desc)          \
   ADD_SAT_STATS_ATTRIBUTE_HEAD (AverageBeam ## id,                            \
                                 std::string ("average beam ") + desc)         \
@@ -173,11 +200,11 @@ SatStatsHelperContainer::GetTypeId ()
                    MakeStringChecker ())
 
     // Forward link application-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (FwdAppDelay,
-                                               "forward link application-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (FwdAppDelay,
+                                           "forward link application-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTE_HEAD (PerUtUserFwdAppDelay,
                                   "per UT user forward link application-level delay statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (FwdAppDelay,
                                                         "forward link application-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTE_HEAD (AverageUtUserFwdAppDelay,
@@ -185,20 +212,20 @@ SatStatsHelperContainer::GetTypeId ()
     ADD_SAT_STATS_AVERAGED_DISTRIBUTION_OUTPUT_CHECKER
 
     // Forward link device-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (FwdDevDelay,
-                                               "forward link device-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (FwdDevDelay,
+                                           "forward link device-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (FwdDevDelay,
                                                         "forward link device-level delay statistics")
 
     // Forward link MAC-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (FwdMacDelay,
-                                               "forward link MAC-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (FwdMacDelay,
+                                           "forward link MAC-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (FwdMacDelay,
                                                         "forward link MAC-level delay statistics")
 
     // Forward link PHY-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (FwdPhyDelay,
-                                               "forward link PHY-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (FwdPhyDelay,
+                                           "forward link PHY-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (FwdPhyDelay,
                                                         "forward link PHY-level delay statistics")
 
@@ -215,8 +242,8 @@ SatStatsHelperContainer::GetTypeId ()
                                         "forward link signalling load statistics")
 
     // Forward link composite SINR statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (FwdCompositeSinr,
-                                               "forward link composite SINR statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (FwdCompositeSinr,
+                                           "forward link composite SINR statistics")
 
     // Forward link application-level throughput statistics.
     ADD_SAT_STATS_ATTRIBUTES_BASIC_SET (FwdAppThroughput,
@@ -249,11 +276,11 @@ SatStatsHelperContainer::GetTypeId ()
                                                         "forward link PHY-level throughput statistics")
 
     // Return link application-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (RtnAppDelay,
-                                               "return link application-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (RtnAppDelay,
+                                           "return link application-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTE_HEAD (PerUtUserRtnAppDelay,
                                   "per UT user return link application-level delay statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (RtnAppDelay,
                                                         "return link application-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTE_HEAD (AverageUtUserRtnAppDelay,
@@ -261,20 +288,20 @@ SatStatsHelperContainer::GetTypeId ()
     ADD_SAT_STATS_AVERAGED_DISTRIBUTION_OUTPUT_CHECKER
 
     // Return link device-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (RtnDevDelay,
-                                               "return link device-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (RtnDevDelay,
+                                           "return link device-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (RtnDevDelay,
                                                         "return link device-level delay statistics")
 
     // Return link MAC-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (RtnMacDelay,
-                                               "return link MAC-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (RtnMacDelay,
+                                           "return link MAC-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (RtnMacDelay,
                                                         "return link MAC-level delay statistics")
 
     // Return link PHY-level packet delay statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (RtnPhyDelay,
-                                               "return link PHY-level delay statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (RtnPhyDelay,
+                                           "return link PHY-level delay statistics")
     ADD_SAT_STATS_ATTRIBUTES_AVERAGED_DISTRIBUTION_SET (RtnPhyDelay,
                                                         "return link PHY-level delay statistics")
 
@@ -291,8 +318,8 @@ SatStatsHelperContainer::GetTypeId ()
                                         "return link signalling load statistics")
 
     // Return link composite SINR statistics.
-    ADD_SAT_STATS_ATTRIBUTES_DISTRIBUTION_SET (RtnCompositeSinr,
-                                               "return link composite SINR statistics")
+    ADD_SAT_STATS_ATTRIBUTES_QUANTILE_SET (RtnCompositeSinr,
+                                           "return link composite SINR statistics")
 
     // Return link application-level throughput statistics.
     ADD_SAT_STATS_ATTRIBUTES_BASIC_SET (RtnAppThroughput,
@@ -427,16 +454,16 @@ SatStatsHelperContainer::GetTypeId ()
     // Link SINR statistics.
     ADD_SAT_STATS_ATTRIBUTE_HEAD (GlobalFwdFeederLinkSinr,
                                   "global forward feeder link SINR statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
     ADD_SAT_STATS_ATTRIBUTE_HEAD (GlobalFwdUserLinkSinr,
                                   "global forward user link SINR statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
     ADD_SAT_STATS_ATTRIBUTE_HEAD (GlobalRtnFeederLinkSinr,
                                   "global return feeder link SINR statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
     ADD_SAT_STATS_ATTRIBUTE_HEAD (GlobalRtnUserLinkSinr,
                                   "global return user link SINR statistics")
-    ADD_SAT_STATS_DISTRIBUTION_OUTPUT_CHECKER
+    ADD_SAT_STATS_QUANTILE_OUTPUT_CHECKER
 
     // Link Rx power statistics.
     ADD_SAT_STATS_ATTRIBUTE_HEAD (GlobalFwdFeederLinkRxPower,
@@ -947,6 +974,9 @@ SatStatsHelperContainer::GetOutputTypeSuffix (SatStatsHelper::OutputType_t outpu
   case SatStatsHelper::OUTPUT_CDF_PLOT:
     return "-cdf";
 
+  case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+    return "-quantile";
+
   default:
     NS_FATAL_ERROR ("SatStatsHelperContainer - Invalid output type");
     break;
@@ -31,6 +31,8 @@
 #include <ns3/node-container.h>
 #include <ns3/collector-map.h>
 #include <ns3/data-collection-object.h>
+#include <ns3/multi-file-aggregator.h>
+#include <ns3/satellite-quantile-collector.h>
 #include <ns3/log.h>
 #include <ns3/type-id.h>
 #include <ns3/object-factory.h>
@@ -97,6 +99,8 @@ SatStatsHelper::GetOutputTypeName (SatStatsHelper::OutputType_t outputType)
       return "OUTPUT_PDF_PLOT";
     case SatStatsHelper::OUTPUT_CDF_PLOT:
       return "OUTPUT_CDF_PLOT";
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      return "OUTPUT_QUANTILE_FILE";
     default:
       NS_FATAL_ERROR ("SatStatsHelper - Invalid output type");
       break;
@@ -112,7 +116,8 @@ SatStatsHelper::SatStatsHelper (Ptr<const SatHelper> satHelper)
     m_identifierType (SatStatsHelper::IDENTIFIER_GLOBAL),
     m_outputType (SatStatsHelper::OUTPUT_SCATTER_FILE),
     m_isInstalled (false),
-    m_satHelper (satHelper)
+    m_satHelper (satHelper),
+    m_globalQuantileCollector (0)
 {
   NS_LOG_FUNCTION (this << satHelper);
 }
@@ -159,7 +164,8 @@ SatStatsHelper::GetTypeId ()
                                     SatStatsHelper::OUTPUT_SCATTER_PLOT,   "SCATTER_PLOT",
                                     SatStatsHelper::OUTPUT_HISTOGRAM_PLOT, "HISTOGRAM_PLOT",
                                     SatStatsHelper::OUTPUT_PDF_PLOT,       "PDF_PLOT",
-                                    SatStatsHelper::OUTPUT_CDF_PLOT,       "CDF_PLOT"))
+                                    SatStatsHelper::OUTPUT_CDF_PLOT,       "CDF_PLOT",
+                                    SatStatsHelper::OUTPUT_QUANTILE_FILE,  "QUANTILE_FILE"))
   ;
   return tid;
 }
@@ -385,6 +391,54 @@ SatStatsHelper::CreateCollectorPerIdentifier (CollectorMap &collectorMap) const
 } // end of `uint32_t CreateCollectorPerIdentifier (CollectorMap &);`
 
 
+void
+SatStatsHelper::SetupQuantileCollectors (CollectorMap &collectorMap,
+                                         Ptr<DataCollectionObject> aggregator)
+{
+  NS_LOG_FUNCTION (this << aggregator);
+
+  Ptr<MultiFileAggregator> fileAggregator = aggregator->GetObject<MultiFileAggregator> ();
+  NS_ASSERT (fileAggregator != 0);
+
+  collectorMap.ConnectToAggregator ("Output",
+                                    aggregator,
+                                    &MultiFileAggregator::Write2d);
+  collectorMap.ConnectToAggregator ("OutputString",
+                                    aggregator,
+                                    &MultiFileAggregator::AddContextHeading);
+
+  if (GetIdentifierType () != SatStatsHelper::IDENTIFIER_GLOBAL)
+    {
+      // Setup the collector of the global percentiles.
+      m_globalQuantileCollector = CreateObject<SatQuantileCollector> ();
+      m_globalQuantileCollector->SetName ("global");
+      m_globalQuantileCollector->SetSketchFileName (GetOutputFileName ()
+                                                    + "-sketch-global.txt");
+      m_globalQuantileCollector->TraceConnect ("Output", "global",
+                                               MakeCallback (&MultiFileAggregator::Write2d,
+                                                             fileAggregator));
+      m_globalQuantileCollector->TraceConnect ("OutputString", "global",
+                                               MakeCallback (&MultiFileAggregator::AddContextHeading,
+                                                             fileAggregator));
+    }
+
+  for (CollectorMap::Iterator it = collectorMap.Begin ();
+       it != collectorMap.End (); ++it)
+    {
+      Ptr<SatQuantileCollector> c = it->second->GetObject<SatQuantileCollector> ();
+      NS_ASSERT (c != 0);
+      c->SetSketchFileName (GetOutputFileName () + "-sketch-"
+                            + it->second->GetName () + ".txt");
+
+      if (m_globalQuantileCollector != 0)
+        {
+          c->SetAggregateCollector (m_globalQuantileCollector);
+        }
+    }
+
+} // end of `void SetupQuantileCollectors (CollectorMap &, Ptr<DataCollectionObject>);`
+
+
 std::string
 SatStatsHelper::GetOutputPath () const
 {
@@ -441,6 +495,13 @@ SatStatsHelper::GetDistributionHeading (std::string dataLabel) const
 }
 
 
+std::string
+SatStatsHelper::GetQuantileHeading (std::string dataLabel) const
+{
+  return "% percentile " + dataLabel;
+}
+
+
 // IDENTIFIER RELATED METHODS /////////////////////////////////////////////////
 
 uint32_t
@@ -36,6 +36,7 @@ class SatHelper;
 class Node;
 class CollectorMap;
 class DataCollectionObject;
+class SatQuantileCollector;
 
 /**
  * \ingroup satellite
@@ -125,6 +126,7 @@ public:
     OUTPUT_HISTOGRAM_PLOT,
     OUTPUT_PDF_PLOT,        // probability distribution function
     OUTPUT_CDF_PLOT,        // cumulative distribution function
+    OUTPUT_QUANTILE_FILE,   // percentiles from a streaming quantile sketch
   } OutputType_t;
 
   /**
@@ -257,6 +259,13 @@ protected:
    */
   virtual std::string GetDistributionHeading (std::string dataLabel) const;
 
+  /**
+   * \param dataLabel the short name of the main data of this statistics
+   * \return a string to be printed as the first line of output, consisting of
+   *         the title of the percentile column and the given data label
+   */
+  virtual std::string GetQuantileHeading (std::string dataLabel) const;
+
   /**
    * \brief Create the aggregator according to the output type.
    * \param aggregatorTypeId the type of aggregator to be created.
@@ -298,6 +307,22 @@ protected:
    */
   uint32_t CreateCollectorPerIdentifier (CollectorMap &collectorMap) const;
 
+  /**
+   * \brief Connect the SatQuantileCollector instances of a collector map to a
+   *        MultiFileAggregator and prepare the global percentiles.
+   * \param collectorMap the CollectorMap holding one SatQuantileCollector for
+   *                     each identifier.
+   * \param aggregator a MultiFileAggregator receiving the percentiles.
+   *
+   * Each collector is set to write its sketch into a separate file next to
+   * the percentile output, so that the sketches of several runs can be
+   * merged afterwards. If the identifier type is other than global, an
+   * additional collector named `global` receives every sample of the
+   * per-identifier collectors and reports the global percentiles.
+   */
+  void SetupQuantileCollectors (CollectorMap &collectorMap,
+                                Ptr<DataCollectionObject> aggregator);
+
   // IDENTIFIER RELATED METHODS ///////////////////////////////////////////////
 
   /**
@@ -367,6 +392,9 @@ private:
   bool                  m_isInstalled;     ///<
   Ptr<const SatHelper>  m_satHelper;       ///<
 
+  /// Global percentiles collector for `OUTPUT_QUANTILE_FILE` output type.
+  Ptr<SatQuantileCollector> m_globalQuantileCollector;
+
 }; // end of class SatStatsHelper
 
 
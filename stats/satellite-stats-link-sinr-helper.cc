@@ -37,6 +37,7 @@
 #include <ns3/unit-conversion-collector.h>
 #include <ns3/distribution-collector.h>
 #include <ns3/scalar-collector.h>
+#include <ns3/satellite-quantile-collector.h>
 #include <ns3/multi-file-aggregator.h>
 #include <ns3/magister-gnuplot-aggregator.h>
 
@@ -112,6 +113,14 @@ SatStatsLinkSinrHelper::SinrCallback (double sinrDb)
         break;
       }
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      {
+        Ptr<SatQuantileCollector> c = m_collector->GetObject<SatQuantileCollector> ();
+        NS_ASSERT (c != 0);
+        c->TraceSinkDouble (0.0, sinrDb);
+        break;
+      }
+
     default:
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
       break;
@@ -221,6 +230,29 @@ SatStatsLinkSinrHelper::DoInstall ()
         break;
       }
 
+    case SatStatsHelper::OUTPUT_QUANTILE_FILE:
+      {
+        // Setup aggregator.
+        m_aggregator = CreateAggregator ("ns3::MultiFileAggregator",
+                                         "OutputFileName", StringValue (GetOutputFileName ()),
+                                         "GeneralHeading", StringValue (GetQuantileHeading ("sinr_db")));
+        Ptr<MultiFileAggregator> aggregator = m_aggregator->GetObject<MultiFileAggregator> ();
+
+        // Setup collector.
+        Ptr<SatQuantileCollector> collector = CreateObject<SatQuantileCollector> ();
+        collector->SetName ("0");
+        collector->SetSketchFileName (GetOutputFileName () + "-sketch-0.txt");
+        collector->TraceConnect ("Output", "0",
+                                 MakeCallback (&MultiFileAggregator::Write2d,
+                                               aggregator));
+        collector->TraceConnect ("OutputString", "0",
+                                 MakeCallback (&MultiFileAggregator::AddContextHeading,
+                                               aggregator));
+        m_collector = collector->GetObject<DataCollectionObject> ();
+
+        break;
+      }
+
     case SatStatsHelper::OUTPUT_SCALAR_PLOT:
       /// \todo Add support for boxes in Gnuplot.
       NS_FATAL_ERROR (GetOutputTypeName (GetOutputType ()) << " is not a valid output type for this statistics.");
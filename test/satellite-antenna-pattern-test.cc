@@ -21,6 +21,7 @@
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/simulator.h"
+#include "ns3/double.h"
 #include "../model/satellite-antenna-gain-pattern.h"
 #include "../model/satellite-antenna-gain-pattern-container.h"
 #include "ns3/singleton.h"
@@ -117,6 +118,20 @@ SatAntennaPatternTestCase::DoRun (void)
       NS_TEST_ASSERT_MSG_EQ ( bestBeamId, expectedBeamIds[i], "Not expected best spot-beam id");
     }
 
+  // Random positions are drawn from the grid squares with valid positions in
+  // all the corners, so their gains shall be at least the minimum acceptable gain
+  Ptr<SatAntennaGainPattern> gainPattern = gpContainer.GetAntennaGainPattern (expectedBeamIds[0]);
+  DoubleValue minGain_dB;
+  gainPattern->GetAttribute ("MinAcceptableAntennaGainDb", minGain_dB);
+
+  for ( uint32_t i = 0; i < 1000; ++i)
+    {
+      GeoCoordinate position = gainPattern->GetValidRandomPosition ();
+      gain = gainPattern->GetAntennaGain_lin (position);
+
+      NS_TEST_ASSERT_MSG_GT ( 10.0 * log10 (gain), minGain_dB.Get () - 0.001, "Random position gain under minimum acceptable gain");
+    }
+
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-beam-interference-matrix-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the beam interference matrix.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "../model/satellite-antenna-gain-pattern-container.h"
+#include "../model/satellite-constant-position-mobility-model.h"
+#include "../model/satellite-propagation-delay-model.h"
+#include "../model/satellite-beam-interference-matrix.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the beam interference matrix.
+ *
+ *  1.  Create the matrix and add three beams with their antenna patterns.
+ *  2.  Check the interference gains and reference delays.
+ *  3.  Notify the matrix of transmissions of the beams.
+ *  4.  Calculate the interference-to-carrier ratio for beam 1.
+ *
+ *  Expected result:
+ *    Interference gains between different beams are below one and the
+ *    reference delays equal the constant propagation delay. The ratio is the
+ *    sum of the interference gains weighted by the mean transmit powers of the
+ *    interfering beams during the reception, divided by the own transmit power.
+ */
+class SatBeamInterferenceMatrixTestCase : public TestCase
+{
+public:
+  SatBeamInterferenceMatrixTestCase ();
+  virtual ~SatBeamInterferenceMatrixTestCase ();
+
+  // notifies the matrix of a transmission
+  void Transmit (uint32_t beamId, Time duration, double txPower);
+
+  // calculates interference-to-carrier ratio of beam 1
+  void Calculate (Time start, Time end);
+
+private:
+  virtual void DoRun (void);
+  Ptr<SatBeamInterferenceMatrix> m_matrix;
+  double m_ciRatio;
+};
+
+SatBeamInterferenceMatrixTestCase::SatBeamInterferenceMatrixTestCase ()
+  : TestCase ("Test beam interference matrix."),
+    m_ciRatio (0.0)
+{
+}
+
+SatBeamInterferenceMatrixTestCase::~SatBeamInterferenceMatrixTestCase ()
+{
+}
+
+void
+SatBeamInterferenceMatrixTestCase::Transmit (uint32_t beamId, Time duration, double txPower)
+{
+  m_matrix->NotifyTx (beamId, 0, duration, txPower);
+}
+
+void
+SatBeamInterferenceMatrixTestCase::Calculate (Time start, Time end)
+{
+  m_ciRatio = m_matrix->GetInterferenceToCarrierRatio (1, 0, start, end);
+}
+
+void
+SatBeamInterferenceMatrixTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-beam-interference-matrix", "", true);
+
+  Ptr<SatAntennaGainPatternContainer> gpContainer = CreateObject<SatAntennaGainPatternContainer> ();
+
+  Ptr<SatConstantPositionMobilityModel> satMobility = CreateObject<SatConstantPositionMobilityModel> ();
+  satMobility->SetGeoPosition (GeoCoordinate (0.00, 33.00, 35786000.00));
+
+  Ptr<SatConstantPropagationDelayModel> delayModel = CreateObject<SatConstantPropagationDelayModel> ();
+  delayModel->SetDelay (Seconds (0.13));
+
+  m_matrix = CreateObject<SatBeamInterferenceMatrix> (delayModel, satMobility);
+
+  m_matrix->AddBeam (1, gpContainer->GetAntennaGainPattern (1));
+  m_matrix->AddBeam (2, gpContainer->GetAntennaGainPattern (2));
+  m_matrix->AddBeam (3, gpContainer->GetAntennaGainPattern (3));
+
+  NS_TEST_ASSERT_MSG_EQ (m_matrix->HasBeam (2), true, "Beam not found");
+  NS_TEST_ASSERT_MSG_EQ (m_matrix->HasBeam (4), false, "Beam found");
+  NS_TEST_ASSERT_MSG_EQ (m_matrix->GetReferenceDelay (3), Seconds (0.13), "Reference delay incorrect");
+
+  double gain12 = m_matrix->GetInterferenceGain (1, 2);
+  double gain13 = m_matrix->GetInterferenceGain (1, 3);
+
+  NS_TEST_ASSERT_MSG_EQ (m_matrix->GetInterferenceGain (1, 1), 0.0, "Own interference gain incorrect");
+  NS_TEST_ASSERT_MSG_GT (gain12, 0.0, "Interference gain incorrect");
+  NS_TEST_ASSERT_MSG_LT (gain12, 1.0, "Interference gain incorrect");
+  NS_TEST_ASSERT_MSG_GT (m_matrix->GetInterferenceGain (2, 1), 0.0, "Interference gain incorrect");
+  NS_TEST_ASSERT_MSG_LT (m_matrix->GetInterferenceGain (3, 2), 1.0, "Interference gain incorrect");
+
+  // Beam 1 transmits 10 ms with 10 W ending at 20 ms, beam 2 transmits 10 ms
+  // with 4 W ending at 15 ms, and beam 3 transmits 2 ms with 5 W ending at 30 ms
+  Simulator::Schedule (MilliSeconds (15), &SatBeamInterferenceMatrixTestCase::Transmit, this, 2, MilliSeconds (10), 4.0);
+  Simulator::Schedule (MilliSeconds (20), &SatBeamInterferenceMatrixTestCase::Transmit, this, 1, MilliSeconds (10), 10.0);
+  Simulator::Schedule (MilliSeconds (30), &SatBeamInterferenceMatrixTestCase::Transmit, this, 3, MilliSeconds (2), 5.0);
+  Simulator::Schedule (MilliSeconds (40), &SatBeamInterferenceMatrixTestCase::Calculate, this, MilliSeconds (10), MilliSeconds (20));
+
+  Simulator::Run ();
+
+  // beam 2 overlaps half of the reception and beam 3 does not overlap at all
+  double expected = gain12 * 4.0 * 0.5 / 10.0;
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_ciRatio, expected, expected * 1e-9, "Interference-to-carrier ratio incorrect");
+  NS_TEST_ASSERT_MSG_GT (gain13, 0.0, "Interference gain incorrect");
+
+  m_matrix = NULL;
+
+  Simulator::Destroy ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the beam interference matrix.
+ */
+class SatBeamInterferenceMatrixTestSuite : public TestSuite
+{
+public:
+  SatBeamInterferenceMatrixTestSuite ();
+};
+
+SatBeamInterferenceMatrixTestSuite::SatBeamInterferenceMatrixTestSuite ()
+  : TestSuite ("sat-beam-interference-matrix-unit-test", UNIT)
+{
+  AddTestCase (new SatBeamInterferenceMatrixTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatBeamInterferenceMatrixTestSuite satBeamInterferenceMatrixUnit;
@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-bent-pipe-test.cc
+ * \ingroup satellite
+ * \brief Test case to check the reception and delivery times of the bursts
+ *        in the bent pipe mode of the channel.
+ */
+
+#include <set>
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
+#include "ns3/cbr-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "../helper/satellite-helper.h"
+#include "ns3/singleton.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the reception times of the bursts at the
+ *        satellite and their delivery times in the bent pipe mode of the
+ *        channel.
+ *
+ *  1.  Create a scenario with two beams and two UTs per beam, the bent pipe
+ *      mode enabled and a constant propagation delay. The GW user sends CBR
+ *      traffic to each UT user and each UT user to the GW user.
+ *  2.  Collect the PHY transmission times of the UTs and the GW, the times
+ *      of the uplink SINRs calculated at the satellite and the PHY delays of
+ *      the packets received by the UTs and the GW.
+ *
+ *  Expected result:
+ *    The satellite receives each burst at once when it arrives, i.e. one
+ *    propagation delay after a transmission of a UT or the GW. The packets
+ *    are delivered after both propagation delays and the burst duration,
+ *    which is shorter than the propagation delay.
+ */
+class SatBentPipeTestCase : public TestCase
+{
+public:
+  SatBentPipeTestCase ();
+  virtual ~SatBentPipeTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                      SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                      SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo);
+  void SatelliteSinrCb (double sinrDb);
+  void RxDelayCb (const Time &delay, const Address &address);
+
+  Time m_propagationDelay;
+  std::set<Time> m_txTimes;
+  uint32_t m_satelliteRxCount;
+  uint32_t m_earlySatelliteRxCount;
+  uint32_t m_delayedSatelliteRxCount;
+  uint32_t m_rxCount;
+  uint32_t m_invalidRxDelayCount;
+};
+
+SatBentPipeTestCase::SatBentPipeTestCase ()
+  : TestCase ("Test reception and delivery times of the bursts in the bent pipe mode of the channel."),
+    m_propagationDelay (MilliSeconds (130)),
+    m_satelliteRxCount (0),
+    m_earlySatelliteRxCount (0),
+    m_delayedSatelliteRxCount (0),
+    m_rxCount (0),
+    m_invalidRxDelayCount (0)
+{
+}
+
+SatBentPipeTestCase::~SatBentPipeTestCase ()
+{
+}
+
+void
+SatBentPipeTestCase::PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                                    SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                                    SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo)
+{
+  if (eventType == SatEnums::PACKET_SENT && (nodeType == SatEnums::NT_UT || nodeType == SatEnums::NT_GW))
+    {
+      m_txTimes.insert (now);
+    }
+}
+
+void
+SatBentPipeTestCase::SatelliteSinrCb (double sinrDb)
+{
+  m_satelliteRxCount++;
+
+  // the reception started at the arrival of the burst, i.e. one propagation delay after its transmission
+  Time txTime = Simulator::Now () - m_propagationDelay;
+
+  if (txTime < Seconds (0))
+    {
+      m_earlySatelliteRxCount++;
+    }
+  else if (m_txTimes.find (txTime) == m_txTimes.end ())
+    {
+      m_delayedSatelliteRxCount++;
+    }
+}
+
+void
+SatBentPipeTestCase::RxDelayCb (const Time &delay, const Address &address)
+{
+  m_rxCount++;
+
+  // the delay contains both propagation delays and the burst duration
+  Time burstDuration = delay - m_propagationDelay - m_propagationDelay;
+
+  if (burstDuration <= Seconds (0) || burstDuration >= m_propagationDelay)
+    {
+      m_invalidRxDelayCount++;
+    }
+}
+
+void
+SatBentPipeTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-bent-pipe", "bent-pipe", true);
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+
+  Config::SetDefault ("ns3::SatChannel::EnableBentPipe", BooleanValue (true));
+  Config::SetDefault ("ns3::SatBeamHelper::PropagationDelayModel", EnumValue (SatEnums::PD_CONSTANT));
+  Config::SetDefault ("ns3::SatBeamHelper::ConstantPropagationDelay", TimeValue (m_propagationDelay));
+  Config::SetDefault ("ns3::SatPhy::EnableStatisticsTags", BooleanValue (true));
+
+  // the bent pipe mode requires an interference model not using the Rx powers at the satellite
+  Config::SetDefault ("ns3::SatGeoHelper::DaFwdLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_CONSTANT));
+  Config::SetDefault ("ns3::SatGeoHelper::DaRtnLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_CONSTANT));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[1] = SatBeamUserInfo (2, 1);
+  beamMap[2] = SatBeamUserInfo (2, 1);
+  helper->CreateUserDefinedScenario (beamMap);
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PacketTrace",
+                   MakeCallback (&SatBentPipeTestCase::PacketTraceCb, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/RxDelay",
+                   MakeCallback (&SatBentPipeTestCase::RxDelayCb, this));
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::SatGeoNetDevice/UserPhy/*/PhyRx/RxCarrierList/*/LinkSinr",
+                                 MakeCallback (&SatBentPipeTestCase::SatelliteSinrCb, this));
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::SatGeoNetDevice/FeederPhy/*/PhyRx/RxCarrierList/*/LinkSinr",
+                                 MakeCallback (&SatBentPipeTestCase::SatelliteSinrCb, this));
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9;
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  ApplicationContainer sinkApps = sink.Install (gwUsers.Get (0));
+
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("5ms"));
+  cbr.SetAttribute ("PacketSize", UintegerValue (512));
+  ApplicationContainer cbrApps = cbr.Install (utUsers);
+
+  for (uint32_t i = 0; i < utUsers.GetN (); i++)
+    {
+      sink.SetAttribute ("Local", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      sinkApps.Add (sink.Install (utUsers.Get (i)));
+
+      cbr.SetAttribute ("Remote", AddressValue (Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (i)), port))));
+      cbrApps.Add (cbr.Install (gwUsers.Get (0)));
+    }
+
+  sinkApps.Start (Seconds (0.5));
+  sinkApps.Stop (Seconds (2.0));
+  cbrApps.Start (Seconds (0.5));
+  cbrApps.Stop (Seconds (1.5));
+
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_NE (m_satelliteRxCount, 0, "Nothing received by the satellite");
+  NS_TEST_ASSERT_MSG_EQ (m_earlySatelliteRxCount, 0, "Bursts received by the satellite before the propagation delay");
+  NS_TEST_ASSERT_MSG_EQ (m_delayedSatelliteRxCount, 0, "Bursts received by the satellite later than at their arrival");
+
+  NS_TEST_ASSERT_MSG_NE (m_rxCount, 0, "Nothing received by the UTs and the GW");
+  NS_TEST_ASSERT_MSG_EQ (m_invalidRxDelayCount, 0, "Packets delivered without both propagation delays and the burst duration");
+
+  Config::SetDefault ("ns3::SatChannel::EnableBentPipe", BooleanValue (false));
+  Config::SetDefault ("ns3::SatBeamHelper::PropagationDelayModel", EnumValue (SatEnums::PD_CONSTANT_SPEED));
+  Config::SetDefault ("ns3::SatPhy::EnableStatisticsTags", BooleanValue (false));
+  Config::SetDefault ("ns3::SatGeoHelper::DaRtnLinkInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the bent pipe mode of the channel.
+ */
+class SatBentPipeTestSuite : public TestSuite
+{
+public:
+  SatBentPipeTestSuite ();
+};
+
+SatBentPipeTestSuite::SatBentPipeTestSuite ()
+  : TestSuite ("sat-bent-pipe-test", SYSTEM)
+{
+  AddTestCase (new SatBentPipeTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatBentPipeTestSuite satBentPipeTest;
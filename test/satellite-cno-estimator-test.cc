@@ -25,6 +25,7 @@
  */
 
 // Include a header file from your module to test.
+#include <cmath>
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/timer.h"
@@ -322,6 +323,77 @@ SatBasicEstimatorAverageTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite C/N0 estimator with mode EXPONENTIAL_AVERAGE.
+ *
+ * This case tests that SatBasicCnoEstimator can be created in mode EXPONENTIAL_AVERAGE and
+ * C/N0 is estimated correctly with set window as time constant.
+ *  1.  Create SatBasicCnoEstimator object with EXPONENTIAL_AVERAGE mode.
+ *  2.  Set samples to estimator at different points of time (method AddSample).
+ *  3.  Get C/N0 estimation from estimator at some points of time (method GetCnoEstimation).
+ *
+ *  Expected result:
+ *   Returned C/N0 estimation must be the exponentially weighted average of the samples,
+ *   where the weight of a new sample depends on the time from the previous sample.
+ *
+ *   C/N0 estimation must be NAN, if no samples are got during time window.
+ *
+ *
+ */
+class SatBasicEstimatorExponentialAverageTestCase : public SatEstimatorBaseTestCase
+{
+public:
+  SatBasicEstimatorExponentialAverageTestCase () : SatEstimatorBaseTestCase ("Test satellite C per N0 basic estimator with mode EXPONENTIAL_AVERAGE.")
+  {
+  }
+  virtual ~SatBasicEstimatorExponentialAverageTestCase ()
+  {
+  }
+
+protected:
+  virtual void DoRun (void);
+};
+
+void
+SatBasicEstimatorExponentialAverageTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-cno-estimator-unit", "exponential-average", true);
+
+  // create estimator with window 200 ms
+  Simulator::Schedule (Seconds (0.05), &SatBasicEstimatorLastTestCase::CreateEstimator, this, SatCnoEstimator::EXPONENTIAL_AVERAGE, Seconds (0.20) );
+
+  // simulate sample additions
+  Simulator::Schedule (Seconds (0.17), &SatBasicEstimatorLastTestCase::AddSample, this, -4.2 );
+  Simulator::Schedule (Seconds (0.22), &SatBasicEstimatorLastTestCase::AddSample, this, 8.1 );
+  Simulator::Schedule (Seconds (0.26), &SatBasicEstimatorLastTestCase::AddSample, this, -15.7 );
+
+  // simulate C/N0 estimations with window 200 ms
+  Simulator::Schedule (Seconds (0.09), &SatBasicEstimatorLastTestCase::GetCnoEstimation, this ); // NAN expected
+  Simulator::Schedule (Seconds (0.19), &SatBasicEstimatorLastTestCase::GetCnoEstimation, this ); // -4.2 expected
+  Simulator::Schedule (Seconds (0.25), &SatBasicEstimatorLastTestCase::GetCnoEstimation, this ); // -4.2 weighted with 8.1
+  Simulator::Schedule (Seconds (0.35), &SatBasicEstimatorLastTestCase::GetCnoEstimation, this ); // previous weighted with -15.7
+  Simulator::Schedule (Seconds (0.49), &SatBasicEstimatorLastTestCase::GetCnoEstimation, this ); // NAN expected
+
+  Simulator::Run ();
+
+  // After simulation check that estimations are as expected
+  double second = -4.2 + (1.0 - std::exp (-0.05 / 0.20)) * (8.1 - -4.2);
+  double third = second + (1.0 - std::exp (-0.04 / 0.20)) * (-15.7 - second);
+
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[0]), true, "first estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[1], -4.2, 0.0001, "second estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[2], second, 0.0001, "third estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL ( m_cnoEstimations[3], third, 0.0001, "fourth estimation incorrect");
+  NS_TEST_ASSERT_MSG_EQ ( std::isnan (m_cnoEstimations[4]), true, "fifth estimation incorrect");
+
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 
 /**
  * \ingroup satellite
@@ -339,6 +411,7 @@ SatBasicCnoEstimatorTestSuite::SatBasicCnoEstimatorTestSuite ()
   AddTestCase (new SatBasicEstimatorLastTestCase, TestCase::QUICK);
   AddTestCase (new SatBasicEstimatorMinTestCase, TestCase::QUICK);
   AddTestCase (new SatBasicEstimatorAverageTestCase, TestCase::QUICK);
+  AddTestCase (new SatBasicEstimatorExponentialAverageTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
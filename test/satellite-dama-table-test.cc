@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-dama-table-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the DAMA table of the beam scheduler.
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/string.h"
+#include "ns3/simulator.h"
+#include "../model/satellite-const-variables.h"
+#include "../model/satellite-control-message.h"
+#include "../model/satellite-lower-layer-service.h"
+#include "../model/satellite-cno-estimator.h"
+#include "../model/satellite-dama-table.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the CR decoding and persistence handling
+ *        of the DAMA table.
+ *
+ *  1.  Create a lower layer service configuration with a CRA + RBDC RC
+ *      and a VBDC RC, and add two UTs with it to a DAMA table.
+ *  2.  Decode CRs of the first UT to the table, update the RBDC requests
+ *      and decrement the persistence values.
+ *  3.  Check the requests of the UTs after each step.
+ *
+ *  Expected result:
+ *    RBDC requests of the same RC are summed up and applied when the RBDC
+ *    requests are updated, VBDC requests are applied right away and the
+ *    requests are cleared when their persistence expires. The requests of
+ *    the second UT are not affected.
+ */
+class SatDamaTableTestCase : public TestCase
+{
+public:
+  SatDamaTableTestCase ();
+  virtual ~SatDamaTableTestCase ();
+
+private:
+  virtual void DoRun (void);
+  SatCrMessage::RequestContainer_t CreateCr (uint8_t rcIndex, SatEnums::SatCapacityAllocationCategory_t cac, uint32_t value);
+};
+
+SatDamaTableTestCase::SatDamaTableTestCase ()
+  : TestCase ("Test DAMA table.")
+{
+}
+
+SatDamaTableTestCase::~SatDamaTableTestCase ()
+{
+}
+
+SatCrMessage::RequestContainer_t
+SatDamaTableTestCase::CreateCr (uint8_t rcIndex, SatEnums::SatCapacityAllocationCategory_t cac, uint32_t value)
+{
+  Ptr<SatCrMessage> crMsg = CreateObject<SatCrMessage> ();
+  crMsg->AddControlElement (rcIndex, cac, value);
+
+  return crMsg->GetCapacityRequestContent ();
+}
+
+void
+SatDamaTableTestCase::DoRun (void)
+{
+  Ptr<SatLowerLayerServiceConf> llsConf = CreateObject<SatLowerLayerServiceConf> ();
+  llsConf->SetAttribute ("DaServiceCount", UintegerValue (2));
+  llsConf->SetAttribute ("DynamicRatePersistence", UintegerValue (2));
+  llsConf->SetAttribute ("VolumeBacklogPersistence", UintegerValue (3));
+  llsConf->SetAttribute ("DaService0_ConstantAssignmentProvided", BooleanValue (true));
+  llsConf->SetAttribute ("DaService0_RbdcAllowed", BooleanValue (true));
+  llsConf->SetAttribute ("DaService0_VolumeAllowed", BooleanValue (false));
+  llsConf->SetAttribute ("DaService0_ConstantServiceRate", StringValue ("ns3::ConstantRandomVariable[Constant=50]"));
+  llsConf->SetAttribute ("DaService0_MaximumServiceRate", UintegerValue (1000));
+  llsConf->SetAttribute ("DaService0_MinimumServiceRate", UintegerValue (100));
+  llsConf->SetAttribute ("DaService1_ConstantAssignmentProvided", BooleanValue (false));
+  llsConf->SetAttribute ("DaService1_RbdcAllowed", BooleanValue (false));
+  llsConf->SetAttribute ("DaService1_VolumeAllowed", BooleanValue (true));
+  llsConf->SetAttribute ("DaService1_MaximumBacklogSize", UintegerValue (10));
+
+  SatDamaTable table;
+
+  uint32_t ut0 = table.AddUt (llsConf, Create<SatBasicCnoEstimator> (SatCnoEstimator::LAST, Seconds (1.0)));
+  uint32_t ut1 = table.AddUt (llsConf, Create<SatBasicCnoEstimator> (SatCnoEstimator::LAST, Seconds (1.0)));
+
+  NS_TEST_ASSERT_MSG_EQ (ut0, 0, "Index of first UT incorrect");
+  NS_TEST_ASSERT_MSG_EQ (ut1, 1, "Index of second UT incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetUtCount (), 2, "UT count incorrect");
+  NS_TEST_ASSERT_MSG_EQ ((uint32_t) table.GetRcCount (ut0), 2, "RC count incorrect");
+
+  // configured rates
+  NS_TEST_ASSERT_MSG_EQ (table.GetCraInKbps (ut0, 0), 50, "CRA incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetCraInKbps (ut0, 1), 0, "CRA of RC without constant assignment incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetMinRbdcInKbps (ut0, 0), 0, "Minimum RBDC without RBDC persistence incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetMinRateBasedBytes (ut0, Seconds (1.0)), 100 * SatConstVariables::BITS_IN_KBIT / SatConstVariables::BITS_PER_BYTE, "Minimum rate based bytes incorrect");
+
+  // RBDC requests are summed up and applied at update, VBDC requests are applied right away
+  table.ReceiveCr (ut0, CreateCr (0, SatEnums::DA_RBDC, 200));
+  table.ReceiveCr (ut0, CreateCr (0, SatEnums::DA_RBDC, 300));
+  table.ReceiveCr (ut0, CreateCr (1, SatEnums::DA_VBDC, 1000));
+  table.ReceiveCr (ut0, CreateCr (1, SatEnums::DA_VBDC, 500));
+
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut0, 0), 0, "RBDC applied before update");
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut0, 1), 1500, "VBDC incorrect");
+
+  table.UpdateRbdcFromCrs ();
+
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut0, 0), 500, "Summed up RBDC incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetMinRbdcInKbps (ut0, 0), 100, "Minimum RBDC incorrect");
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut1, 0), 0, "RBDC of other UT changed");
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut1, 1), 0, "VBDC of other UT changed");
+
+  // AVBDC request sets the backlog, which is limited to the maximum backlog
+  table.ReceiveCr (ut0, CreateCr (1, SatEnums::DA_AVBDC, 400));
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut0, 1), 400, "AVBDC incorrect");
+
+  table.ReceiveCr (ut0, CreateCr (1, SatEnums::DA_VBDC, 20000));
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut0, 1), 10 * SatConstVariables::BYTES_IN_KBYTE, "Limited VBDC incorrect");
+
+  // requests are cleared when their persistence expires
+  table.DecrementPersistences ();
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut0, 0), 500, "RBDC cleared too early");
+
+  table.DecrementPersistences ();
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut0, 0), 0, "RBDC not cleared");
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut0, 1), 10 * SatConstVariables::BYTES_IN_KBYTE, "VBDC cleared too early");
+
+  table.DecrementPersistences ();
+  NS_TEST_ASSERT_MSG_EQ (table.GetVbdcInBytes (ut0, 1), 0, "VBDC not cleared");
+
+  // RBDC requests are limited to the maximum service rate
+  table.ReceiveCr (ut0, CreateCr (0, SatEnums::DA_RBDC, 5000));
+  table.UpdateRbdcFromCrs ();
+  NS_TEST_ASSERT_MSG_EQ (table.GetRbdcInKbps (ut0, 0), 950, "Limited RBDC incorrect");
+
+  // C/N0 samples are added to the estimator of the UT
+  table.AddCnoSample (ut1, 60.0);
+  NS_TEST_ASSERT_MSG_EQ (table.GetCnoEstimation (ut1), 60.0, "C/N0 estimation incorrect");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the DAMA table.
+ */
+class SatDamaTableTestSuite : public TestSuite
+{
+public:
+  SatDamaTableTestSuite ();
+};
+
+SatDamaTableTestSuite::SatDamaTableTestSuite ()
+  : TestSuite ("sat-dama-table-unit-test", UNIT)
+{
+  AddTestCase (new SatDamaTableTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatDamaTableTestSuite satDamaTableUnit;
@@ -277,14 +277,17 @@ SatFrameAllocatorTestCase::CheckSingleUtTestResults (uint32_t bytesReq, SatFrame
 
   for ( SatFrameAllocator::TbtpMsgContainer_t::const_iterator it = tbtpContainer.begin (); it != tbtpContainer.end (); it++)
     {
-      SatTbtpMessage::DaTimeSlotInfoItem_t info = (*it)->GetDaTimeslots (req.m_address);
+      // the TBTPs of the superframe share the same time slot arena
+      NS_TEST_ASSERT_MSG_EQ ((*it)->GetTimeSlotArena (), tbtpContainer.front ()->GetTimeSlotArena (), "TBTPs don't share time slot arena!");
 
-      for (SatTbtpMessage::DaTimeSlotConfContainer_t::const_iterator it2 = info.second.begin (); it2 != info.second.end (); it2++ )
+      const SatTbtpMessage::DaTimeSlotInfoItem_t &info = (*it)->GetDaTimeslots (req.m_address);
+
+      for (uint32_t i = 0; i < info.m_slotCount; i++ )
         {
-          tbtpAllocatedBytes += m_frameConf->GetWaveformConf ()->GetWaveform ((*it2)->GetWaveFormId ())->GetPayloadInBytes ();
+          tbtpAllocatedBytes += m_frameConf->GetWaveformConf ()->GetWaveform ((*it)->GetDaTimeslot (info, i).GetWaveFormId ())->GetPayloadInBytes ();
         }
 
-      slotsAllocated += info.second.size ();
+      slotsAllocated += info.m_slotCount;
     }
 
   // check that information is identical in TBTP container and UT allocation container
@@ -0,0 +1,274 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-gw-mac-test.cc
+ * \ingroup satellite
+ * \brief Test case to check the idle mode of the GW MAC.
+ */
+
+#include <vector>
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/pointer.h"
+#include "ns3/nstime.h"
+#include "ns3/packet-sink-helper.h"
+#include "ns3/packet-sink.h"
+#include "ns3/cbr-application.h"
+#include "ns3/cbr-helper.h"
+#include "../helper/satellite-helper.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-llc.h"
+#include "../model/satellite-gw-mac.h"
+#include "../model/satellite-fwd-link-scheduler.h"
+#include "../model/satellite-bbframe-conf.h"
+#include "../model/satellite-bbframe-container.h"
+#include "../model/satellite-scheduling-object.h"
+#include "ns3/singleton.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the GW MAC goes idle without traffic and
+ *        resumes the transmissions when traffic arrives.
+ *
+ *  1.  Create a simple scenario. The GW user sends two bursts of CBR traffic
+ *      to the UT user separated by an idle period. The periodic scheduling
+ *      of the forward link scheduler is disabled, so the scheduler polls the
+ *      GW LLC only at the frame starts of the GW MAC.
+ *  2.  Follow the polls of the GW LLC and the packets enqueued to it. A poll
+ *      finding no data and no scheduled BB frames gives the GW MAC a dummy
+ *      frame, after which the MAC goes idle.
+ *
+ *  Expected result:
+ *    The GW MAC goes idle and polls the GW LLC again only after a packet is
+ *    enqueued. The next poll is at most one dummy frame after the enqueued
+ *    packet, and the UT user receives all the traffic.
+ */
+class SatGwMacIdleTestCase : public TestCase
+{
+public:
+  SatGwMacIdleTestCase ();
+  virtual ~SatGwMacIdleTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                      SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                      SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo);
+  void SchedContextCb (std::vector< Ptr<SatSchedulingObject> > &output);
+
+  Ptr<SatLlc> m_gwLlc;
+  Ptr<SatBbFrameContainer> m_bbFrameContainer;
+  bool m_idle;
+  bool m_wokenUp;
+  Time m_wakeUpTime;
+  Time m_maxResumeDelay;
+  uint32_t m_pollCount;
+  uint32_t m_idleCount;
+  uint32_t m_idlePollCount;
+  uint32_t m_resumeCount;
+};
+
+SatGwMacIdleTestCase::SatGwMacIdleTestCase ()
+  : TestCase ("Test GW MAC going idle without traffic and resuming with traffic."),
+    m_idle (false),
+    m_wokenUp (false),
+    m_wakeUpTime (Seconds (0)),
+    m_maxResumeDelay (Seconds (0)),
+    m_pollCount (0),
+    m_idleCount (0),
+    m_idlePollCount (0),
+    m_resumeCount (0)
+{
+}
+
+SatGwMacIdleTestCase::~SatGwMacIdleTestCase ()
+{
+}
+
+void
+SatGwMacIdleTestCase::PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                                     SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                                     SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo)
+{
+  if (eventType == SatEnums::PACKET_ENQUE && nodeType == SatEnums::NT_GW && m_idle)
+    {
+      // the first packet enqueued during the idle period wakes up the MAC
+      m_idle = false;
+      m_wokenUp = true;
+      m_wakeUpTime = now;
+    }
+}
+
+void
+SatGwMacIdleTestCase::SchedContextCb (std::vector< Ptr<SatSchedulingObject> > &output)
+{
+  m_pollCount++;
+
+  if (m_idle)
+    {
+      m_idlePollCount++;
+    }
+
+  if (m_wokenUp)
+    {
+      m_wokenUp = false;
+      m_resumeCount++;
+
+      if (Simulator::Now () - m_wakeUpTime > m_maxResumeDelay)
+        {
+          m_maxResumeDelay = Simulator::Now () - m_wakeUpTime;
+        }
+    }
+
+  m_gwLlc->GetSchedulingContexts (output);
+
+  // without data to schedule the MAC gets a dummy frame and goes idle
+  if (output.empty () && m_bbFrameContainer->GetTotalDuration () == Seconds (0))
+    {
+      m_idleCount++;
+      m_idle = true;
+    }
+}
+
+void
+SatGwMacIdleTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-gw-mac", "idle", true);
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+
+  // poll the LLC only at the frame starts of the MAC
+  Config::SetDefault ("ns3::SatFwdLinkScheduler::Interval", TimeValue (Seconds (10)));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  Time dummyFrameDuration;
+  Config::MatchContainer devices = Config::LookupMatches ("/NodeList/*/DeviceList/*/$ns3::SatNetDevice");
+
+  for (Config::MatchContainer::Iterator it = devices.Begin (); it != devices.End (); ++it)
+    {
+      Ptr<SatNetDevice> device = DynamicCast<SatNetDevice> (*it);
+      Ptr<SatGwMac> gwMac = DynamicCast<SatGwMac> (device->GetMac ());
+
+      if (gwMac != NULL)
+        {
+          NS_TEST_ASSERT_MSG_EQ ((m_gwLlc == NULL), true, "More than one GW in the scenario");
+
+          PointerValue schedulerValue;
+          gwMac->GetAttribute ("Scheduler", schedulerValue);
+          Ptr<SatFwdLinkScheduler> scheduler = schedulerValue.Get<SatFwdLinkScheduler> ();
+
+          PointerValue confValue;
+          scheduler->GetAttribute ("BBFrameConf", confValue);
+          dummyFrameDuration = confValue.Get<SatBbFrameConf> ()->GetDummyBbFrameDuration ();
+
+          PointerValue containerValue;
+          scheduler->GetAttribute ("BBFrameContainer", containerValue);
+          m_bbFrameContainer = containerValue.Get<SatBbFrameContainer> ();
+
+          m_gwLlc = device->GetLlc ();
+          scheduler->SetSchedContextCallback (MakeCallback (&SatGwMacIdleTestCase::SchedContextCb, this));
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((m_gwLlc != NULL), true, "No GW in the scenario");
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatLlc/PacketTrace",
+                   MakeCallback (&SatGwMacIdleTestCase::PacketTraceCb, this));
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9;
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+  ApplicationContainer utApps = sink.Install (utUsers.Get (0));
+  utApps.Start (Seconds (0.1));
+  utApps.Stop (Seconds (2.5));
+
+  // two bursts of traffic separated by an idle period
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (utUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("10ms"));
+  cbr.SetAttribute ("PacketSize", UintegerValue (512));
+
+  ApplicationContainer gwApps = cbr.Install (gwUsers.Get (0));
+  gwApps.Get (0)->SetStartTime (Seconds (0.5));
+  gwApps.Get (0)->SetStopTime (Seconds (0.7));
+
+  gwApps.Add (cbr.Install (gwUsers.Get (0)));
+  gwApps.Get (1)->SetStartTime (Seconds (1.5));
+  gwApps.Get (1)->SetStopTime (Seconds (1.7));
+
+  Simulator::Stop (Seconds (2.5));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  Ptr<PacketSink> receiver = DynamicCast<PacketSink> (utApps.Get (0));
+  Ptr<CbrApplication> firstSender = DynamicCast<CbrApplication> (gwApps.Get (0));
+  Ptr<CbrApplication> secondSender = DynamicCast<CbrApplication> (gwApps.Get (1));
+
+  NS_TEST_ASSERT_MSG_NE (m_pollCount, 0, "GW LLC not polled");
+  NS_TEST_ASSERT_MSG_NE (m_idleCount, 0, "GW MAC never idle");
+  NS_TEST_ASSERT_MSG_EQ (m_idlePollCount, 0, "GW LLC polled while the MAC is idle");
+  NS_TEST_ASSERT_MSG_NE (m_resumeCount, 0, "GW MAC never resumed");
+  NS_TEST_ASSERT_MSG_EQ ((m_maxResumeDelay <= dummyFrameDuration), true, "GW MAC resumed later than at the next dummy frame");
+
+  NS_TEST_ASSERT_MSG_NE (firstSender->GetSent (), (uint32_t)0, "Nothing sent in the first burst");
+  NS_TEST_ASSERT_MSG_NE (secondSender->GetSent (), (uint32_t)0, "Nothing sent in the second burst");
+  NS_TEST_ASSERT_MSG_EQ (receiver->GetTotalRx (), firstSender->GetSent () + secondSender->GetSent (), "Packets were lost !");
+
+  m_gwLlc = NULL;
+  m_bbFrameContainer = NULL;
+
+  Config::SetDefault ("ns3::SatFwdLinkScheduler::Interval", TimeValue (MilliSeconds (20)));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the GW MAC.
+ */
+class SatGwMacTestSuite : public TestSuite
+{
+public:
+  SatGwMacTestSuite ();
+};
+
+SatGwMacTestSuite::SatGwMacTestSuite ()
+  : TestSuite ("sat-gw-mac-test", SYSTEM)
+{
+  AddTestCase (new SatGwMacIdleTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatGwMacTestSuite satGwMacTest;
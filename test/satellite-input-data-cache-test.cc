@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-input-data-cache-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the binary input data cache.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/string.h"
+#include "ns3/singleton.h"
+#include "ns3/satellite-env-variables.h"
+#include "../utils/satellite-input-data-cache.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that converted text tables are read back from
+ *        the cache file.
+ *
+ *  Expected result:
+ *    - Keys consist of the parent directory and the file name.
+ *    - A numeric table, including coding rate fractions, is read back with
+ *      the same values from the cache file.
+ *    - A non-numeric file is not converted.
+ *    - A table is not used from the cache for a missing file with the same key.
+ *    - A table is not used from the cache after its text file has changed.
+ */
+class SatInputDataCacheTestCase : public TestCase
+{
+public:
+  SatInputDataCacheTestCase ();
+  virtual ~SatInputDataCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatInputDataCacheTestCase::SatInputDataCacheTestCase ()
+  : TestCase ("Test binary input data cache.")
+{
+}
+
+SatInputDataCacheTestCase::~SatInputDataCacheTestCase ()
+{
+}
+
+void
+SatInputDataCacheTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-input-data-cache", "", true);
+
+  NS_TEST_ASSERT_MSG_EQ (SatInputDataCache::GetKey ("contrib/satellite/data/linkresults/s2_qpsk_1_to_2.txt"),
+                         "linkresults/s2_qpsk_1_to_2.txt", "key incorrect");
+  NS_TEST_ASSERT_MSG_EQ (SatInputDataCache::GetKey ("contrib/satellite/data//GeoPos.txt"),
+                         "data/GeoPos.txt", "key with empty path component incorrect");
+
+  std::string outputPath = Singleton<SatEnvVariables>::Get ()->GetOutputPath ();
+  std::string tableFile = outputPath + "/waveforms.txt";
+  std::string textFile = outputPath + "/readme.txt";
+  std::string cacheFile = outputPath + "/inputdatacache.bin";
+
+  // a relative cache file name would be searched from the data folder
+  if (cacheFile[0] != '/')
+    {
+      cacheFile = Singleton<SatEnvVariables>::Get ()->GetCurrentWorkingDirectory () + "/" + cacheFile;
+    }
+
+  std::ofstream table (tableFile.c_str ());
+  table << "2 2 1/3 38 536" << std::endl
+        << std::endl
+        << "3\t2 2/5 55 662" << std::endl;
+  table.close ();
+
+  std::ofstream text (textFile.c_str ());
+  text << "not a table" << std::endl;
+  text.close ();
+
+  std::vector<std::string> files;
+  files.push_back (tableFile);
+  files.push_back (textFile);
+
+  NS_TEST_ASSERT_MSG_EQ (SatInputDataCache::WriteCacheFile (cacheFile, files), 1, "converted file count incorrect");
+
+  Ptr<SatInputDataCache> cache = Singleton<SatInputDataCache>::Get ();
+  cache->SetAttribute ("FileName", StringValue (cacheFile));
+  cache->DoDispose ();
+
+  uint32_t rows = 0;
+  uint32_t columns = 0;
+  const double *values = cache->GetTable (tableFile, rows, columns);
+  const double expected[] = { 2, 2, 1, 3, 38, 536, 3, 2, 2, 5, 55, 662 };
+
+  NS_TEST_ASSERT_MSG_EQ (cache->IsLoaded (), true, "cache file not loaded");
+  NS_TEST_ASSERT_MSG_NE (values, 0, "table not found from the cache");
+  NS_TEST_ASSERT_MSG_EQ (rows, 2, "row count incorrect");
+  NS_TEST_ASSERT_MSG_EQ (columns, 6, "column count incorrect");
+
+  for (uint32_t i = 0; (values != 0) && (i < rows * columns); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (values[i], expected[i], "table value " << i << " incorrect");
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (cache->GetTable (textFile, rows, columns), 0, "non-numeric file found from the cache");
+
+  // a missing file in another data folder has the same key, but it is not the converted file
+  std::string missingFile = "/sat-input-data-cache-test-missing/" + SatInputDataCache::GetKey (tableFile);
+  NS_TEST_ASSERT_MSG_EQ (SatInputDataCache::GetKey (missingFile), SatInputDataCache::GetKey (tableFile), "keys differ");
+  NS_TEST_ASSERT_MSG_EQ (cache->GetTable (missingFile, rows, columns), 0, "table of a missing file used from the cache");
+
+  // a changed text file has precedence over the cache
+  std::ofstream changed (tableFile.c_str (), std::ofstream::app);
+  changed << "4 2 1/2 62 536" << std::endl;
+  changed.close ();
+
+  NS_TEST_ASSERT_MSG_EQ (cache->GetTable (tableFile, rows, columns), 0, "outdated table used from the cache");
+
+  std::remove (tableFile.c_str ());
+  std::remove (textFile.c_str ());
+  std::remove (cacheFile.c_str ());
+
+  cache->SetAttribute ("FileName", StringValue ("inputdatacache.bin"));
+  cache->DoDispose ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the binary input data cache.
+ */
+class SatInputDataCacheTestSuite : public TestSuite
+{
+public:
+  SatInputDataCacheTestSuite ();
+};
+
+SatInputDataCacheTestSuite::SatInputDataCacheTestSuite ()
+  : TestSuite ("sat-input-data-cache-unit-test", UNIT)
+{
+  AddTestCase (new SatInputDataCacheTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatInputDataCacheTestSuite satInputDataCacheUnit;
@@ -0,0 +1,247 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-input-trace-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the time sample input trace container and
+ *        the interference input trace container.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "ns3/string.h"
+#include "ns3/mac48-address.h"
+#include "ns3/satellite-env-variables.h"
+#include "../utils/satellite-input-fstream-time-double-container.h"
+#include "../model/satellite-id-mapper.h"
+#include "../model/satellite-interference-input-trace-container.h"
+#include "../model/satellite-traced-interference.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the closest time sample lookups of the
+ *        input trace container.
+ *
+ *  1.  Write a trace file with three time samples of two values.
+ *  2.  Read the trace file to a container.
+ *  3.  At scheduled times, look up the closest time sample both as a row
+ *      and as a single column value.
+ *
+ *  Expected result:
+ *    The sample closest to the current time is returned, and the column
+ *    values are the same as the values of the row.
+ */
+class SatInputTraceTestCase : public TestCase
+{
+public:
+  SatInputTraceTestCase ();
+  virtual ~SatInputTraceTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CheckSample (Ptr<SatInputFileStreamTimeDoubleContainer> container, double expectedValue);
+};
+
+SatInputTraceTestCase::SatInputTraceTestCase ()
+  : TestCase ("Test time sample input trace container.")
+{
+}
+
+SatInputTraceTestCase::~SatInputTraceTestCase ()
+{
+}
+
+void
+SatInputTraceTestCase::CheckSample (Ptr<SatInputFileStreamTimeDoubleContainer> container, double expectedValue)
+{
+  std::vector<double> row = container->ProceedToNextClosestTimeSample ();
+
+  NS_TEST_ASSERT_MSG_EQ (row.size (), 3, "Row size incorrect");
+  NS_TEST_ASSERT_MSG_EQ (row[1], expectedValue, "Closest sample incorrect at " << Now ().GetSeconds ());
+  NS_TEST_ASSERT_MSG_EQ (container->ProceedToNextClosestTimeSample (1), row[1], "Column value differs from the row");
+  NS_TEST_ASSERT_MSG_EQ (container->ProceedToNextClosestTimeSample (2), row[2], "Column value differs from the row");
+}
+
+void
+SatInputTraceTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-input-trace", "", true);
+
+  std::string traceFile = Singleton<SatEnvVariables>::Get ()->GetOutputPath () + "/trace.txt";
+
+  std::ofstream trace (traceFile.c_str ());
+  trace << "0.1 1 10" << std::endl
+        << "0.2 2 20" << std::endl
+        << "0.3 3 30" << std::endl;
+  trace.close ();
+
+  Ptr<SatInputFileStreamTimeDoubleContainer> container = CreateObject<SatInputFileStreamTimeDoubleContainer> (traceFile, std::ios::in, 3);
+
+  Simulator::Schedule (Seconds (0.0), &SatInputTraceTestCase::CheckSample, this, container, 1.0);
+  Simulator::Schedule (Seconds (0.14), &SatInputTraceTestCase::CheckSample, this, container, 1.0);
+  Simulator::Schedule (Seconds (0.16), &SatInputTraceTestCase::CheckSample, this, container, 2.0);
+  Simulator::Schedule (Seconds (0.29), &SatInputTraceTestCase::CheckSample, this, container, 3.0);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  container->Dispose ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the trace indexes of the interference input
+ *        trace container and their use in the traced interference model.
+ *
+ *  1.  Write interference traces of two UTs into a data folder of the test.
+ *  2.  Calculate the interference of a reception of the first UT with the
+ *      traced interference model, and read the traces by their indexes.
+ *  3.  Reset the trace container and load the trace of the second UT first,
+ *      so that it gets the index the first UT had before the reset.
+ *  4.  Calculate the interference of the reception of the first UT again.
+ *
+ *  Expected result:
+ *    The traces have their own indexes and the densities read by the index
+ *    and by the key are the ones of the trace files. After the reset, the
+ *    traced interference model looks up the index again and still reads
+ *    the trace of the first UT.
+ */
+class SatInterferenceInputTraceTestCase : public TestCase
+{
+public:
+  SatInterferenceInputTraceTestCase ();
+  virtual ~SatInterferenceInputTraceTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void WriteTrace (std::string dataPath, Address address, double density);
+};
+
+SatInterferenceInputTraceTestCase::SatInterferenceInputTraceTestCase ()
+  : TestCase ("Test trace indexes of the interference input trace container.")
+{
+}
+
+SatInterferenceInputTraceTestCase::~SatInterferenceInputTraceTestCase ()
+{
+}
+
+void
+SatInterferenceInputTraceTestCase::WriteTrace (std::string dataPath, Address address, double density)
+{
+  std::stringstream filename;
+  filename << dataPath << "/interferencetraces/input/BEAM_" << Singleton<SatIdMapper>::Get ()->GetBeamIdWithMac (address)
+           << "_UT_" << Singleton<SatIdMapper>::Get ()->GetUtIdWithMac (address)
+           << "_channelType_" << SatEnums::GetChannelTypeName (SatEnums::FORWARD_USER_CH);
+
+  std::ofstream trace (filename.str ().c_str ());
+  trace << "0.0 " << density << std::endl
+        << "1.0 " << density << std::endl;
+  trace.close ();
+}
+
+void
+SatInterferenceInputTraceTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-input-trace", "interference", true);
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  // the traces are read from a data folder of the test
+  std::string dataPath = Singleton<SatEnvVariables>::Get ()->GetOutputPath ();
+  Singleton<SatEnvVariables>::Get ()->CreateDirectory (dataPath + "/interferencetraces");
+  Singleton<SatEnvVariables>::Get ()->CreateDirectory (dataPath + "/interferencetraces/input");
+  Singleton<SatEnvVariables>::Get ()->SetAttribute ("DataPath", StringValue (dataPath));
+
+  Address firstUt = Mac48Address::Allocate ();
+  Address secondUt = Mac48Address::Allocate ();
+
+  Singleton<SatIdMapper>::Get ()->AttachMacToUtId (firstUt);
+  Singleton<SatIdMapper>::Get ()->AttachMacToBeamId (firstUt, 1);
+  Singleton<SatIdMapper>::Get ()->AttachMacToUtId (secondUt);
+  Singleton<SatIdMapper>::Get ()->AttachMacToBeamId (secondUt, 1);
+
+  WriteTrace (dataPath, firstUt, 2.0);
+  WriteTrace (dataPath, secondUt, 5.0);
+
+  SatInterferenceInputTraceContainer *traceContainer = Singleton<SatInterferenceInputTraceContainer>::Get ();
+  SatInterferenceInputTraceContainer::key_t firstKey = std::make_pair (firstUt, SatEnums::FORWARD_USER_CH);
+  SatInterferenceInputTraceContainer::key_t secondKey = std::make_pair (secondUt, SatEnums::FORWARD_USER_CH);
+  traceContainer->Reset ();
+
+  Ptr<SatTracedInterference> interference = CreateObject<SatTracedInterference> (SatEnums::FORWARD_USER_CH, 10.0);
+  Ptr<SatInterference::InterferenceChangeEvent> event = interference->Add (MilliSeconds (1), 1.0, firstUt);
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (interference->Calculate (event), 20.0, 1e-9, "Interference of the first UT incorrect");
+
+  uint32_t firstIndex = traceContainer->GetTraceIndex (firstKey);
+  uint32_t secondIndex = traceContainer->GetTraceIndex (secondKey);
+
+  NS_TEST_ASSERT_MSG_NE (firstIndex, secondIndex, "Traces have the same index");
+  NS_TEST_ASSERT_MSG_EQ (traceContainer->GetTraceIndex (firstKey), firstIndex, "Trace index changed");
+  NS_TEST_ASSERT_MSG_EQ_TOL (traceContainer->GetInterferenceDensity (firstIndex), 2.0, 1e-9, "Density by index incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL (traceContainer->GetInterferenceDensity (secondIndex), 5.0, 1e-9, "Density by index incorrect");
+  NS_TEST_ASSERT_MSG_EQ_TOL (traceContainer->GetInterferenceDensity (secondKey), 5.0, 1e-9, "Density by key incorrect");
+
+  // after the reset the trace of the second UT gets the index of the first UT
+  traceContainer->Reset ();
+  NS_TEST_ASSERT_MSG_EQ (traceContainer->GetTraceIndex (secondKey), firstIndex, "Trace index not reused after the reset");
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (interference->Calculate (event), 20.0, 1e-9, "Interference of the first UT incorrect after the reset");
+
+  traceContainer->Reset ();
+  interference->Dispose ();
+
+  Singleton<SatEnvVariables>::Get ()->SetAttribute ("DataPath", StringValue ("contrib/satellite/data"));
+  Singleton<SatIdMapper>::Get ()->Reset ();
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the input trace containers.
+ */
+class SatInputTraceTestSuite : public TestSuite
+{
+public:
+  SatInputTraceTestSuite ();
+};
+
+SatInputTraceTestSuite::SatInputTraceTestSuite ()
+  : TestSuite ("sat-input-trace-unit-test", UNIT)
+{
+  AddTestCase (new SatInputTraceTestCase, TestCase::QUICK);
+  AddTestCase (new SatInterferenceInputTraceTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatInputTraceTestSuite satInputTraceUnit;
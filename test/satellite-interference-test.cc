@@ -124,12 +124,15 @@ SatConstantInterferenceTestCase::DoRun (void)
  *
  *  Expected result:
  *   Value should be correctly calculated. According to interfering events added.
+ *   The result is the same, when the interfering transmissions are added as
+ *   aggregated interference-only power without events, also when two of them
+ *   share the start and end times and so share their changes.
  *
  */
 class SatPerPacketInterferenceTestCase : public TestCase
 {
 public:
-  SatPerPacketInterferenceTestCase ();
+  SatPerPacketInterferenceTestCase (bool aggregated);
   virtual ~SatPerPacketInterferenceTestCase ();
 
   // adds interference to model object
@@ -147,10 +150,13 @@ private:
   Ptr<SatInterference::InterferenceChangeEvent> m_rxEvent[4];
   uint32_t  m_rxIndex;
   double finalPower[4];
+  bool m_aggregated;
 };
 
-SatPerPacketInterferenceTestCase::SatPerPacketInterferenceTestCase ()
-  : TestCase ("Test satellite per packet interference model.")
+SatPerPacketInterferenceTestCase::SatPerPacketInterferenceTestCase (bool aggregated)
+  : TestCase (aggregated ? "Test satellite per packet interference model with aggregated interference."
+                         : "Test satellite per packet interference model."),
+    m_aggregated (aggregated)
 {
   m_interference = CreateObject<SatPerPacketInterference> ();
   m_rxIndex = 0;
@@ -169,7 +175,14 @@ SatPerPacketInterferenceTestCase::~SatPerPacketInterferenceTestCase ()
 void
 SatPerPacketInterferenceTestCase::AddInterference (Time duration, double power, Address rxAddress)
 {
-  Ptr<SatInterference::InterferenceChangeEvent> event =  m_interference->Add (duration, power, rxAddress);
+  if (m_aggregated)
+    {
+      m_interference->AddAggregated (duration, power);
+    }
+  else
+    {
+      Ptr<SatInterference::InterferenceChangeEvent> event =  m_interference->Add (duration, power, rxAddress);
+    }
 }
 
 void
@@ -202,7 +215,17 @@ SatPerPacketInterferenceTestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-if-unit", "perpacket", true);
 
   // simulate interferences and receiving (4 receivers), adding and calculation done in callback routines
-  Simulator::Schedule (Time (0), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (60), 60, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+  if (m_aggregated)
+    {
+      // split the first interference into two transmissions sharing the start and end times
+      Simulator::Schedule (Time (0), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (60), 25, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+      Simulator::Schedule (Time (0), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (60), 35, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+    }
+  else
+    {
+      Simulator::Schedule (Time (0), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (60), 60, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+    }
+
   Simulator::Schedule (Time (10), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (40), 70, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
   Simulator::Schedule (Time (30), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (50), 10, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
   Simulator::Schedule (Time (50), &SatPerPacketInterferenceTestCase::AddInterference, this, Time (40), 20, Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
@@ -253,7 +276,8 @@ SatInterferenceTestSuite::SatInterferenceTestSuite ()
   : TestSuite ("sat-if-unit-test", UNIT)
 {
   AddTestCase (new SatConstantInterferenceTestCase, TestCase::QUICK);
-  AddTestCase (new SatPerPacketInterferenceTestCase, TestCase::QUICK);
+  AddTestCase (new SatPerPacketInterferenceTestCase (false), TestCase::QUICK);
+  AddTestCase (new SatPerPacketInterferenceTestCase (true), TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
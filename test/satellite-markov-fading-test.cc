@@ -0,0 +1,307 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-markov-fading-test.cc
+ * \ingroup satellite
+ * \brief Test cases to check the fading of the UTs sharing a Markov fading engine.
+ */
+
+#include <cmath>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "../model/satellite-markov-conf.h"
+#include "../model/satellite-markov-fading-engine.h"
+
+using namespace ns3;
+
+/**
+ * \brief Elevation angle of the UTs of the test cases
+ * \return elevation angle
+ */
+static double
+GetTestElevation ()
+{
+  return 45.0;
+}
+
+/**
+ * \brief Velocity of the UTs of the test cases
+ * \return velocity
+ */
+static double
+GetTestVelocity ()
+{
+  return 0.0;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Base class of the test cases sampling the fading of UTs sharing
+ *        a Markov fading engine. The UTs are locked to the same set and
+ *        state, and their downlink fading is sampled every 10 ms.
+ */
+class SatMarkovFadingSamplingTestCase : public TestCase
+{
+public:
+  SatMarkovFadingSamplingTestCase (std::string name);
+  virtual ~SatMarkovFadingSamplingTestCase ();
+
+protected:
+  /**
+   * \brief Sample the fading of the UTs
+   * \param utCount Number of UTs
+   * \param duration Sampling duration
+   */
+  void SampleFading (uint32_t utCount, Time duration);
+
+  /**
+   * \brief Get the time average of the fading samples of a UT
+   * \param ut UT
+   * \return average fading
+   */
+  double GetMean (uint32_t ut) const;
+
+  /**
+   * \brief Fading samples by UT
+   */
+  std::vector<std::vector<double> > m_samples;
+
+private:
+  void SampleCb ();
+
+  Ptr<SatMarkovFadingEngine> m_fadingEngine;
+  std::vector<uint32_t> m_utIndexes;
+};
+
+SatMarkovFadingSamplingTestCase::SatMarkovFadingSamplingTestCase (std::string name)
+  : TestCase (name)
+{
+}
+
+SatMarkovFadingSamplingTestCase::~SatMarkovFadingSamplingTestCase ()
+{
+}
+
+void
+SatMarkovFadingSamplingTestCase::SampleCb ()
+{
+  for (uint32_t i = 0; i < m_utIndexes.size (); i++)
+    {
+      m_samples[i].push_back (m_fadingEngine->GetFading (m_utIndexes[i],
+                                                         SatEnums::FORWARD_USER_CH,
+                                                         MakeCallback (&GetTestElevation),
+                                                         MakeCallback (&GetTestVelocity)));
+    }
+
+  Simulator::Schedule (MilliSeconds (10), &SatMarkovFadingSamplingTestCase::SampleCb, this);
+}
+
+void
+SatMarkovFadingSamplingTestCase::SampleFading (uint32_t utCount, Time duration)
+{
+  Ptr<SatMarkovConf> markovConf = CreateObject<SatMarkovConf> ();
+  m_fadingEngine = CreateObject<SatMarkovFadingEngine> (markovConf);
+
+  m_utIndexes.clear ();
+  m_samples.assign (utCount, std::vector<double> ());
+
+  for (uint32_t i = 0; i < utCount; i++)
+    {
+      uint32_t utIndex = m_fadingEngine->AddUt (GetTestElevation ());
+      m_fadingEngine->LockToSetAndState (utIndex, 0, 0, true);
+      m_utIndexes.push_back (utIndex);
+    }
+
+  Simulator::Schedule (MilliSeconds (10), &SatMarkovFadingSamplingTestCase::SampleCb, this);
+  Simulator::Stop (duration);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_fadingEngine->Dispose ();
+  m_fadingEngine = NULL;
+}
+
+double
+SatMarkovFadingSamplingTestCase::GetMean (uint32_t ut) const
+{
+  double sum = 0.0;
+
+  for (uint32_t i = 0; i < m_samples[ut].size (); i++)
+    {
+      sum += m_samples[ut][i];
+    }
+
+  return m_samples[ut].empty () ? 0.0 : sum / m_samples[ut].size ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that each UT has the statistics of its own fader.
+ *
+ *  1.  Lock 20 UTs to the same set and state of the Loo fader.
+ *  2.  Sample their fading for 50 seconds.
+ *
+ *  Expected result:
+ *    The fading values are finite and positive. The long-term averages of
+ *    the UTs differ, since each UT has its own direct signal amplitudes.
+ *    With shared amplitudes, the long-term averages would be equal.
+ */
+class SatMarkovFadingStatisticsTestCase : public SatMarkovFadingSamplingTestCase
+{
+public:
+  SatMarkovFadingStatisticsTestCase ();
+  virtual ~SatMarkovFadingStatisticsTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMarkovFadingStatisticsTestCase::SatMarkovFadingStatisticsTestCase ()
+  : SatMarkovFadingSamplingTestCase ("Test per UT statistics of the shared Markov fading engine.")
+{
+}
+
+SatMarkovFadingStatisticsTestCase::~SatMarkovFadingStatisticsTestCase ()
+{
+}
+
+void
+SatMarkovFadingStatisticsTestCase::DoRun (void)
+{
+  uint32_t utCount = 20;
+  SampleFading (utCount, Seconds (50));
+
+  std::vector<double> means;
+  double meanOfMeans = 0.0;
+
+  for (uint32_t i = 0; i < utCount; i++)
+    {
+      NS_TEST_ASSERT_MSG_GT (m_samples[i].size (), 0, "No fading samples of UT " << i);
+
+      for (uint32_t j = 0; j < m_samples[i].size (); j++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (std::isfinite (m_samples[i][j]), true, "Fading value of UT " << i << " not finite");
+          NS_TEST_ASSERT_MSG_GT (m_samples[i][j], 0.0, "Fading value of UT " << i << " not positive");
+        }
+
+      means.push_back (GetMean (i));
+      meanOfMeans += means.back () / utCount;
+    }
+
+  double variance = 0.0;
+
+  for (uint32_t i = 0; i < utCount; i++)
+    {
+      variance += std::pow (means[i] - meanOfMeans, 2) / utCount;
+    }
+
+  NS_TEST_ASSERT_MSG_GT (std::sqrt (variance) / meanOfMeans, 0.01, "Long-term fading averages of the UTs do not differ");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the fading of the UTs is decorrelated.
+ *
+ *  1.  Lock 8 UTs to the same set and state of the Loo fader.
+ *  2.  Sample their fading for 50 seconds.
+ *
+ *  Expected result:
+ *    The average magnitude of the correlation coefficients of the fading
+ *    of the UT pairs is small.
+ */
+class SatMarkovFadingCorrelationTestCase : public SatMarkovFadingSamplingTestCase
+{
+public:
+  SatMarkovFadingCorrelationTestCase ();
+  virtual ~SatMarkovFadingCorrelationTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMarkovFadingCorrelationTestCase::SatMarkovFadingCorrelationTestCase ()
+  : SatMarkovFadingSamplingTestCase ("Test decorrelation of the UTs of the shared Markov fading engine.")
+{
+}
+
+SatMarkovFadingCorrelationTestCase::~SatMarkovFadingCorrelationTestCase ()
+{
+}
+
+void
+SatMarkovFadingCorrelationTestCase::DoRun (void)
+{
+  uint32_t utCount = 8;
+  SampleFading (utCount, Seconds (50));
+
+  double sumOfCorrelations = 0.0;
+  uint32_t pairs = 0;
+
+  for (uint32_t a = 0; a < utCount; a++)
+    {
+      for (uint32_t b = a + 1; b < utCount; b++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (m_samples[a].size (), m_samples[b].size (), "Different number of samples");
+
+          double meanA = GetMean (a);
+          double meanB = GetMean (b);
+          double covariance = 0.0;
+          double varianceA = 0.0;
+          double varianceB = 0.0;
+
+          for (uint32_t i = 0; i < m_samples[a].size (); i++)
+            {
+              covariance += (m_samples[a][i] - meanA) * (m_samples[b][i] - meanB);
+              varianceA += std::pow (m_samples[a][i] - meanA, 2);
+              varianceB += std::pow (m_samples[b][i] - meanB, 2);
+            }
+
+          NS_TEST_ASSERT_MSG_GT (varianceA * varianceB, 0.0, "Fading of UT " << a << " or " << b << " does not vary");
+
+          sumOfCorrelations += std::fabs (covariance / std::sqrt (varianceA * varianceB));
+          pairs++;
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_LT (sumOfCorrelations / pairs, 0.2, "Fading of the UTs is correlated");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the Markov fading engine.
+ */
+class SatMarkovFadingTestSuite : public TestSuite
+{
+public:
+  SatMarkovFadingTestSuite ();
+};
+
+SatMarkovFadingTestSuite::SatMarkovFadingTestSuite ()
+  : TestSuite ("sat-markov-fading-test", UNIT)
+{
+  AddTestCase (new SatMarkovFadingStatisticsTestCase, TestCase::QUICK);
+  AddTestCase (new SatMarkovFadingCorrelationTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatMarkovFadingTestSuite satMarkovFadingTest;
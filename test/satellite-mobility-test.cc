@@ -34,6 +34,7 @@
 #include "ns3/string.h"
 #include "ns3/mobility-helper.h"
 #include "../model/satellite-mobility-model.h"
+#include "../model/satellite-constant-position-mobility-model.h"
 #include "../model/satellite-position-allocator.h"
 #include "ns3/singleton.h"
 #include "../utils/satellite-env-variables.h"
@@ -313,6 +314,86 @@ SatMobilityList2TestCase::DoRun (void)
   Singleton<SatEnvVariables>::Get ()->DoDispose ();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite mobility's position caching.
+ *        (Constant position mobility model used).
+ *
+ *  This case tests that cached positions of SatMobilityModel follow the set positions.
+ *    1.  Create SatConstantPositionMobilityModel object.
+ *    2.  Set positions to it in geodetic and in Cartesian format.
+ *    3.  Get cached geodetic position, Cartesian position and position version.
+ *
+ *  Expected result:
+ *    Cached positions should be same as the set ones and
+ *    position version should be changed every time when position is set.
+ *
+ */
+class SatMobilityCacheTestCase : public TestCase
+{
+public:
+  SatMobilityCacheTestCase ();
+  virtual ~SatMobilityCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatMobilityCacheTestCase::SatMobilityCacheTestCase ()
+  : TestCase ("Test satellite mobility (constant model) position caching.")
+{
+}
+
+SatMobilityCacheTestCase::~SatMobilityCacheTestCase ()
+{
+}
+
+void
+SatMobilityCacheTestCase::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-mobility", "cache", true);
+
+  Ptr<SatMobilityModel> model = CreateObject<SatConstantPositionMobilityModel> ();
+
+  GeoCoordinate first (30, 45, 1000);
+  model->SetGeoPosition (first);
+  uint32_t version = model->GetPositionVersion ();
+
+  NS_TEST_ASSERT_MSG_EQ (model->GetCachedGeoPosition ().GetLatitude (), 30, "Cached latitude is different.");
+  NS_TEST_ASSERT_MSG_EQ (model->GetCachedGeoPosition ().GetLongitude (), 45, "Cached longitude is different.");
+  NS_TEST_ASSERT_MSG_EQ (model->GetCachedGeoPosition ().GetAltitude (), 1000, "Cached altitude is different.");
+
+  Vector cartesian = model->GetPosition ();
+  Vector expected = first.ToVector ();
+
+  NS_TEST_ASSERT_MSG_EQ (cartesian.x, expected.x, "Cartesian x is different.");
+  NS_TEST_ASSERT_MSG_EQ (cartesian.y, expected.y, "Cartesian y is different.");
+  NS_TEST_ASSERT_MSG_EQ (cartesian.z, expected.z, "Cartesian z is different.");
+
+  // reading position must not change the version
+  NS_TEST_ASSERT_MSG_EQ (model->GetPositionVersion (), version, "Position version changed without position change.");
+
+  GeoCoordinate second (-20, 10, 0);
+  model->SetGeoPosition (second);
+
+  NS_TEST_ASSERT_MSG_NE (model->GetPositionVersion (), version, "Position version not changed.");
+  NS_TEST_ASSERT_MSG_EQ (model->GetCachedGeoPosition ().GetLatitude (), -20, "Cached latitude not updated.");
+  NS_TEST_ASSERT_MSG_EQ (model->GetCachedGeoPosition ().GetLongitude (), 10, "Cached longitude not updated.");
+
+  cartesian = model->GetPosition ();
+  expected = second.ToVector ();
+
+  NS_TEST_ASSERT_MSG_EQ (cartesian.x, expected.x, "Cartesian x not updated.");
+  NS_TEST_ASSERT_MSG_EQ (cartesian.y, expected.y, "Cartesian y not updated.");
+  NS_TEST_ASSERT_MSG_EQ (cartesian.z, expected.z, "Cartesian z not updated.");
+
+  Simulator::Destroy ();
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite mobility unit test cases.
@@ -329,6 +410,7 @@ SatMobilityTestSuite::SatMobilityTestSuite ()
   AddTestCase (new SatMobilityRandomTestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList1TestCase, TestCase::QUICK);
   AddTestCase (new SatMobilityList2TestCase, TestCase::QUICK);
+  AddTestCase (new SatMobilityCacheTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
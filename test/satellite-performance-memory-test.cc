@@ -28,6 +28,7 @@
  *
  */
 
+#include <fstream>
 #include "ns3/string.h"
 #include "ns3/packet-sink-helper.h"
 #include "ns3/packet-sink.h"
@@ -40,7 +41,9 @@
 #include "ns3/cbr-helper.h"
 #include "../helper/satellite-helper.h"
 #include "ns3/singleton.h"
+#include "ns3/boolean.h"
 #include "../utils/satellite-env-variables.h"
+#include "../utils/satellite-memory-report.h"
 
 using namespace ns3;
 
@@ -161,6 +164,99 @@ Pm1::DoRun (void)
   // <<< End of actual test using Simple scenario <<<
 }
 
+/**
+ * \ingroup satellite
+ * \brief 'Memory profile of UTs' test case implementation, id: pm-2.
+ *
+ * Full scenario created with helper, UTs installed in lean mode
+ * 1.  UT connected user sends packets to GW connected user.
+ * 2.  Memory profile report by object type is created for the UT nodes and
+ *     saved for further analysing.
+ *
+ * Expected results:
+ *   GW connected user receives all data sent and the report has one protocol
+ *   stack per UT.
+ */
+class Pm2 : public TestCase
+{
+public:
+  Pm2 ();
+  virtual ~Pm2 ();
+
+private:
+  virtual void DoRun (void);
+};
+
+Pm2::Pm2 ()
+  : TestCase ("'Memory profile of UTs' test case creates a memory profile report of the UTs installed in lean mode.")
+{
+}
+
+Pm2::~Pm2 ()
+{
+}
+
+void
+Pm2::DoRun (void)
+{
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-perf-mem", "pm-2", true);
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatUtHelper::LeanInstall", BooleanValue (true));
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::FULL);
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+  NodeContainer uts = helper->UtNodes ();
+
+  uint16_t port = 9; // Discard port (RFC 863)
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("0.8s"));
+
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+
+  ApplicationContainer gwApps = sink.Install (gwUsers.Get (0));
+  ApplicationContainer utApps = cbr.Install (utUsers.Get (0));
+
+  gwApps.Start (Seconds (1.0));
+  gwApps.Stop (Seconds (2.5));
+  utApps.Start (Seconds (1.0));
+  utApps.Stop (Seconds (2.5));
+
+  // Create the memory profile report of the UT nodes and save it
+  SatMemoryReport report;
+  report.AddNodes (uts);
+
+  std::ofstream reportFile ((Singleton<SatEnvVariables>::Get ()->GetOutputPath () + "/ut-memory-report.txt").c_str ());
+  report.Print (reportFile);
+  reportFile.close ();
+
+  NS_TEST_ASSERT_MSG_EQ (report.GetObjectCount ("ns3::SatUtPhy"), uts.GetN (), "Number of UT PHYs incorrect!");
+  NS_TEST_ASSERT_MSG_EQ (report.GetObjectCount ("ns3::SatUtMac"), uts.GetN (), "Number of UT MACs incorrect!");
+  NS_TEST_ASSERT_MSG_EQ (report.GetObjectCount ("ns3::SatUtLlc"), uts.GetN (), "Number of UT LLCs incorrect!");
+  NS_TEST_ASSERT_MSG_GT (report.GetTotalSize (), (uint64_t)0, "Memory profile report is empty!");
+
+  Simulator::Stop (Seconds (2.5));
+  Simulator::Run ();
+
+  Simulator::Destroy ();
+
+  Ptr<PacketSink> gwReceiver = DynamicCast<PacketSink> (gwApps.Get (0));
+  Ptr<CbrApplication> utSender = DynamicCast<CbrApplication> (utApps.Get (0));
+
+  NS_TEST_ASSERT_MSG_NE (utSender->GetSent (), (uint32_t)0, "Nothing sent by UT user!");
+  NS_TEST_ASSERT_MSG_EQ (gwReceiver->GetTotalRx (), utSender->GetSent (), "Packets were lost between UT and GW!");
+
+  Config::SetDefault ("ns3::SatUtHelper::LeanInstall", BooleanValue (false));
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
 
 // The TestSuite class names the TestSuite as sat-perf-mem, identifies what type of TestSuite (SYSTEM),
 // and enables the TestCases to be run.  Typically, only the constructor for
@@ -177,6 +273,8 @@ PerfMemTestSuite::PerfMemTestSuite ()
 {
   // add pm-1 case to suite sat-perf-mem
   AddTestCase (new Pm1, TestCase::QUICK);
+  // add pm-2 case to suite sat-perf-mem
+  AddTestCase (new Pm2, TestCase::EXTENSIVE);
 }
 
 // Allocate an instance of this TestSuite
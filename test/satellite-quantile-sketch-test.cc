@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-quantile-sketch-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the streaming quantile sketch.
+ */
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "../stats/satellite-quantile-sketch.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the percentiles of a sketch are within the
+ *        configured relative accuracy of the exact percentiles.
+ *
+ *  Expected result:
+ *    Every checked percentile of positive (delay-like) and signed (SINR-like)
+ *    samples is within the relative accuracy of the exact value.
+ */
+class SatQuantileSketchAccuracyTestCase : public TestCase
+{
+public:
+  SatQuantileSketchAccuracyTestCase ();
+  virtual ~SatQuantileSketchAccuracyTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CheckPercentiles (std::vector<double> samples, double accuracy, uint32_t maxBins);
+};
+
+SatQuantileSketchAccuracyTestCase::SatQuantileSketchAccuracyTestCase ()
+  : TestCase ("Test quantile sketch accuracy.")
+{
+}
+
+SatQuantileSketchAccuracyTestCase::~SatQuantileSketchAccuracyTestCase ()
+{
+}
+
+void
+SatQuantileSketchAccuracyTestCase::CheckPercentiles (std::vector<double> samples, double accuracy, uint32_t maxBins)
+{
+  SatQuantileSketch sketch (accuracy, maxBins);
+
+  for (std::vector<double>::const_iterator it = samples.begin (); it != samples.end (); ++it)
+    {
+      sketch.Add (*it);
+    }
+
+  std::sort (samples.begin (), samples.end ());
+
+  NS_TEST_ASSERT_MSG_EQ (sketch.GetCount (), samples.size (), "sample count incorrect");
+  NS_TEST_ASSERT_MSG_EQ (sketch.GetMin (), samples.front (), "minimum incorrect");
+  NS_TEST_ASSERT_MSG_EQ (sketch.GetMax (), samples.back (), "maximum incorrect");
+
+  const double q[] = { 0.0, 0.5, 0.95, 0.99, 0.999, 1.0 };
+
+  for (uint32_t i = 0; i < sizeof (q) / sizeof (q[0]); i++)
+    {
+      double exact = samples[static_cast<uint32_t> (q[i] * (samples.size () - 1))];
+      double estimate = sketch.GetQuantile (q[i]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (estimate, exact, std::abs (exact) * accuracy + 1e-12,
+                                 "percentile " << q[i] * 100.0 << " incorrect");
+    }
+}
+
+void
+SatQuantileSketchAccuracyTestCase::DoRun (void)
+{
+  std::vector<double> delays;
+  std::vector<double> sinrs;
+
+  for (uint32_t i = 1; i <= 10000; i++)
+    {
+      // spread over several orders of magnitude like delay samples
+      delays.push_back (0.001 * std::pow (1.001, static_cast<double> (i)));
+      // signed values like SINR samples in dB
+      sinrs.push_back (-5.0 + 0.0025 * static_cast<double> ((i * 7919) % 10000));
+    }
+
+  CheckPercentiles (delays, 0.01, 2048);
+  CheckPercentiles (sinrs, 0.01, 2048);
+  // finer accuracy needs more buckets to cover the same range
+  CheckPercentiles (delays, 0.001, 8192);
+
+  SatQuantileSketch empty;
+  NS_TEST_ASSERT_MSG_EQ (std::isnan (empty.GetQuantile (0.5)), true, "empty sketch percentile incorrect");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check merging and serialization of sketches.
+ *
+ *  Expected result:
+ *    Merging two sketches gives the same percentiles as adding all samples
+ *    into one sketch, and a deserialized sketch equals the original one.
+ */
+class SatQuantileSketchMergeTestCase : public TestCase
+{
+public:
+  SatQuantileSketchMergeTestCase ();
+  virtual ~SatQuantileSketchMergeTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatQuantileSketchMergeTestCase::SatQuantileSketchMergeTestCase ()
+  : TestCase ("Test quantile sketch merge and serialization.")
+{
+}
+
+SatQuantileSketchMergeTestCase::~SatQuantileSketchMergeTestCase ()
+{
+}
+
+void
+SatQuantileSketchMergeTestCase::DoRun (void)
+{
+  SatQuantileSketch all;
+  SatQuantileSketch first;
+  SatQuantileSketch second;
+
+  for (uint32_t i = 0; i < 5000; i++)
+    {
+      double value = -20.0 + 0.01 * static_cast<double> (i);
+      all.Add (value);
+      ((i % 2) ? first : second).Add (value);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (first.Merge (second), true, "merge failed");
+  NS_TEST_ASSERT_MSG_EQ (first.GetCount (), all.GetCount (), "merged count incorrect");
+
+  SatQuantileSketch restored;
+  NS_TEST_ASSERT_MSG_EQ (restored.Deserialize (first.Serialize ()), true, "deserialization failed");
+  NS_TEST_ASSERT_MSG_EQ (restored.GetCount (), all.GetCount (), "restored count incorrect");
+
+  const double q[] = { 0.01, 0.5, 0.9, 0.99 };
+
+  for (uint32_t i = 0; i < sizeof (q) / sizeof (q[0]); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (first.GetQuantile (q[i]), all.GetQuantile (q[i]), 1e-9,
+                                 "merged percentile incorrect");
+      NS_TEST_ASSERT_MSG_EQ_TOL (restored.GetQuantile (q[i]), all.GetQuantile (q[i]), 1e-9,
+                                 "restored percentile incorrect");
+    }
+
+  SatQuantileSketch other (0.05);
+  NS_TEST_ASSERT_MSG_EQ (first.Merge (other), false, "incompatible merge accepted");
+  NS_TEST_ASSERT_MSG_EQ (restored.Deserialize ("garbage"), false, "invalid sketch accepted");
+  NS_TEST_ASSERT_MSG_EQ (restored.GetCount (), 0, "invalid sketch not reset");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the collapsing of the buckets, when the maximum
+ *        number of buckets is exceeded.
+ *
+ *  Expected result:
+ *    With negative-only and mixed-sign samples, only the lowest samples are
+ *    collapsed together, so the median and the upper percentiles remain
+ *    within the relative accuracy of the exact values.
+ */
+class SatQuantileSketchCollapseTestCase : public TestCase
+{
+public:
+  SatQuantileSketchCollapseTestCase ();
+  virtual ~SatQuantileSketchCollapseTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CheckUpperPercentiles (std::vector<double> samples, double accuracy, uint32_t maxBins);
+};
+
+SatQuantileSketchCollapseTestCase::SatQuantileSketchCollapseTestCase ()
+  : TestCase ("Test quantile sketch bucket collapsing.")
+{
+}
+
+SatQuantileSketchCollapseTestCase::~SatQuantileSketchCollapseTestCase ()
+{
+}
+
+void
+SatQuantileSketchCollapseTestCase::CheckUpperPercentiles (std::vector<double> samples, double accuracy, uint32_t maxBins)
+{
+  SatQuantileSketch sketch (accuracy, maxBins);
+
+  for (std::vector<double>::const_iterator it = samples.begin (); it != samples.end (); ++it)
+    {
+      sketch.Add (*it);
+    }
+
+  std::sort (samples.begin (), samples.end ());
+
+  NS_TEST_ASSERT_MSG_EQ ((sketch.GetNumBins () <= 2 * maxBins), true, "too many buckets in use");
+
+  const double q[] = { 0.5, 0.9, 0.99, 1.0 };
+
+  for (uint32_t i = 0; i < sizeof (q) / sizeof (q[0]); i++)
+    {
+      double exact = samples[static_cast<uint32_t> (q[i] * (samples.size () - 1))];
+      double estimate = sketch.GetQuantile (q[i]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (estimate, exact, std::abs (exact) * accuracy + 1e-12,
+                                 "percentile " << q[i] * 100.0 << " incorrect");
+    }
+}
+
+void
+SatQuantileSketchCollapseTestCase::DoRun (void)
+{
+  std::vector<double> negative;
+  std::vector<double> mixed;
+
+  for (uint32_t i = 1; i <= 1000; i++)
+    {
+      // -10 ... -0.01
+      negative.push_back (-0.01 * static_cast<double> (i));
+      // -10 ... 10
+      mixed.push_back (-10.0 + 0.01 * static_cast<double> (i));
+      mixed.push_back (0.01 * static_cast<double> (i));
+    }
+
+  // 28 buckets of 10 % accuracy cover about 0.01 ... 2.8 in magnitude
+  CheckUpperPercentiles (negative, 0.1, 28);
+  CheckUpperPercentiles (mixed, 0.1, 28);
+
+  SatQuantileSketch first (0.01, 100);
+  SatQuantileSketch second (0.01, 200);
+  NS_TEST_ASSERT_MSG_EQ (first.Merge (second), false, "merge with different maximum number of buckets accepted");
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the streaming quantile sketch.
+ */
+class SatQuantileSketchTestSuite : public TestSuite
+{
+public:
+  SatQuantileSketchTestSuite ();
+};
+
+SatQuantileSketchTestSuite::SatQuantileSketchTestSuite ()
+  : TestSuite ("sat-quantile-sketch-unit-test", UNIT)
+{
+  AddTestCase (new SatQuantileSketchAccuracyTestCase, TestCase::QUICK);
+  AddTestCase (new SatQuantileSketchMergeTestCase, TestCase::QUICK);
+  AddTestCase (new SatQuantileSketchCollapseTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatQuantileSketchTestSuite satQuantileSketchUnit;
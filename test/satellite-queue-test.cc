@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-queue-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the satellite queue.
+ */
+
+#include <deque>
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "../model/satellite-queue.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test the packet storage of the satellite queue.
+ *
+ *  1.  Create a queue and a reference container of the packet sizes.
+ *  2.  Enqueue, dequeue and push back to the front packets of random sizes,
+ *      so that the queue grows and wraps around its storage.
+ *  3.  After each operation, check the number of packets, the front packet
+ *      and the number of packets at the front not larger than thresholds.
+ *
+ *  Expected result:
+ *    The queue agrees with the reference container after each operation.
+ */
+class SatQueueTestCase : public TestCase
+{
+public:
+  SatQueueTestCase ();
+  virtual ~SatQueueTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CheckQueue (Ptr<SatQueue> queue, const std::deque<uint32_t> &sizes);
+};
+
+SatQueueTestCase::SatQueueTestCase ()
+  : TestCase ("Test satellite queue.")
+{
+}
+
+SatQueueTestCase::~SatQueueTestCase ()
+{
+}
+
+void
+SatQueueTestCase::CheckQueue (Ptr<SatQueue> queue, const std::deque<uint32_t> &sizes)
+{
+  NS_TEST_ASSERT_MSG_EQ (queue->GetNPackets (), sizes.size (), "Number of packets incorrect");
+  NS_TEST_ASSERT_MSG_EQ (queue->IsEmpty (), sizes.empty (), "Queue emptiness incorrect");
+
+  if (!sizes.empty ())
+    {
+      NS_TEST_ASSERT_MSG_EQ (queue->Peek ()->GetSize (), sizes.front (), "Front packet incorrect");
+    }
+
+  uint32_t thresholds[] = { 0, 50, 100, 150, 200, 1000 };
+
+  for (uint32_t t = 0; t < sizeof (thresholds) / sizeof (thresholds[0]); ++t)
+    {
+      uint32_t expected = 0;
+
+      while (expected < sizes.size () && sizes[expected] <= thresholds[t])
+        {
+          ++expected;
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (queue->GetNumSmallerPackets (thresholds[t]), expected, "Number of smaller packets incorrect");
+    }
+}
+
+void
+SatQueueTestCase::DoRun (void)
+{
+  Ptr<SatQueue> queue = CreateObject<SatQueue> (0);
+  queue->SetAttribute ("MaxPackets", UintegerValue (1000));
+
+  Ptr<UniformRandomVariable> unif = CreateObject<UniformRandomVariable> ();
+
+  std::deque<uint32_t> sizes;
+
+  for (uint32_t i = 0; i < 2000; ++i)
+    {
+      uint32_t operation = unif->GetInteger (0, 9);
+
+      if (operation < 5 || sizes.empty ())
+        {
+          uint32_t size = unif->GetInteger (1, 200);
+          if (queue->Enqueue (Create<Packet> (size)))
+            {
+              sizes.push_back (size);
+            }
+        }
+      else if (operation < 8)
+        {
+          Ptr<Packet> p = queue->Dequeue ();
+          NS_TEST_ASSERT_MSG_EQ (p->GetSize (), sizes.front (), "Dequeued packet incorrect");
+          sizes.pop_front ();
+        }
+      else
+        {
+          // Dequeue a packet and push the remaining part of it back to the front
+          Ptr<Packet> p = queue->Dequeue ();
+          sizes.pop_front ();
+
+          if (p->GetSize () > 1)
+            {
+              uint32_t size = unif->GetInteger (1, p->GetSize () - 1);
+              queue->PushFront (Create<Packet> (size));
+              sizes.push_front (size);
+            }
+        }
+
+      CheckQueue (queue, sizes);
+    }
+
+  queue->DequeueAll ();
+  sizes.clear ();
+  CheckQueue (queue, sizes);
+
+  queue->Dispose ();
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the satellite queue.
+ */
+class SatQueueTestSuite : public TestSuite
+{
+public:
+  SatQueueTestSuite ();
+};
+
+SatQueueTestSuite::SatQueueTestSuite ()
+  : TestSuite ("sat-queue-unit-test", UNIT)
+{
+  AddTestCase (new SatQueueTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatQueueTestSuite satQueueUnit;
@@ -28,10 +28,14 @@
  *
  */
 
+#include <set>
+#include <sstream>
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/simulator.h"
 #include "ns3/core-module.h"
+#include "ns3/ipv4.h"
+#include "ns3/ipv4-static-routing-helper.h"
 #include "../helper/satellite-helper.h"
 #include "ns3/singleton.h"
 #include "ns3/satellite-id-mapper.h"
@@ -338,6 +342,107 @@ ScenarioCreationUser::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief 'Scenario Creation, Router Routes' test case implementation.
+ *
+ * This case tests the routes set to the IP router behind the GWs.
+ *  1.  Full test scenario created with helper
+ *
+ *  Expected result:
+ *    • The scenario has more than one GW.
+ *    • The router has a route to each network in the routing tables of the
+ *      GWs, except for the loopback and backbone networks of the GWs, through
+ *      the GW having the route, and no other routes through the GWs.
+ *
+ */
+class ScenarioCreationRouterRoutes : public TestCase
+{
+public:
+  ScenarioCreationRouterRoutes ();
+  virtual ~ScenarioCreationRouterRoutes ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ScenarioCreationRouterRoutes::ScenarioCreationRouterRoutes ()
+  : TestCase ("'Scenario Creation, Router Routes' case tests the routes of the IP router of the GWs")
+{
+}
+
+ScenarioCreationRouterRoutes::~ScenarioCreationRouterRoutes ()
+{
+}
+
+//
+// ScenarioCreationRouterRoutes TestCase implementation
+//
+void
+ScenarioCreationRouterRoutes::DoRun (void)
+{
+  // Reset singletons
+  Singleton<SatIdMapper>::Get ()->Reset ();
+
+  // Set simulation output details
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-scenario-creation", "router-routes", true);
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::FULL);
+
+  NodeContainer gwNodes = helper->GetBeamHelper ()->GetGwNodes ();
+  NS_TEST_ASSERT_MSG_GT (gwNodes.GetN (), 1, "Scenario does not have several GWs!");
+
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  std::set<Ipv4Address> gwAddresses;
+  std::set<std::string> gwRoutes;
+
+  for (NodeContainer::Iterator i = gwNodes.Begin (); i != gwNodes.End (); i++)
+    {
+      Ptr<Ipv4> ipv4Gw = (*i)->GetObject<Ipv4> ();
+      uint32_t lastGwIf = ipv4Gw->GetNInterfaces () - 1;
+      Ipv4Address gwAddress = ipv4Gw->GetAddress (lastGwIf, 0).GetLocal ();
+      Ptr<Ipv4StaticRouting> routingGw = ipv4RoutingHelper.GetStaticRouting (ipv4Gw);
+
+      gwAddresses.insert (gwAddress);
+
+      for (uint32_t j = 0; j < routingGw->GetNRoutes (); j++)
+        {
+          Ipv4RoutingTableEntry route = routingGw->GetRoute (j);
+
+          if ((route.GetInterface () != 0) && (route.GetInterface () != lastGwIf))
+            {
+              std::ostringstream oss;
+              oss << route.GetDest () << "/" << route.GetDestNetworkMask () << " via " << gwAddress;
+              gwRoutes.insert (oss.str ());
+            }
+        }
+    }
+
+  Ptr<Ipv4StaticRouting> routingRouter = ipv4RoutingHelper.GetStaticRouting (helper->GetUserHelper ()->GetRouter ()->GetObject<Ipv4> ());
+  std::set<std::string> routerRoutes;
+
+  for (uint32_t j = 0; j < routingRouter->GetNRoutes (); j++)
+    {
+      Ipv4RoutingTableEntry route = routingRouter->GetRoute (j);
+
+      if (gwAddresses.find (route.GetGateway ()) != gwAddresses.end ())
+        {
+          std::ostringstream oss;
+          oss << route.GetDest () << "/" << route.GetDestNetworkMask () << " via " << route.GetGateway ();
+          routerRoutes.insert (oss.str ());
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_GT (gwRoutes.size (), 0, "GWs do not have routes!");
+  NS_TEST_ASSERT_MSG_EQ (routerRoutes.size (), gwRoutes.size (), "Router route count is not what expected!");
+  NS_TEST_ASSERT_MSG_EQ ((routerRoutes == gwRoutes), true, "Router routes differ from the GW routes!");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+
+  Simulator::Destroy ();
+}
+
 // The TestSuite class names the TestSuite as sat-scenario-creation, identifies what type of TestSuite (SYSTEM),
 // and enables the TestCases to be run. Typically, only the constructor for
 // this class must be defined
@@ -363,6 +468,9 @@ ScenarioCreationTestSuite::ScenarioCreationTestSuite ()
   // add ScenarioCreationUser case to suite sat-scenario-creation
   AddTestCase (new ScenarioCreationUser, TestCase::QUICK);
 
+  // add ScenarioCreationRouterRoutes case to suite sat-scenario-creation
+  AddTestCase (new ScenarioCreationRouterRoutes, TestCase::EXTENSIVE);
+
 }
 
 // Allocate an instance of this TestSuite
@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-signal-parameters-test.cc
+ * \ingroup satellite
+ * \brief Test cases to check the address summary of the signal parameters.
+ */
+
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/mac48-address.h"
+#include "../model/satellite-mac-tag.h"
+#include "../model/satellite-signal-parameters.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check the address summary of a burst against the
+ *        walk through the MAC tags of the packets of the burst.
+ *
+ *  1.  Create bursts with unicast packets destined to the same and different
+ *      addresses, broadcast and group packets, and a packet without MAC tag.
+ *  2.  Create the address summary of each burst.
+ *
+ *  Expected result:
+ *    For each destination of the burst and an address not in the burst, the
+ *    summary gives the same destination check and the same source address as
+ *    the walk through the MAC tags. The first and last addresses and the
+ *    flags of the summary are the same as in the MAC tags.
+ */
+class SatAddressSummaryTestCase : public TestCase
+{
+public:
+  SatAddressSummaryTestCase ();
+  virtual ~SatAddressSummaryTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Create a packet with a MAC tag
+   * \param dest Destination address
+   * \param source Source address
+   * \return packet
+   */
+  Ptr<Packet> CreateTaggedPacket (Mac48Address dest, Mac48Address source);
+
+  /**
+   * \brief Check the summary of a burst against the MAC tags of its packets
+   * \param packets The packets of the burst
+   * \param receivers The addresses to check
+   */
+  void CheckSummary (const SatSignalParameters::PacketsInBurst_t &packets,
+                     const std::vector<Mac48Address> &receivers);
+};
+
+SatAddressSummaryTestCase::SatAddressSummaryTestCase ()
+  : TestCase ("Test the address summary of a burst against the MAC tags of its packets.")
+{
+}
+
+SatAddressSummaryTestCase::~SatAddressSummaryTestCase ()
+{
+}
+
+Ptr<Packet>
+SatAddressSummaryTestCase::CreateTaggedPacket (Mac48Address dest, Mac48Address source)
+{
+  Ptr<Packet> packet = Create<Packet> (100);
+
+  SatMacTag tag;
+  tag.SetDestAddress (dest);
+  tag.SetSourceAddress (source);
+  packet->AddPacketTag (tag);
+
+  return packet;
+}
+
+void
+SatAddressSummaryTestCase::CheckSummary (const SatSignalParameters::PacketsInBurst_t &packets,
+                                         const std::vector<Mac48Address> &receivers)
+{
+  Ptr<const SatSignalParameters::AddressSummary> summary = Create<SatSignalParameters::AddressSummary> (packets);
+
+  // walk through the MAC tags of the packets as the receivers did without the summary
+  bool hasBroadcast = false;
+  bool hasGroup = false;
+  bool hasUntagged = false;
+  SatMacTag firstTag;
+  SatMacTag lastTag;
+
+  for (uint32_t i = 0; i < packets.size (); i++)
+    {
+      SatMacTag tag;
+
+      if (!packets[i]->PeekPacketTag (tag))
+        {
+          hasUntagged = true;
+        }
+
+      if (i == 0)
+        {
+          firstTag = tag;
+        }
+
+      lastTag = tag;
+      hasBroadcast |= tag.GetDestAddress ().IsBroadcast ();
+      hasGroup |= (!tag.GetDestAddress ().IsBroadcast () && tag.GetDestAddress ().IsGroup ());
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (summary->m_hasBroadcastDest, hasBroadcast, "Broadcast flag differs");
+  NS_TEST_ASSERT_MSG_EQ (summary->m_hasGroupDest, hasGroup, "Group flag differs");
+  NS_TEST_ASSERT_MSG_EQ (summary->m_hasUntaggedPacket, hasUntagged, "Untagged packet flag differs");
+  NS_TEST_ASSERT_MSG_EQ (summary->m_firstSourceAddress, firstTag.GetSourceAddress (), "First source address differs");
+  NS_TEST_ASSERT_MSG_EQ (summary->m_lastSourceAddress, lastTag.GetSourceAddress (), "Last source address differs");
+  NS_TEST_ASSERT_MSG_EQ (summary->m_lastDestAddress, lastTag.GetDestAddress (), "Last destination address differs");
+
+  for (uint32_t r = 0; r < receivers.size (); r++)
+    {
+      bool found = false;
+      bool destination = false;
+      Mac48Address source;
+
+      for (uint32_t i = 0; i < packets.size (); i++)
+        {
+          SatMacTag tag;
+          packets[i]->PeekPacketTag (tag);
+
+          if (tag.GetDestAddress () == receivers[r])
+            {
+              if (!found && !receivers[r].IsGroup ())
+                {
+                  found = true;
+                  source = tag.GetSourceAddress ();
+                }
+
+              destination = true;
+            }
+          else if (tag.GetDestAddress ().IsBroadcast () || tag.GetDestAddress ().IsGroup ())
+            {
+              destination = true;
+            }
+        }
+
+      Mac48Address summarySource;
+      bool summaryFound = summary->FindUnicastDestination (receivers[r], summarySource);
+
+      NS_TEST_ASSERT_MSG_EQ (summary->IsDestination (receivers[r]), destination, "Destination check of " << receivers[r] << " differs");
+      NS_TEST_ASSERT_MSG_EQ (summaryFound, found, "Unicast destination " << receivers[r] << " differs");
+
+      if (found)
+        {
+          NS_TEST_ASSERT_MSG_EQ (summarySource, source, "Source address of " << receivers[r] << " differs");
+        }
+    }
+}
+
+void
+SatAddressSummaryTestCase::DoRun (void)
+{
+  std::vector<Mac48Address> utAddresses;
+
+  for (uint32_t i = 0; i < 50; i++)
+    {
+      utAddresses.push_back (Mac48Address::Allocate ());
+    }
+
+  Mac48Address gwAddress = Mac48Address::Allocate ();
+  Mac48Address otherGwAddress = Mac48Address::Allocate ();
+  Mac48Address notInBurst = Mac48Address::Allocate ();
+  Mac48Address group = Mac48Address::GetMulticast (Ipv4Address ("239.1.1.1"));
+
+  std::vector<Mac48Address> receivers (utAddresses);
+  receivers.push_back (notInBurst);
+
+  // unicast packets, several destined to the same UT from different sources
+  SatSignalParameters::PacketsInBurst_t unicastBurst;
+
+  for (uint32_t i = 0; i < 200; i++)
+    {
+      Mac48Address source = (i % 3 == 0) ? otherGwAddress : gwAddress;
+      unicastBurst.push_back (CreateTaggedPacket (utAddresses[(i * 7) % utAddresses.size ()], source));
+    }
+
+  CheckSummary (unicastBurst, receivers);
+
+  // unicast packets with a broadcast packet in the middle
+  SatSignalParameters::PacketsInBurst_t broadcastBurst;
+  broadcastBurst.push_back (CreateTaggedPacket (utAddresses[1], gwAddress));
+  broadcastBurst.push_back (CreateTaggedPacket (Mac48Address::GetBroadcast (), otherGwAddress));
+  broadcastBurst.push_back (CreateTaggedPacket (utAddresses[2], otherGwAddress));
+  broadcastBurst.push_back (CreateTaggedPacket (utAddresses[1], otherGwAddress));
+
+  CheckSummary (broadcastBurst, receivers);
+
+  // unicast packets with a group packet at the end
+  SatSignalParameters::PacketsInBurst_t groupBurst;
+  groupBurst.push_back (CreateTaggedPacket (utAddresses[3], gwAddress));
+  groupBurst.push_back (CreateTaggedPacket (utAddresses[4], otherGwAddress));
+  groupBurst.push_back (CreateTaggedPacket (group, gwAddress));
+
+  CheckSummary (groupBurst, receivers);
+
+  // a packet without MAC tag among the unicast packets
+  SatSignalParameters::PacketsInBurst_t untaggedBurst;
+  untaggedBurst.push_back (CreateTaggedPacket (utAddresses[5], gwAddress));
+  untaggedBurst.push_back (Create<Packet> (100));
+  untaggedBurst.push_back (CreateTaggedPacket (utAddresses[6], otherGwAddress));
+
+  CheckSummary (untaggedBurst, receivers);
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the signal parameters.
+ */
+class SatSignalParametersTestSuite : public TestSuite
+{
+public:
+  SatSignalParametersTestSuite ();
+};
+
+SatSignalParametersTestSuite::SatSignalParametersTestSuite ()
+  : TestSuite ("sat-signal-parameters-test", UNIT)
+{
+  AddTestCase (new SatAddressSummaryTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSignalParametersTestSuite satSignalParametersTest;
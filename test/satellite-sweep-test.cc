@@ -0,0 +1,317 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-sweep-test.cc
+ * \ingroup satellite
+ * \brief Test case to check the sweep runs of the simulation helper.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/nstime.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/singleton.h"
+#include "../helper/simulation-helper.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the sweep points are applied in the worker
+ *        processes and the forking process gets the status of the workers.
+ *
+ *  1.  Write a sweep file with two sweep points: a helper attribute with
+ *      an attribute of the UT MACs and a helper attribute only.
+ *  2.  Create the scenario with the sweep file. Each worker process checks
+ *      its overrides, its RNG run and that the random variables of the
+ *      scenario have streams to reassign, and exits with the result.
+ *
+ *  Expected result:
+ *    Both workers see their overrides and the run number of their sweep
+ *    point and exit successfully. CreateSatScenario returns in the
+ *    forking process with no failed runs and the sweep summary lists the
+ *    status of each sweep point.
+ */
+class SatSweepRunsTestCase : public TestCase
+{
+public:
+  SatSweepRunsTestCase ();
+  virtual ~SatSweepRunsTestCase ();
+
+private:
+  virtual void DoRun (void);
+  bool CheckSweepPoint (Ptr<SimulationHelper> simulationHelper, uint64_t baseRun);
+  void SimulationEventCb ();
+
+  bool m_simulationRun;
+};
+
+SatSweepRunsTestCase::SatSweepRunsTestCase ()
+  : TestCase ("Test sweep runs of the simulation helper."),
+    m_simulationRun (false)
+{
+}
+
+SatSweepRunsTestCase::~SatSweepRunsTestCase ()
+{
+}
+
+void
+SatSweepRunsTestCase::SimulationEventCb ()
+{
+  m_simulationRun = true;
+}
+
+bool
+SatSweepRunsTestCase::CheckSweepPoint (Ptr<SimulationHelper> simulationHelper, uint64_t baseRun)
+{
+  Time expectedSimTime = Seconds (simulationHelper->GetSweepRunIndex () + 2);
+  Time expectedGuardTime = MicroSeconds (simulationHelper->GetSweepRunIndex () == 0 ? 2 : 1);
+
+  if (simulationHelper->GetSimTime () != expectedSimTime
+      || RngSeedManager::GetRun () != baseRun + simulationHelper->GetSweepRunIndex ()
+      || simulationHelper->GetSatelliteHelper ()->AssignStreams (0) == 0)
+    {
+      return false;
+    }
+
+  Config::MatchContainer utMacs = Config::LookupMatches ("/NodeList/*/DeviceList/*/SatMac/$ns3::SatUtMac");
+
+  if (utMacs.GetN () == 0)
+    {
+      return false;
+    }
+
+  for (Config::MatchContainer::Iterator it = utMacs.Begin (); it != utMacs.End (); ++it)
+    {
+      TimeValue guardTime;
+      (*it)->GetAttribute ("GuardTime", guardTime);
+
+      if (guardTime.Get () != expectedGuardTime)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+void
+SatSweepRunsTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-sweep", "sweep-runs", true);
+
+  std::string outputPath = Singleton<SatEnvVariables>::Get ()->GetOutputPath ();
+  std::string sweepFileName = outputPath + "/sweep-points.txt";
+
+  std::ofstream sweepFile (sweepFileName.c_str (), std::ofstream::out | std::ofstream::trunc);
+  sweepFile << "# sweep points of the test" << std::endl;
+  sweepFile << "SimTime=2s /NodeList/*/DeviceList/*/SatMac/$ns3::SatUtMac/GuardTime=2us" << std::endl;
+  sweepFile << std::endl;
+  sweepFile << "SimTime=3s" << std::endl;
+  sweepFile.close ();
+
+  uint64_t baseRun = RngSeedManager::GetRun ();
+
+  Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("test-sat-sweep");
+  simulationHelper->SetOutputPath (outputPath);
+  simulationHelper->SetSimulationTime (Seconds (1));
+  simulationHelper->SetBeams ("1");
+  simulationHelper->SetUtCountPerBeam (2);
+  simulationHelper->SetUserCountPerUt (1);
+  simulationHelper->EnableSweepRuns (sweepFileName, 2);
+
+  simulationHelper->CreateSatScenario ();
+
+  if (simulationHelper->GetSweepRunIndex () >= 0)
+    {
+      // worker process, report the result with the exit status
+      bool passed = CheckSweepPoint (simulationHelper, baseRun);
+      std::fflush (NULL);
+      _exit (passed ? 0 : 1);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (simulationHelper->HasFinishedSweepRuns (), true, "Sweep runs not finished");
+  NS_TEST_ASSERT_MSG_EQ (simulationHelper->GetFailedSweepRunCount (), 0, "Unexpected number of failed sweep runs");
+
+  std::ifstream summary ((outputPath + "/sweep-runs.txt").c_str ());
+  NS_TEST_ASSERT_MSG_EQ (summary.is_open (), true, "Sweep summary not written");
+
+  std::vector<int> exitStatus;
+  std::string line;
+
+  while (std::getline (summary, line))
+    {
+      std::istringstream iss (line);
+      uint32_t index;
+      int status;
+
+      if (iss >> index >> status)
+        {
+          NS_TEST_ASSERT_MSG_EQ (index, exitStatus.size (), "Sweep summary out of order");
+          exitStatus.push_back (status);
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (exitStatus.size (), 2, "Unexpected number of sweep points in summary");
+
+  if (exitStatus.size () == 2)
+    {
+      NS_TEST_ASSERT_MSG_EQ (exitStatus[0], 0, "Overrides of sweep point 0 not applied");
+      NS_TEST_ASSERT_MSG_EQ (exitStatus[1], 0, "Overrides of sweep point 1 not applied");
+    }
+
+  // the forking process does not simulate the sweep points again
+  Simulator::Schedule (Seconds (0.5), &SatSweepRunsTestCase::SimulationEventCb, this);
+  simulationHelper->RunSimulation ();
+  NS_TEST_ASSERT_MSG_EQ (m_simulationRun, false, "Simulation run in the forking process");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that an invalid sweep file fails before any
+ *        sweep run is forked and the error names the bad line.
+ *
+ *  1.  Write a sweep file with a valid sweep point on line 1 and an unknown
+ *      attribute of the UT MACs on line 3.
+ *  2.  Create the scenario with the sweep file in a child process with the
+ *      standard error redirected to a file.
+ *
+ *  Expected result:
+ *    The child process fails with an error naming line 3 of the sweep file,
+ *    and no sweep run is started.
+ */
+class SatSweepFileErrorTestCase : public TestCase
+{
+public:
+  SatSweepFileErrorTestCase ();
+  virtual ~SatSweepFileErrorTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SatSweepFileErrorTestCase::SatSweepFileErrorTestCase ()
+  : TestCase ("Test the line number in the error of an invalid sweep file.")
+{
+}
+
+SatSweepFileErrorTestCase::~SatSweepFileErrorTestCase ()
+{
+}
+
+void
+SatSweepFileErrorTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-sweep", "sweep-file-error", true);
+
+  std::string outputPath = Singleton<SatEnvVariables>::Get ()->GetOutputPath ();
+  std::string sweepFileName = outputPath + "/sweep-points.txt";
+  std::string errorFileName = outputPath + "/sweep-error.txt";
+
+  std::ofstream sweepFile (sweepFileName.c_str (), std::ofstream::out | std::ofstream::trunc);
+  sweepFile << "SimTime=2s" << std::endl;
+  sweepFile << "# the next sweep point is invalid" << std::endl;
+  sweepFile << "SimTime=3s /NodeList/*/DeviceList/*/SatMac/$ns3::SatUtMac/NoSuchAttribute=1" << std::endl;
+  sweepFile.close ();
+
+  std::fflush (NULL);
+  pid_t pid = fork ();
+
+  if (pid == 0)
+    {
+      FILE *errorFile = std::freopen (errorFileName.c_str (), "w", stderr);
+
+      if (errorFile == NULL)
+        {
+          _exit (0);
+        }
+
+      Ptr<SimulationHelper> simulationHelper = CreateObject<SimulationHelper> ("test-sat-sweep");
+      simulationHelper->SetOutputPath (outputPath);
+      simulationHelper->SetSimulationTime (Seconds (1));
+      simulationHelper->SetBeams ("1");
+      simulationHelper->SetUtCountPerBeam (1);
+      simulationHelper->SetUserCountPerUt (1);
+      simulationHelper->EnableSweepRuns (sweepFileName, 1);
+      simulationHelper->CreateSatScenario ();
+
+      // not reached with the invalid sweep file
+      std::fflush (NULL);
+      _exit (0);
+    }
+
+  NS_TEST_ASSERT_MSG_GT (pid, 0, "Unable to fork");
+
+  int status = 0;
+  waitpid (pid, &status, 0);
+
+  NS_TEST_ASSERT_MSG_EQ ((WIFEXITED (status) && WEXITSTATUS (status) == 0), false, "Invalid sweep file accepted");
+
+  std::ifstream errorFile (errorFileName.c_str ());
+  std::stringstream error;
+  error << errorFile.rdbuf ();
+
+  NS_TEST_ASSERT_MSG_NE (error.str ().find ("NoSuchAttribute=1 on line 3 of " + sweepFileName), std::string::npos,
+                         "Error does not name the bad line: " << error.str ());
+
+  std::ifstream summary ((outputPath + "/sweep-runs.txt").c_str ());
+  NS_TEST_ASSERT_MSG_EQ (summary.is_open (), false, "Sweep runs started with an invalid sweep file");
+  NS_TEST_ASSERT_MSG_EQ (Singleton<SatEnvVariables>::Get ()->IsValidDirectory (outputPath + "/sweep-0/"), false,
+                         "Sweep run forked with an invalid sweep file");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the sweep runs.
+ */
+class SatSweepTestSuite : public TestSuite
+{
+public:
+  SatSweepTestSuite ();
+};
+
+SatSweepTestSuite::SatSweepTestSuite ()
+  : TestSuite ("sat-sweep-test", SYSTEM)
+{
+  AddTestCase (new SatSweepRunsTestCase, TestCase::QUICK);
+  AddTestCase (new SatSweepFileErrorTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSweepTestSuite satSweepTest;
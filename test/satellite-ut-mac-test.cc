@@ -0,0 +1,502 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * \file satellite-ut-mac-test.cc
+ * \ingroup satellite
+ * \brief Test cases to check the event handling of the time slots and the
+ *        frame starts of the UT MAC.
+ */
+
+#include <map>
+#include <sstream>
+#include <vector>
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/map-scheduler.h"
+#include "ns3/object-factory.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/cbr-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "../helper/satellite-helper.h"
+#include "../model/satellite-net-device.h"
+#include "../model/satellite-llc.h"
+#include "../model/satellite-ut-mac.h"
+#include "ns3/singleton.h"
+#include "../utils/satellite-env-variables.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Event scheduler, which remembers the time when the event being
+ *        executed was scheduled.
+ */
+class SatScheduleTimeScheduler : public MapScheduler
+{
+public:
+  /**
+   * \brief Get the type ID
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  virtual void Insert (const Event &ev);
+  virtual Event RemoveNext (void);
+  virtual void Remove (const Event &ev);
+
+  /**
+   * \brief Get the time when the event being executed was scheduled.
+   * \return Schedule time of the current event
+   */
+  static Time GetCurrentScheduleTime ();
+
+private:
+  std::map<uint32_t, Time> m_scheduleTimes;
+  static Time m_currentScheduleTime;
+};
+
+NS_OBJECT_ENSURE_REGISTERED (SatScheduleTimeScheduler);
+
+Time SatScheduleTimeScheduler::m_currentScheduleTime = Seconds (0);
+
+TypeId
+SatScheduleTimeScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatScheduleTimeScheduler")
+    .SetParent<MapScheduler> ()
+    .AddConstructor<SatScheduleTimeScheduler> ()
+  ;
+  return tid;
+}
+
+void
+SatScheduleTimeScheduler::Insert (const Event &ev)
+{
+  m_scheduleTimes[ev.key.m_uid] = Simulator::Now ();
+  MapScheduler::Insert (ev);
+}
+
+Scheduler::Event
+SatScheduleTimeScheduler::RemoveNext (void)
+{
+  Event ev = MapScheduler::RemoveNext ();
+  std::map<uint32_t, Time>::iterator it = m_scheduleTimes.find (ev.key.m_uid);
+
+  if (it != m_scheduleTimes.end ())
+    {
+      m_currentScheduleTime = it->second;
+      m_scheduleTimes.erase (it);
+    }
+
+  return ev;
+}
+
+void
+SatScheduleTimeScheduler::Remove (const Event &ev)
+{
+  m_scheduleTimes.erase (ev.key.m_uid);
+  MapScheduler::Remove (ev);
+}
+
+Time
+SatScheduleTimeScheduler::GetCurrentScheduleTime ()
+{
+  return m_currentScheduleTime;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the slot schedule of the UT MAC keeps only
+ *        the event of the next time slot pending.
+ *
+ *  1.  Create a scenario with three UTs in one beam without random access,
+ *      each UT user sending CBR traffic to the GW user.
+ *  2.  Run the scenario with an event scheduler telling when the executed
+ *      event was scheduled, and check the events transmitting the DA time
+ *      slots of the UTs.
+ *
+ *  Expected result:
+ *    Each time slot of a UT is transmitted by an event scheduled at or after
+ *    the previous time slot of the UT, i.e. by the event of the previous
+ *    time slot or at the reception of a TBTP after it, and not at the
+ *    reception of the TBTP for all the time slots at once. Some time slots
+ *    are transmitted by the event of the previous time slot.
+ */
+class SatSlotScheduleTestCase : public TestCase
+{
+public:
+  SatSlotScheduleTestCase ();
+  virtual ~SatSlotScheduleTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                      SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                      SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo);
+
+  std::map<uint32_t, Time> m_lastSlotTime;
+  std::map<uint32_t, Time> m_previousSlotTime;
+  uint32_t m_slotCount;
+  uint32_t m_earlyScheduledSlotCount;
+  uint32_t m_slotScheduledSlotCount;
+};
+
+SatSlotScheduleTestCase::SatSlotScheduleTestCase ()
+  : TestCase ("Test that the UT MAC slot schedule keeps one time slot event pending."),
+    m_slotCount (0),
+    m_earlyScheduledSlotCount (0),
+    m_slotScheduledSlotCount (0)
+{
+}
+
+SatSlotScheduleTestCase::~SatSlotScheduleTestCase ()
+{
+}
+
+void
+SatSlotScheduleTestCase::PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                                        SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                                        SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo)
+{
+  if (eventType != SatEnums::PACKET_SENT || nodeType != SatEnums::NT_UT)
+    {
+      return;
+    }
+
+  // the packets of a burst are sent at the same time
+  if (m_lastSlotTime.find (nodeId) != m_lastSlotTime.end () && m_lastSlotTime[nodeId] == now)
+    {
+      return;
+    }
+
+  if (m_lastSlotTime.find (nodeId) != m_lastSlotTime.end ())
+    {
+      m_previousSlotTime[nodeId] = m_lastSlotTime[nodeId];
+    }
+
+  m_lastSlotTime[nodeId] = now;
+
+  if (m_previousSlotTime.find (nodeId) == m_previousSlotTime.end ())
+    {
+      return;
+    }
+
+  Time scheduleTime = SatScheduleTimeScheduler::GetCurrentScheduleTime ();
+  m_slotCount++;
+
+  if (scheduleTime < m_previousSlotTime[nodeId])
+    {
+      m_earlyScheduledSlotCount++;
+    }
+  else if (scheduleTime == m_previousSlotTime[nodeId])
+    {
+      m_slotScheduledSlotCount++;
+    }
+}
+
+void
+SatSlotScheduleTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-ut-mac", "slot-schedule", true);
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatBeamHelper::RandomAccessModel", EnumValue (SatEnums::RA_MODEL_OFF));
+
+  ObjectFactory schedulerFactory;
+  schedulerFactory.SetTypeId ("ns3::SatScheduleTimeScheduler");
+  Simulator::SetScheduler (schedulerFactory);
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+
+  std::map<uint32_t, SatBeamUserInfo > beamMap;
+  beamMap[1] = SatBeamUserInfo (3, 1);
+  helper->CreateUserDefinedScenario (beamMap);
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatMac/PacketTrace",
+                   MakeCallback (&SatSlotScheduleTestCase::PacketTraceCb, this));
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9;
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  ApplicationContainer gwApps = sink.Install (gwUsers.Get (0));
+  gwApps.Start (Seconds (0.5));
+  gwApps.Stop (Seconds (2.0));
+
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("10ms"));
+  cbr.SetAttribute ("PacketSize", UintegerValue (512));
+
+  ApplicationContainer utApps = cbr.Install (utUsers.Get (0));
+  cbr.SetAttribute ("Interval", StringValue ("3ms"));
+  utApps.Add (cbr.Install (utUsers.Get (1)));
+  cbr.SetAttribute ("Interval", StringValue ("7ms"));
+  utApps.Add (cbr.Install (utUsers.Get (2)));
+  utApps.Start (Seconds (0.5));
+  utApps.Stop (Seconds (1.5));
+
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_NE (m_slotCount, 0, "No time slots transmitted by the UTs");
+  NS_TEST_ASSERT_MSG_EQ (m_earlyScheduledSlotCount, 0, "Time slot events scheduled before the previous time slot");
+  NS_TEST_ASSERT_MSG_NE (m_slotScheduledSlotCount, 0, "No time slot event scheduled by the previous time slot");
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to check that the UT MAC stops the CRDSA frame starts
+ *        while its buffers are idle and resumes them when traffic arrives.
+ *
+ *  1.  Create a simple scenario with CRDSA enabled for the user data. The
+ *      UT user sends three bursts of CBR traffic separated by idle periods.
+ *  2.  Count the frame starts of the UT MAC through its buffers idle
+ *      callback, which is checked at every frame start, and the packets
+ *      enqueued to the UT LLC and sent by the UT PHY.
+ *
+ *  Expected result:
+ *    The frame starts stop at least once after each burst, when the buffers
+ *    are idle. No frame start is executed after a stop until a packet is
+ *    enqueued again. The UT sends packets during each burst.
+ */
+class SatCrdsaFrameStartTestCase : public TestCase
+{
+public:
+  SatCrdsaFrameStartTestCase ();
+  virtual ~SatCrdsaFrameStartTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                      SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                      SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo);
+  bool BuffersIdleCb ();
+
+  Ptr<SatLlc> m_utLlc;
+  bool m_frameStartsStopped;
+  uint32_t m_frameStartCount;
+  uint32_t m_idleFrameStartCount;
+  uint32_t m_stoppedFrameStartCount;
+  std::vector<Time> m_burstStartTimes;
+  std::vector<uint32_t> m_burstSentCounts;
+};
+
+SatCrdsaFrameStartTestCase::SatCrdsaFrameStartTestCase ()
+  : TestCase ("Test UT MAC CRDSA frame starts stopped during idle buffers."),
+    m_frameStartsStopped (false),
+    m_frameStartCount (0),
+    m_idleFrameStartCount (0),
+    m_stoppedFrameStartCount (0)
+{
+}
+
+SatCrdsaFrameStartTestCase::~SatCrdsaFrameStartTestCase ()
+{
+}
+
+void
+SatCrdsaFrameStartTestCase::PacketTraceCb (std::string context, Time now, SatEnums::SatPacketEvent_t eventType,
+                                           SatEnums::SatNodeType_t nodeType, uint32_t nodeId, Mac48Address macAddress,
+                                           SatEnums::SatLogLevel_t logLevel, SatEnums::SatLinkDir_t linkDir, std::string packetInfo)
+{
+  if (nodeType != SatEnums::NT_UT)
+    {
+      return;
+    }
+
+  if (eventType == SatEnums::PACKET_ENQUE)
+    {
+      // the enqueued packet resumes the frame starts
+      m_frameStartsStopped = false;
+    }
+  else if (eventType == SatEnums::PACKET_SENT && logLevel == SatEnums::LL_PHY)
+    {
+      for (uint32_t i = m_burstStartTimes.size (); i > 0; i--)
+        {
+          if (now >= m_burstStartTimes[i - 1])
+            {
+              m_burstSentCounts[i - 1]++;
+              break;
+            }
+        }
+    }
+}
+
+bool
+SatCrdsaFrameStartTestCase::BuffersIdleCb ()
+{
+  // the callback is checked once at every frame start
+  m_frameStartCount++;
+
+  if (m_frameStartsStopped)
+    {
+      m_stoppedFrameStartCount++;
+    }
+
+  bool idle = m_utLlc->BuffersIdle ();
+
+  if (idle)
+    {
+      m_idleFrameStartCount++;
+      m_frameStartsStopped = true;
+    }
+
+  return idle;
+}
+
+void
+SatCrdsaFrameStartTestCase::DoRun (void)
+{
+  Singleton<SatEnvVariables>::Get ()->DoInitialize ();
+  Singleton<SatEnvVariables>::Get ()->SetOutputVariables ("test-sat-ut-mac", "crdsa-frame-start", true);
+
+  SatPhyRxCarrierConf::ErrorModel em (SatPhyRxCarrierConf::EM_NONE);
+  Config::SetDefault ("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue (em));
+  Config::SetDefault ("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue (em));
+
+  // CRDSA for the user data without dedicated access
+  Config::SetDefault ("ns3::SatBeamHelper::RandomAccessModel", EnumValue (SatEnums::RA_MODEL_RCS2_SPECIFICATION));
+  Config::SetDefault ("ns3::SatBeamHelper::RaInterferenceModel", EnumValue (SatPhyRxCarrierConf::IF_PER_PACKET));
+  Config::SetDefault ("ns3::SatBeamHelper::RaCollisionModel", EnumValue (SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR));
+  Config::SetDefault ("ns3::SatBeamScheduler::ControlSlotsEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::SatPhyRxCarrierConf::EnableRandomAccessDynamicLoadControl", BooleanValue (false));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MaximumUniquePayloadPerBlock", UintegerValue (3));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MaximumConsecutiveBlockAccessed", UintegerValue (6));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_MinimumIdleBlock", UintegerValue (2));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_BackOffTimeInMilliSeconds", UintegerValue (250));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_BackOffProbability", UintegerValue (1));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_HighLoadBackOffProbability", UintegerValue (1));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_NumberOfInstances", UintegerValue (3));
+  Config::SetDefault ("ns3::SatLowerLayerServiceConf::RaService0_AverageNormalizedOfferedLoadThreshold", DoubleValue (0.5));
+  Config::SetDefault ("ns3::SatRandomAccessConf::CrdsaSignalingOverheadInBytes", UintegerValue (5));
+
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      std::ostringstream service;
+      service << "ns3::SatLowerLayerServiceConf::DaService" << i << "_";
+      Config::SetDefault (service.str () + "ConstantAssignmentProvided", BooleanValue (false));
+      Config::SetDefault (service.str () + "RbdcAllowed", BooleanValue (false));
+      Config::SetDefault (service.str () + "VolumeAllowed", BooleanValue (false));
+    }
+
+  Ptr<SatHelper> helper = CreateObject<SatHelper> ("Scenario72");
+  helper->CreatePredefinedScenario (SatHelper::SIMPLE);
+
+  // count the frame starts through the buffers idle callback of the UT MAC
+  Config::MatchContainer devices = Config::LookupMatches ("/NodeList/*/DeviceList/*/$ns3::SatNetDevice");
+
+  for (Config::MatchContainer::Iterator it = devices.Begin (); it != devices.End (); ++it)
+    {
+      Ptr<SatNetDevice> device = DynamicCast<SatNetDevice> (*it);
+      Ptr<SatUtMac> utMac = DynamicCast<SatUtMac> (device->GetMac ());
+
+      if (utMac != NULL)
+        {
+          NS_TEST_ASSERT_MSG_EQ ((m_utLlc == NULL), true, "More than one UT in the scenario");
+          m_utLlc = device->GetLlc ();
+          utMac->SetBuffersIdleCallback (MakeCallback (&SatCrdsaFrameStartTestCase::BuffersIdleCb, this));
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((m_utLlc != NULL), true, "No UT in the scenario");
+
+  Config::Connect ("/NodeList/*/DeviceList/*/SatLlc/PacketTrace",
+                   MakeCallback (&SatCrdsaFrameStartTestCase::PacketTraceCb, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/SatPhy/PacketTrace",
+                   MakeCallback (&SatCrdsaFrameStartTestCase::PacketTraceCb, this));
+
+  NodeContainer gwUsers = helper->GetGwUsers ();
+  NodeContainer utUsers = helper->GetUtUsers ();
+
+  uint16_t port = 9;
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  ApplicationContainer gwApps = sink.Install (gwUsers.Get (0));
+  gwApps.Start (Seconds (0.5));
+  gwApps.Stop (Seconds (4.0));
+
+  // bursts of traffic separated by idle periods of several superframes
+  CbrHelper cbr ("ns3::UdpSocketFactory", Address (InetSocketAddress (helper->GetUserAddress (gwUsers.Get (0)), port)));
+  cbr.SetAttribute ("Interval", StringValue ("20ms"));
+  cbr.SetAttribute ("PacketSize", UintegerValue (64));
+
+  Time burstTimes[3][2] = { { Seconds (0.5), Seconds (0.6) },
+                            { Seconds (1.3), Seconds (1.45) },
+                            { Seconds (2.71), Seconds (2.8) } };
+
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      ApplicationContainer burst = cbr.Install (utUsers.Get (0));
+      burst.Start (burstTimes[i][0]);
+      burst.Stop (burstTimes[i][1]);
+
+      m_burstStartTimes.push_back (burstTimes[i][0]);
+      m_burstSentCounts.push_back (0);
+    }
+
+  Simulator::Stop (Seconds (4.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_NE (m_frameStartCount, 0, "No frame starts");
+  NS_TEST_ASSERT_MSG_GT (m_idleFrameStartCount, 2, "Frame starts not stopped after each burst");
+  NS_TEST_ASSERT_MSG_EQ (m_stoppedFrameStartCount, 0, "Frame starts executed while stopped");
+
+  for (uint32_t i = 0; i < m_burstSentCounts.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_NE (m_burstSentCounts[i], 0, "Nothing sent by the UT in burst " << i);
+    }
+
+  m_utLlc = NULL;
+
+  Singleton<SatEnvVariables>::Get ()->DoDispose ();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test suite for the UT MAC.
+ */
+class SatUtMacTestSuite : public TestSuite
+{
+public:
+  SatUtMacTestSuite ();
+};
+
+SatUtMacTestSuite::SatUtMacTestSuite ()
+  : TestSuite ("sat-ut-mac-test", SYSTEM)
+{
+  AddTestCase (new SatSlotScheduleTestCase, TestCase::QUICK);
+  AddTestCase (new SatCrdsaFrameStartTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatUtMacTestSuite satUtMacTest;
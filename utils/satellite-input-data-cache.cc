@@ -0,0 +1,494 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/singleton.h"
+#include "satellite-env-variables.h"
+#include "satellite-input-data-cache.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatInputDataCache");
+
+namespace ns3 {
+
+/// Identifier in the beginning of the cache file.
+static const char SAT_INPUT_DATA_CACHE_MAGIC[8] = { 'S', 'N', 'S', '3', 'D', 'A', 'T', 'A' };
+
+/// Version of the cache file format, increment when the format changes.
+static const uint32_t SAT_INPUT_DATA_CACHE_VERSION = 1;
+
+/// Written in native byte order to detect cache files created on other architectures.
+static const uint32_t SAT_INPUT_DATA_CACHE_BYTE_ORDER = 0x01020304;
+
+/// Cache file header.
+typedef struct
+{
+  char m_magic[8];
+  uint32_t m_version;
+  uint32_t m_byteOrder;
+  uint32_t m_entryCount;
+  uint32_t m_reserved;
+} SatInputDataCacheHeader_t;
+
+/// Header of one table in the cache file, followed by the key and the values.
+typedef struct
+{
+  uint32_t m_keyLength;
+  uint32_t m_rows;
+  uint32_t m_columns;
+  uint32_t m_reserved;
+  uint64_t m_sourceSize;
+  int64_t m_sourceTime;
+} SatInputDataCacheEntryHeader_t;
+
+/// Alignment of the headers and the values in the cache file.
+static const size_t SAT_INPUT_DATA_CACHE_ALIGNMENT = 8;
+
+static size_t
+SatInputDataCacheAlign (size_t length)
+{
+  return (length + SAT_INPUT_DATA_CACHE_ALIGNMENT - 1) / SAT_INPUT_DATA_CACHE_ALIGNMENT * SAT_INPUT_DATA_CACHE_ALIGNMENT;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (SatInputDataCache);
+
+TypeId
+SatInputDataCache::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SatInputDataCache")
+    .SetParent<Object> ()
+    .AddConstructor<SatInputDataCache> ()
+    .AddAttribute ("Enabled",
+                   "Use the binary input data cache file, if it is found.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SatInputDataCache::m_enabled),
+                   MakeBooleanChecker ())
+    .AddAttribute ("FileName",
+                   "Name of the binary input data cache file within the data folder, or an absolute path to it.",
+                   StringValue ("inputdatacache.bin"),
+                   MakeStringAccessor (&SatInputDataCache::m_fileName),
+                   MakeStringChecker ());
+  return tid;
+}
+
+TypeId
+SatInputDataCache::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+SatInputDataCache::SatInputDataCache ()
+  : m_enabled (true),
+    m_fileName ("inputdatacache.bin"),
+    m_isLoadTried (false),
+    m_data (0),
+    m_dataSize (0)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Attributes are needed already in construction phase:
+  // - ConstructSelf call in constructor
+  // - GetInstanceTypeId needs to be implemented
+  ObjectBase::ConstructSelf (AttributeConstructionList ());
+}
+
+SatInputDataCache::~SatInputDataCache ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Unload ();
+}
+
+void
+SatInputDataCache::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Unload ();
+  m_isLoadTried = false;
+
+  Object::DoDispose ();
+}
+
+bool
+SatInputDataCache::IsLoaded ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_isLoadTried)
+    {
+      Load ();
+    }
+
+  return (m_data != 0);
+}
+
+const double *
+SatInputDataCache::GetTable (std::string filePathName, uint32_t &rows, uint32_t &columns)
+{
+  NS_LOG_FUNCTION (this << filePathName);
+
+  if (!IsLoaded ())
+    {
+      return 0;
+    }
+
+  std::map<std::string, CacheEntry_t>::const_iterator it = m_entries.find (GetKey (filePathName));
+
+  if (it == m_entries.end ())
+    {
+      NS_LOG_INFO ("SatInputDataCache::GetTable - " << filePathName << " not found from the cache");
+      return 0;
+    }
+
+  // the key does not identify the file alone, thus the text file must exist
+  // and it has precedence, if it has changed after the conversion
+  struct stat st;
+
+  if (stat (filePathName.c_str (), &st) != 0)
+    {
+      NS_LOG_INFO ("SatInputDataCache::GetTable - " << filePathName << " not found, cache not used");
+      return 0;
+    }
+
+  if ((static_cast<uint64_t> (st.st_size) != it->second.m_sourceSize)
+      || (static_cast<int64_t> (st.st_mtime) != it->second.m_sourceTime))
+    {
+      NS_LOG_WARN ("SatInputDataCache::GetTable - " << filePathName << " has changed after creating the cache, cache not used");
+      return 0;
+    }
+
+  rows = it->second.m_rows;
+  columns = it->second.m_columns;
+
+  return it->second.m_values;
+}
+
+void
+SatInputDataCache::Load ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_isLoadTried = true;
+
+  if (!m_enabled)
+    {
+      return;
+    }
+
+  std::string cacheFilePathName = m_fileName;
+
+  if (cacheFilePathName.empty () || cacheFilePathName[0] != '/')
+    {
+      cacheFilePathName = Singleton<SatEnvVariables>::Get ()->LocateDataDirectory () + "/" + m_fileName;
+    }
+
+  int fd = open (cacheFilePathName.c_str (), O_RDONLY);
+
+  if (fd < 0)
+    {
+      NS_LOG_INFO ("SatInputDataCache::Load - Cache file " << cacheFilePathName << " not found, using text input files");
+      return;
+    }
+
+  struct stat st;
+
+  if ((fstat (fd, &st) != 0) || (static_cast<size_t> (st.st_size) < sizeof (SatInputDataCacheHeader_t)))
+    {
+      NS_LOG_WARN ("SatInputDataCache::Load - Invalid cache file " << cacheFilePathName);
+      close (fd);
+      return;
+    }
+
+  size_t dataSize = st.st_size;
+  void *data = mmap (0, dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+
+  if (data == MAP_FAILED)
+    {
+      NS_LOG_WARN ("SatInputDataCache::Load - Could not map cache file " << cacheFilePathName);
+      return;
+    }
+
+  const char *begin = static_cast<const char *> (data);
+  SatInputDataCacheHeader_t header;
+  std::memcpy (&header, begin, sizeof (header));
+
+  if ((std::memcmp (header.m_magic, SAT_INPUT_DATA_CACHE_MAGIC, sizeof (header.m_magic)) != 0)
+      || (header.m_version != SAT_INPUT_DATA_CACHE_VERSION)
+      || (header.m_byteOrder != SAT_INPUT_DATA_CACHE_BYTE_ORDER))
+    {
+      NS_LOG_WARN ("SatInputDataCache::Load - Incompatible cache file " << cacheFilePathName << ", re-create it with the converter");
+      munmap (data, dataSize);
+      return;
+    }
+
+  size_t offset = sizeof (header);
+
+  for (uint32_t i = 0; i < header.m_entryCount; i++)
+    {
+      SatInputDataCacheEntryHeader_t entryHeader;
+
+      if (offset + sizeof (entryHeader) > dataSize)
+        {
+          break;
+        }
+
+      std::memcpy (&entryHeader, begin + offset, sizeof (entryHeader));
+      offset += sizeof (entryHeader);
+
+      size_t keyLength = SatInputDataCacheAlign (entryHeader.m_keyLength);
+      size_t valuesLength = static_cast<size_t> (entryHeader.m_rows) * entryHeader.m_columns * sizeof (double);
+
+      if (offset + keyLength + valuesLength > dataSize)
+        {
+          break;
+        }
+
+      std::string key (begin + offset, entryHeader.m_keyLength);
+      offset += keyLength;
+
+      CacheEntry_t entry;
+      entry.m_values = reinterpret_cast<const double *> (begin + offset);
+      entry.m_rows = entryHeader.m_rows;
+      entry.m_columns = entryHeader.m_columns;
+      entry.m_sourceSize = entryHeader.m_sourceSize;
+      entry.m_sourceTime = entryHeader.m_sourceTime;
+      offset += valuesLength;
+
+      m_entries[key] = entry;
+    }
+
+  if (m_entries.size () != header.m_entryCount)
+    {
+      NS_LOG_WARN ("SatInputDataCache::Load - Truncated cache file " << cacheFilePathName);
+      m_entries.clear ();
+      munmap (data, dataSize);
+      return;
+    }
+
+  m_data = data;
+  m_dataSize = dataSize;
+
+  NS_LOG_INFO ("SatInputDataCache::Load - Loaded " << m_entries.size () << " tables from " << cacheFilePathName);
+}
+
+void
+SatInputDataCache::Unload ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_entries.clear ();
+
+  if (m_data != 0)
+    {
+      munmap (m_data, m_dataSize);
+      m_data = 0;
+      m_dataSize = 0;
+    }
+}
+
+std::string
+SatInputDataCache::GetKey (std::string filePathName)
+{
+  std::vector<std::string> components;
+  std::istringstream iss (filePathName);
+  std::string component;
+
+  while (std::getline (iss, component, '/'))
+    {
+      if (!component.empty () && component != ".")
+        {
+          components.push_back (component);
+        }
+    }
+
+  if (components.empty ())
+    {
+      return "";
+    }
+  else if (components.size () == 1)
+    {
+      return components.back ();
+    }
+
+  return components[components.size () - 2] + "/" + components.back ();
+}
+
+bool
+SatInputDataCache::ReadTextTable (std::string filePathName, std::vector<double> &values, uint32_t &columns)
+{
+  NS_LOG_FUNCTION (filePathName);
+
+  std::ifstream ifs (filePathName.c_str (), std::ifstream::in);
+
+  if (!ifs.is_open ())
+    {
+      return false;
+    }
+
+  values.clear ();
+  columns = 0;
+
+  std::string line;
+
+  while (std::getline (ifs, line))
+    {
+      std::istringstream iss (line);
+      std::string token;
+      uint32_t rowColumns = 0;
+
+      while (iss >> token)
+        {
+          std::string::size_type slash = token.find ('/');
+          std::vector<std::string> parts;
+
+          if (slash == std::string::npos)
+            {
+              parts.push_back (token);
+            }
+          else
+            {
+              parts.push_back (token.substr (0, slash));
+              parts.push_back (token.substr (slash + 1));
+            }
+
+          for (std::vector<std::string>::const_iterator it = parts.begin (); it != parts.end (); ++it)
+            {
+              char *end = 0;
+              double value = std::strtod (it->c_str (), &end);
+
+              if (it->empty () || *end != '\0')
+                {
+                  NS_LOG_INFO ("SatInputDataCache::ReadTextTable - " << filePathName << " is not a numeric table");
+                  return false;
+                }
+
+              values.push_back (value);
+              rowColumns++;
+            }
+        }
+
+      if (rowColumns == 0)
+        {
+          continue;
+        }
+
+      if (columns == 0)
+        {
+          columns = rowColumns;
+        }
+      else if (columns != rowColumns)
+        {
+          NS_LOG_INFO ("SatInputDataCache::ReadTextTable - " << filePathName << " has rows of different length");
+          return false;
+        }
+    }
+
+  return (columns > 0);
+}
+
+uint32_t
+SatInputDataCache::WriteCacheFile (std::string cacheFilePathName, const std::vector<std::string> &filePathNames)
+{
+  NS_LOG_FUNCTION (cacheFilePathName);
+
+  std::ofstream ofs (cacheFilePathName.c_str (), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+  if (!ofs.is_open ())
+    {
+      NS_FATAL_ERROR ("SatInputDataCache::WriteCacheFile - Could not create " << cacheFilePathName);
+    }
+
+  SatInputDataCacheHeader_t header;
+  std::memset (&header, 0, sizeof (header));
+  std::memcpy (header.m_magic, SAT_INPUT_DATA_CACHE_MAGIC, sizeof (header.m_magic));
+  header.m_version = SAT_INPUT_DATA_CACHE_VERSION;
+  header.m_byteOrder = SAT_INPUT_DATA_CACHE_BYTE_ORDER;
+
+  // entry count is updated when all files have been converted
+  ofs.write (reinterpret_cast<const char *> (&header), sizeof (header));
+
+  std::map<std::string, std::string> writtenKeys;
+  const char padding[SAT_INPUT_DATA_CACHE_ALIGNMENT] = { 0 };
+
+  for (std::vector<std::string>::const_iterator it = filePathNames.begin (); it != filePathNames.end (); ++it)
+    {
+      std::vector<double> values;
+      uint32_t columns = 0;
+      struct stat st;
+
+      if ((stat (it->c_str (), &st) != 0) || !ReadTextTable (*it, values, columns))
+        {
+          NS_LOG_INFO ("SatInputDataCache::WriteCacheFile - Skipping " << *it);
+          continue;
+        }
+
+      std::string key = GetKey (*it);
+
+      if (writtenKeys.find (key) != writtenKeys.end ())
+        {
+          NS_FATAL_ERROR ("SatInputDataCache::WriteCacheFile - " << *it << " and " << writtenKeys[key] << " have the same key " << key);
+        }
+
+      writtenKeys[key] = *it;
+
+      SatInputDataCacheEntryHeader_t entryHeader;
+      std::memset (&entryHeader, 0, sizeof (entryHeader));
+      entryHeader.m_keyLength = key.size ();
+      entryHeader.m_rows = values.size () / columns;
+      entryHeader.m_columns = columns;
+      entryHeader.m_sourceSize = st.st_size;
+      entryHeader.m_sourceTime = st.st_mtime;
+
+      ofs.write (reinterpret_cast<const char *> (&entryHeader), sizeof (entryHeader));
+      ofs.write (key.data (), key.size ());
+      ofs.write (padding, SatInputDataCacheAlign (key.size ()) - key.size ());
+      ofs.write (reinterpret_cast<const char *> (&values[0]), values.size () * sizeof (double));
+
+      header.m_entryCount++;
+
+      NS_LOG_INFO ("SatInputDataCache::WriteCacheFile - Converted " << *it << " as " << key
+                                                                     << " (" << entryHeader.m_rows << " x " << columns << ")");
+    }
+
+  ofs.seekp (0);
+  ofs.write (reinterpret_cast<const char *> (&header), sizeof (header));
+
+  if (!ofs.good ())
+    {
+      NS_FATAL_ERROR ("SatInputDataCache::WriteCacheFile - Error writing " << cacheFilePathName);
+    }
+
+  ofs.close ();
+
+  return header.m_entryCount;
+}
+
+} // namespace ns3
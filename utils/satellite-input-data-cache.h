@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SATELLITE_INPUT_DATA_CACHE_H
+#define SATELLITE_INPUT_DATA_CACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "ns3/object.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Binary cache of the numeric text input files of the satellite module,
+ * i.e., link results, waveform configuration, beam configuration and position
+ * files.
+ *
+ * The cache file is created once with WriteCacheFile (see
+ * sat-input-data-cache-converter example) and it contains all converted files
+ * as row-major tables of doubles. At the first lookup, the cache file is
+ * memory mapped and the tables are used directly from the mapping, so the
+ * per-value text parsing of the input files is avoided at simulation startup.
+ *
+ * The input files are identified by their parent directory and file name, e.g.
+ * "linkresults/s2_qpsk_1_to_2.txt". Since the key alone does not identify the
+ * file, a cached table is used only if the text file exists and its size and
+ * modification time still match the converted one. Otherwise, or if the cache
+ * file is not present at all, the loaders fall back to reading the text files.
+ *
+ * The class is meant to be used as singleton through Singleton<SatInputDataCache>.
+ */
+class SatInputDataCache : public Object
+{
+public:
+  /**
+   * \brief NS-3 function for type id
+   * \return type id
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Get the type ID of instance
+   * \return the object TypeId
+   */
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  /**
+   * \brief Constructor
+   */
+  SatInputDataCache ();
+
+  /**
+   * \brief Destructor
+   */
+  ~SatInputDataCache ();
+
+  /**
+   * \brief Get the table converted from the given text input file.
+   * \param filePathName path to the text input file
+   * \param rows variable to store the number of rows of the table
+   * \param columns variable to store the number of columns of the table
+   * \return pointer to the row-major table values, or NULL if the file is not
+   *         in the cache, does not exist or its cache entry is outdated
+   */
+  const double * GetTable (std::string filePathName, uint32_t &rows, uint32_t &columns);
+
+  /**
+   * \brief Check if the cache file has been found and loaded.
+   * \return true if the cache file is in use
+   */
+  bool IsLoaded ();
+
+  /**
+   * \brief Convert numeric text input files into a binary cache file.
+   * Files which are not numeric tables are skipped.
+   * \param cacheFilePathName path to the cache file to create
+   * \param filePathNames paths to the text input files to convert
+   * \return number of converted files
+   */
+  static uint32_t WriteCacheFile (std::string cacheFilePathName, const std::vector<std::string> &filePathNames);
+
+  /**
+   * \brief Read a numeric text table. Each non-empty line is one row and each
+   * whitespace separated token is one column, except that fraction tokens,
+   * e.g. coding rate "1/3", are stored as two columns (numerator and denominator).
+   * \param filePathName path to the text file
+   * \param values vector to store the row-major table values
+   * \param columns variable to store the number of columns
+   * \return false if the file is not found or is not a numeric table
+   */
+  static bool ReadTextTable (std::string filePathName, std::vector<double> &values, uint32_t &columns);
+
+  /**
+   * \brief Get the key identifying an input file in the cache.
+   * \param filePathName path to the input file
+   * \return parent directory and file name of the path, e.g. "linkresults/s2_qpsk_1_to_2.txt"
+   */
+  static std::string GetKey (std::string filePathName);
+
+  /**
+   * \brief Reset class, the cache file is loaded again at the next lookup
+   * NOTICE: this function is meant to be used only in test cases, where issues with singletons might arise.
+   */
+  virtual void DoDispose ();
+
+private:
+  /**
+   * \brief Table stored in the cache file.
+   */
+  typedef struct
+  {
+    const double *m_values;
+    uint32_t m_rows;
+    uint32_t m_columns;
+    uint64_t m_sourceSize;
+    int64_t m_sourceTime;
+  } CacheEntry_t;
+
+  /**
+   * \brief Locate and map the cache file and read its table directory.
+   */
+  void Load ();
+
+  /**
+   * \brief Unmap the cache file.
+   */
+  void Unload ();
+
+  /**
+   * \brief Is the cache used
+   */
+  bool m_enabled;
+
+  /**
+   * \brief Name of the cache file within the data directory, or an absolute path
+   */
+  std::string m_fileName;
+
+  /**
+   * \brief Has loading of the cache file been tried
+   */
+  bool m_isLoadTried;
+
+  /**
+   * \brief Start of the memory mapped cache file, NULL if not mapped
+   */
+  void *m_data;
+
+  /**
+   * \brief Size of the memory mapped cache file
+   */
+  size_t m_dataSize;
+
+  /**
+   * \brief Tables of the cache file by their keys
+   */
+  std::map<std::string, CacheEntry_t> m_entries;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_INPUT_DATA_CACHE_H */
@@ -39,7 +39,7 @@ SatInputFileStreamTimeDoubleContainer::GetTypeId (void)
 SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer (std::string filename, std::ios::openmode filemode, uint32_t valuesInRow)
   : m_inputFileStreamWrapper (),
     m_inputFileStream (),
-    m_container (),
+    m_columns (),
     m_fileName (filename),
     m_fileMode (filemode),
     m_valuesInRow (valuesInRow),
@@ -56,7 +56,7 @@ SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer (st
 SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer ()
   : m_inputFileStreamWrapper (),
     m_inputFileStream (),
-    m_container (),
+    m_columns (),
     m_fileName (),
     m_fileMode (),
     m_valuesInRow (),
@@ -99,13 +99,18 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer (std::string filename, st
   m_inputFileStreamWrapper = new SatInputFileStreamWrapper (filename,filemode);
   m_inputFileStream = m_inputFileStreamWrapper->GetStream ();
 
+  m_columns.resize (m_valuesInRow);
+
   if (m_inputFileStream->is_open ())
     {
       std::vector<double> tempVector = ReadRow ();
 
       while (!m_inputFileStream->eof ())
         {
-          m_container.push_back (tempVector);
+          for (uint32_t i = 0; i < m_valuesInRow; i++)
+            {
+              m_columns[i].push_back (tempVector[i]);
+            }
           tempVector = ReadRow ();
         }
       m_inputFileStream->close ();
@@ -141,29 +146,33 @@ SatInputFileStreamTimeDoubleContainer::CheckContainerSanity ()
 {
   NS_LOG_FUNCTION (this);
 
+  NS_ASSERT (m_timeColumn < m_valuesInRow);
+
+  uint32_t sampleCount = GetSampleCount ();
+
   /// check time sample sanity
-  if (m_container.size () < 1)
+  if (sampleCount < 1)
     {
       NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Empty file");
     }
-  else if (m_container.size () == 1)
+  else if (sampleCount == 1)
     {
-      if (m_container[m_container.size () - 1].at (m_timeColumn) == 0)
+      if (GetSampleTime (sampleCount - 1) == 0)
         {
           NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input file format (time sample error)");
         }
     }
   else
     {
-      double tempValue1 = m_container[0].at (m_timeColumn);
+      double tempValue1 = GetSampleTime (0);
 
-      for (uint32_t i = 1; i < m_container.size (); i++)
+      for (uint32_t i = 1; i < sampleCount; i++)
         {
-          if (tempValue1 > m_container[i].at (m_timeColumn))
+          if (tempValue1 > GetSampleTime (i))
             {
               NS_FATAL_ERROR ("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input file format (time sample error)");
             }
-          tempValue1 = m_container[i].at (m_timeColumn);
+          tempValue1 = GetSampleTime (i);
         }
     }
 }
@@ -173,11 +182,41 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample ()
 {
   NS_LOG_FUNCTION (this);
 
+  uint32_t row = FindNextClosestTimeSample ();
+
+  std::vector<double> values (m_valuesInRow);
+
+  for (uint32_t i = 0; i < m_valuesInRow; i++)
+    {
+      values[i] = m_columns[i][row];
+    }
+
+  return values;
+}
+
+double
+SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample (uint32_t column)
+{
+  NS_LOG_FUNCTION (this << column);
+
+  if (column >= m_valuesInRow)
+    {
+      NS_FATAL_ERROR ("SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample - column " << column << " out of range");
+    }
+
+  return m_columns[column][FindNextClosestTimeSample ()];
+}
+
+uint32_t
+SatInputFileStreamTimeDoubleContainer::FindNextClosestTimeSample ()
+{
+  NS_LOG_FUNCTION (this);
+
   while (!FindNextClosest (m_lastValidPosition,m_timeShiftValue, Now ().GetSeconds ()))
     {
       m_lastValidPosition = 0;
       m_numOfPasses++;
-      m_timeShiftValue = m_numOfPasses * m_container[m_container.size () - 1].at (m_timeColumn);
+      m_timeShiftValue = m_numOfPasses * GetSampleTime (GetSampleCount () - 1);
 
       NS_LOG_INFO ("Looping samples again with shift value: " << m_timeShiftValue);
     }
@@ -188,7 +227,7 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample ()
       std::cout << "The container will loop samples from the beginning." << std::endl;
     }
 
-  return m_container[m_lastValidPosition];
+  return m_lastValidPosition;
 }
 
 bool
@@ -196,20 +235,23 @@ SatInputFileStreamTimeDoubleContainer::FindNextClosest (uint32_t lastValidPositi
 {
   NS_LOG_FUNCTION (this);
 
+  uint32_t sampleCount = GetSampleCount ();
+
   NS_ASSERT (m_timeColumn < m_valuesInRow);
-  NS_ASSERT (m_container.size () > 0);
-  NS_ASSERT (lastValidPosition >= 0 && lastValidPosition < m_container.size ());
+  NS_ASSERT (sampleCount > 0);
+  NS_ASSERT (lastValidPosition >= 0 && lastValidPosition < sampleCount);
 
   NS_LOG_INFO ("SatInputFileStreamDoubleContainer::FindNextClosest: lastValidPosition " << lastValidPosition << " column " << m_timeColumn << " timeShiftValue " << timeShiftValue << " comparisonTimeValue " << comparisonTimeValue);
 
+  const std::vector<double> &times = m_columns[m_timeColumn];
   bool valueFound = false;
 
-  for (uint32_t i = lastValidPosition; i < m_container.size (); i++)
+  for (uint32_t i = lastValidPosition; i < sampleCount; i++)
     {
-      if (m_container[i].at (m_timeColumn) + timeShiftValue >= comparisonTimeValue)
+      if (times[i] + timeShiftValue >= comparisonTimeValue)
         {
-          double difference1 = std::abs (m_container[lastValidPosition].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
-          double difference2 = std::abs (m_container[i].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
+          double difference1 = std::abs (times[lastValidPosition] + timeShiftValue - comparisonTimeValue);
+          double difference2 = std::abs (times[i] + timeShiftValue - comparisonTimeValue);
 
           if (difference1 < difference2)
             {
@@ -227,18 +269,18 @@ SatInputFileStreamTimeDoubleContainer::FindNextClosest (uint32_t lastValidPositi
 
   if (valueFound && m_numOfPasses > 0 && m_lastValidPosition == 0)
     {
-      double difference1 = std::abs (m_container[m_lastValidPosition].at (m_timeColumn) + timeShiftValue - comparisonTimeValue);
-      double difference2 = std::abs (m_container[m_container.size () - 1].at (m_timeColumn) + ((m_numOfPasses - 1) * m_container[m_container.size () - 1].at (m_timeColumn)) - comparisonTimeValue);
+      double difference1 = std::abs (times[m_lastValidPosition] + timeShiftValue - comparisonTimeValue);
+      double difference2 = std::abs (times[sampleCount - 1] + ((m_numOfPasses - 1) * times[sampleCount - 1]) - comparisonTimeValue);
 
       if (difference1 > difference2)
         {
-          m_lastValidPosition = m_container.size () - 1;
+          m_lastValidPosition = sampleCount - 1;
           m_numOfPasses--;
-          m_timeShiftValue = m_numOfPasses * m_container[m_container.size () - 1].at (m_timeColumn);
+          m_timeShiftValue = m_numOfPasses * times[sampleCount - 1];
         }
     }
 
-  NS_LOG_INFO ("Done: " << valueFound << " value: " << m_container[m_lastValidPosition].at (m_timeColumn) << " @ line: " << m_lastValidPosition + 1 << " comparison time value: " << comparisonTimeValue << " passes: " << m_numOfPasses);
+  NS_LOG_INFO ("Done: " << valueFound << " value: " << times[m_lastValidPosition] << " @ line: " << m_lastValidPosition + 1 << " comparison time value: " << comparisonTimeValue << " passes: " << m_numOfPasses);
 
   return valueFound;
 }
@@ -270,16 +312,9 @@ SatInputFileStreamTimeDoubleContainer::ClearContainer ()
 {
   NS_LOG_FUNCTION (this);
 
-  if (!m_container.empty ())
+  if (!m_columns.empty ())
     {
-      for (uint32_t i = 0; i < m_container.size (); i++)
-        {
-          if (!m_container[i].empty ())
-            {
-              m_container[i].clear ();
-            }
-        }
-      m_container.clear ();
+      m_columns.clear ();
     }
 
   m_valuesInRow = 0;
@@ -34,7 +34,10 @@ namespace ns3 {
  * The class implements reading the values from a file, storing the values
  * and iterating the stored values.
  *
- * Row format is [time, value1, ..., value n].
+ * Row format is [time, value1, ..., value n]. The values are stored by
+ * columns, so that the time samples are contiguous in the search for the
+ * closest time sample, and a single value of a sample can be read without
+ * copying the whole row.
  */
 class SatInputFileStreamTimeDoubleContainer : public Object
 {
@@ -77,6 +80,13 @@ public:
    */
   std::vector<double> ProceedToNextClosestTimeSample ();
 
+  /**
+   * \brief Function for locating the next closest time sample and returning one value related to it
+   * \param column index of the value in a row
+   * \return matching value
+   */
+  double ProceedToNextClosestTimeSample (uint32_t column);
+
   /**
    * \brief Do needed dispose actions
    */
@@ -118,6 +128,31 @@ private:
    */
   void CheckContainerSanity ();
 
+  /**
+   * \brief Function for locating the next closest time sample
+   * \return row index of the matching sample
+   */
+  uint32_t FindNextClosestTimeSample ();
+
+  /**
+   * \brief Get the number of the stored time samples (rows)
+   * \return number of time samples
+   */
+  inline uint32_t GetSampleCount () const
+  {
+    return m_columns.empty () ? 0 : m_columns[m_timeColumn].size ();
+  }
+
+  /**
+   * \brief Get the time of a stored time sample
+   * \param row row index of the time sample
+   * \return time of the time sample
+   */
+  inline double GetSampleTime (uint32_t row) const
+  {
+    return m_columns[m_timeColumn][row];
+  }
+
   /**
    * \brief Pointer to input file stream wrapper
    */
@@ -129,9 +164,9 @@ private:
   std::ifstream* m_inputFileStream;
 
   /**
-   * \brief Container for value rows
+   * \brief Container for value columns, indexed by column and row
    */
-  std::vector<std::vector<double> > m_container;
+  std::vector<std::vector<double> > m_columns;
 
   /**
    * \brief File name
@@ -0,0 +1,208 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <vector>
+#include <iomanip>
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/pointer.h"
+#include "ns3/object-ptr-container.h"
+#include "satellite-memory-report.h"
+
+NS_LOG_COMPONENT_DEFINE ("SatMemoryReport");
+
+namespace ns3 {
+
+SatMemoryReport::SatMemoryReport ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SatMemoryReport::~SatMemoryReport ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SatMemoryReport::AddNodes (NodeContainer nodes)
+{
+  NS_LOG_FUNCTION (this << nodes.GetN ());
+
+  for (NodeContainer::Iterator it = nodes.Begin (); it != nodes.End (); ++it)
+    {
+      AddObject (*it);
+    }
+}
+
+void
+SatMemoryReport::AddObject (Ptr<Object> object)
+{
+  NS_LOG_FUNCTION (this << object);
+
+  // the aggregates are followed only from the roots, since an object reached
+  // through an attribute may be aggregated to another node (e.g. the mobility of a GW)
+  Object::AggregateIterator it = object->GetAggregateIterator ();
+
+  while (it.HasNext ())
+    {
+      Visit (ConstCast<Object> (it.Next ()));
+    }
+}
+
+uint32_t
+SatMemoryReport::GetObjectCount () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return m_visited.size ();
+}
+
+uint32_t
+SatMemoryReport::GetObjectCount (std::string typeName) const
+{
+  NS_LOG_FUNCTION (this << typeName);
+
+  std::map<std::string, TypeEntry_t>::const_iterator it = m_types.find (typeName);
+
+  if (it == m_types.end ())
+    {
+      return 0;
+    }
+
+  return it->second.m_count;
+}
+
+uint64_t
+SatMemoryReport::GetTotalSize () const
+{
+  NS_LOG_FUNCTION (this);
+
+  uint64_t totalSize = 0;
+
+  for (std::map<std::string, TypeEntry_t>::const_iterator it = m_types.begin (); it != m_types.end (); ++it)
+    {
+      totalSize += (uint64_t) it->second.m_count * it->second.m_size;
+    }
+
+  return totalSize;
+}
+
+void
+SatMemoryReport::Print (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this);
+
+  std::vector<std::pair<uint64_t, std::string> > rows;
+
+  for (std::map<std::string, TypeEntry_t>::const_iterator it = m_types.begin (); it != m_types.end (); ++it)
+    {
+      rows.push_back (std::make_pair ((uint64_t) it->second.m_count * it->second.m_size, it->first));
+    }
+
+  std::sort (rows.rbegin (), rows.rend ());
+
+  os << "# Object sizes are the sizes of the types registered to the TypeIds. Memory allocated" << std::endl
+     << "# by the objects from the heap (containers, buffers, tables) is not included." << std::endl;
+
+  os << std::left << std::setw (48) << "type" << std::right
+     << std::setw (10) << "count"
+     << std::setw (10) << "size"
+     << std::setw (14) << "total" << std::endl;
+
+  for (std::vector<std::pair<uint64_t, std::string> >::const_iterator it = rows.begin (); it != rows.end (); ++it)
+    {
+      const TypeEntry_t &entry = m_types.find (it->second)->second;
+
+      os << std::left << std::setw (48) << it->second << std::right
+         << std::setw (10) << entry.m_count
+         << std::setw (10) << entry.m_size
+         << std::setw (14) << it->first << std::endl;
+    }
+
+  os << std::left << std::setw (48) << "all" << std::right
+     << std::setw (10) << GetObjectCount ()
+     << std::setw (10) << ""
+     << std::setw (14) << GetTotalSize () << std::endl;
+}
+
+void
+SatMemoryReport::Visit (Ptr<Object> object)
+{
+  if (object == NULL || !m_visited.insert (PeekPointer (object)).second)
+    {
+      return;
+    }
+
+  TypeId tid = object->GetInstanceTypeId ();
+
+  std::pair<std::map<std::string, TypeEntry_t>::iterator, bool> result = m_types.insert (std::make_pair (tid.GetName (), TypeEntry_t ()));
+
+  if (result.second)
+    {
+      // types without a registered size are counted with zero size
+      std::size_t size = tid.GetSize ();
+      result.first->second.m_count = 0;
+      result.first->second.m_size = (size == (std::size_t)(-1)) ? 0 : size;
+    }
+
+  result.first->second.m_count++;
+
+  // follow the Pointer and object container attributes of the type and its parents
+  while (true)
+    {
+      for (uint32_t i = 0; i < tid.GetAttributeN (); ++i)
+        {
+          TypeId::AttributeInformation info = tid.GetAttribute (i);
+
+          if (!(info.flags & TypeId::ATTR_GET) || !info.accessor->HasGetter ())
+            {
+              continue;
+            }
+
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != NULL)
+            {
+              PointerValue value;
+              object->GetAttribute (info.name, value);
+              Visit (value.GetObject ());
+            }
+          else if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker)) != NULL)
+            {
+              ObjectPtrContainerValue value;
+              object->GetAttribute (info.name, value);
+
+              for (ObjectPtrContainerValue::Iterator it = value.Begin (); it != value.End (); ++it)
+                {
+                  Visit (it->second);
+                }
+            }
+        }
+
+      TypeId parent = tid.GetParent ();
+
+      if (parent == tid)
+        {
+          break;
+        }
+
+      tid = parent;
+    }
+}
+
+} // namespace ns3
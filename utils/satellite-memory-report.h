@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014 Magister Solutions Ltd.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SAT_MEMORY_REPORT_H
+#define SAT_MEMORY_REPORT_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <ostream>
+#include "ns3/object.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/node-container.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Memory profile of ns-3 objects by object type.
+ *
+ * Starting from the added root objects (typically nodes), the report follows
+ * the objects aggregated to the roots and, recursively, the objects reachable
+ * through Pointer and object container attributes, i.e. the same object graph
+ * the Config path system uses. Each object is counted once even if it is
+ * shared by several roots, so the report shows the effect of sharing
+ * components between nodes. The size of an object is the size of its type
+ * registered to the TypeId, i.e. memory allocated by the object from the heap
+ * (containers, buffers) is not included.
+ *
+ * This class uses a basic ns-3 reference counting base class but is not
+ * an ns3::Object with attributes, TypeId, or aggregation.
+ */
+class SatMemoryReport : public SimpleRefCount<SatMemoryReport>
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  SatMemoryReport ();
+
+  /**
+   * \brief Destructor
+   */
+  ~SatMemoryReport ();
+
+  /**
+   * \brief Add the objects of the nodes to the report
+   * \param nodes nodes to add
+   */
+  void AddNodes (NodeContainer nodes);
+
+  /**
+   * \brief Add an object, its aggregates and the objects reachable from them to the report
+   * \param object root object to add
+   */
+  void AddObject (Ptr<Object> object);
+
+  /**
+   * \brief Get the number of the objects in the report
+   * \return number of objects
+   */
+  uint32_t GetObjectCount () const;
+
+  /**
+   * \brief Get the number of the objects of a type in the report
+   * \param typeName name of the TypeId, e.g. "ns3::SatUtMac"
+   * \return number of objects of the type
+   */
+  uint32_t GetObjectCount (std::string typeName) const;
+
+  /**
+   * \brief Get the total size of the objects in the report, excluding the
+   * memory allocated by the objects from the heap
+   * \return total size in bytes
+   */
+  uint64_t GetTotalSize () const;
+
+  /**
+   * \brief Print the report as a table with one row per object type, sorted
+   * by the total size of the type. The table is preceded by a note that
+   * the heap memory of the objects is not included.
+   * \param os output stream
+   */
+  void Print (std::ostream &os) const;
+
+private:
+  /**
+   * \brief Objects of one type in the report
+   */
+  typedef struct
+  {
+    uint32_t m_count;
+    std::size_t m_size;
+  } TypeEntry_t;
+
+  /**
+   * \brief Count an object and visit the objects reachable through its attributes
+   * \param object object to visit
+   */
+  void Visit (Ptr<Object> object);
+
+  /**
+   * \brief Objects already counted
+   */
+  std::set<const Object *> m_visited;
+
+  /**
+   * \brief Counted objects by type name
+   */
+  std::map<std::string, TypeEntry_t> m_types;
+};
+
+} // namespace ns3
+
+#endif /* SAT_MEMORY_REPORT_H */
@@ -39,7 +39,7 @@ SatOutputFileStreamDoubleContainer::GetTypeId (void)
 SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer (std::string filename, std::ios::openmode filemode, uint32_t valuesInRow)
   : m_outputFileStreamWrapper (),
     m_outputFileStream (),
-    m_container (),
+    m_chunks (),
     m_fileName (filename),
     m_fileMode (filemode),
     m_valuesInRow (valuesInRow),
@@ -58,7 +58,7 @@ SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer (std::str
 SatOutputFileStreamDoubleContainer::SatOutputFileStreamDoubleContainer ()
   : m_outputFileStreamWrapper (),
     m_outputFileStream (),
-    m_container (),
+    m_chunks (),
     m_fileName (),
     m_fileMode (),
     m_valuesInRow (),
@@ -95,20 +95,25 @@ SatOutputFileStreamDoubleContainer::WriteContainerToFile ()
 
   if (m_outputFileStream->is_open ())
     {
-      for (uint32_t i = 0; i < m_container.size (); i++)
+      for (uint32_t c = 0; c < m_chunks.size (); c++)
         {
-          for (uint32_t j = 0; j < m_valuesInRow; j++ )
+          const std::vector<double> &chunk = m_chunks[c];
+
+          for (uint32_t i = 0; i < chunk.size (); i += m_valuesInRow)
             {
-              if (j + 1 == m_valuesInRow)
-                {
-                  *m_outputFileStream << m_container[i].at (j);
-                }
-              else
+              for (uint32_t j = 0; j < m_valuesInRow; j++ )
                 {
-                  *m_outputFileStream << m_container[i].at (j) << "\t";
+                  if (j + 1 == m_valuesInRow)
+                    {
+                      *m_outputFileStream << chunk[i + j];
+                    }
+                  else
+                    {
+                      *m_outputFileStream << chunk[i + j] << "\t";
+                    }
                 }
+              *m_outputFileStream << std::endl;
             }
-          *m_outputFileStream << std::endl;
         }
       m_outputFileStream->close ();
     }
@@ -150,16 +155,30 @@ SatOutputFileStreamDoubleContainer::PrintFigure ()
 }
 
 void
-SatOutputFileStreamDoubleContainer::AddToContainer (std::vector<double> newItem)
+SatOutputFileStreamDoubleContainer::AddToContainer (const std::vector<double> &newItem)
+{
+  NS_LOG_FUNCTION (this);
+
+  AddToContainer (newItem.data (), newItem.size ());
+}
+
+void
+SatOutputFileStreamDoubleContainer::AddToContainer (const double *newItem, uint32_t size)
 {
   NS_LOG_FUNCTION (this);
 
-  if (newItem.size () != m_valuesInRow)
+  if (size != m_valuesInRow)
     {
       NS_FATAL_ERROR ("SatOutputFileStreamDoubleContainer::AddToContainer - Invalid vector size");
     }
 
-  m_container.push_back (newItem);
+  if (m_chunks.empty () || m_chunks.back ().size () + m_valuesInRow > CHUNK_ROWS * m_valuesInRow)
+    {
+      m_chunks.push_back (std::vector<double> ());
+      m_chunks.back ().reserve (CHUNK_ROWS * m_valuesInRow);
+    }
+
+  m_chunks.back ().insert (m_chunks.back ().end (), newItem, newItem + size);
 }
 
 void
@@ -201,17 +220,7 @@ SatOutputFileStreamDoubleContainer::ClearContainer ()
 {
   NS_LOG_FUNCTION (this);
 
-  if (!m_container.empty ())
-    {
-      for (uint32_t i = 0; i < m_container.size (); i++)
-        {
-          if (!m_container[i].empty ())
-            {
-              m_container[i].clear ();
-            }
-        }
-      m_container.clear ();
-    }
+  m_chunks.clear ();
 
   m_valuesInRow = 0;
 }
@@ -225,15 +234,20 @@ SatOutputFileStreamDoubleContainer::GetGnuplotDataset ()
   ret.SetTitle (m_title);
   ret.SetStyle (m_style);
 
-  if (!m_container.empty ())
+  if (!m_chunks.empty ())
     {
       switch (m_valuesInRow)
         {
         case 2:
           {
-            for (uint32_t i = 0; i < m_container.size (); i++)
+            for (uint32_t c = 0; c < m_chunks.size (); c++)
               {
-                ret.Add (m_container[i].at (0), ConvertValue (m_container[i].at (1)));
+                const std::vector<double> &chunk = m_chunks[c];
+
+                for (uint32_t i = 0; i < chunk.size (); i += m_valuesInRow)
+                  {
+                    ret.Add (chunk[i], ConvertValue (chunk[i + 1]));
+                  }
               }
             break;
           }
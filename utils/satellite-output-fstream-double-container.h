@@ -34,6 +34,9 @@ namespace ns3 {
  * \brief Class for output file stream container for double values.
  * The class implements storing the values and writing the stored
  * values into a file. A figure output in two dimensions is also supported.
+ *
+ * The values are stored row by row in preallocated chunks of fixed width, so
+ * that adding a row does not allocate memory except when a chunk is full.
  */
 class SatOutputFileStreamDoubleContainer : public Object
 {
@@ -76,8 +79,16 @@ public:
 
   /**
    * \brief Function for adding the values to container
+   * \param newItem row of values
+   */
+  void AddToContainer (const std::vector<double> &newItem);
+
+  /**
+   * \brief Function for adding the values to container
+   * \param newItem array of values
+   * \param size number of values, shall equal the number of values in a row
    */
-  void AddToContainer (std::vector<double> newItem);
+  void AddToContainer (const double *newItem, uint32_t size);
 
   /**
    * \brief Do needed dispose actions
@@ -156,9 +167,14 @@ private:
   std::ofstream* m_outputFileStream;
 
   /**
-   * \brief Container for value rows
+   * \brief Number of rows in a chunk of values
+   */
+  static const uint32_t CHUNK_ROWS = 1024;
+
+  /**
+   * \brief Chunks of value rows. Each chunk has room for CHUNK_ROWS rows.
    */
-  std::vector<std::vector<double> > m_container;
+  std::vector<std::vector<double> > m_chunks;
 
   /**
    * \brief File name